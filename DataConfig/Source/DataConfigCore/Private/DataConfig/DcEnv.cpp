@@ -2,28 +2,87 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
+#include "DataConfig/SerDe/DcEnumTable.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
 
-TArray<FDcEnv> gDcEnvs;
+namespace DcEnvDetails {
+
+std::atomic<bool> bInitialized{false};
+
+thread_local TArray<FDcEnv> Envs;
+
+FCriticalSection SharedConsumerLock;
+TSharedPtr<IDcDiagnosticConsumer> SharedConsumer;
+
+static FORCEINLINE TArray<FDcEnv>& ThreadEnvs()
+{
+	//	threads other than the startup one get a root env on first use, which forwards to the shared consumer
+	if (Envs.Num() == 0)
+		Envs[Envs.Emplace()].bForwardToSharedConsumer = bInitialized;
+
+	return Envs;
+}
+
+} // namespace DcEnvDetails
 
 FDcEnv& DcEnv()
 {
 	check(DcIsInitialized());
-	return gDcEnvs[gDcEnvs.Num() - 1];
+	return DcEnvDetails::ThreadEnvs().Last();
+}
+
+FDcEnv& DcParentEnv()
+{
+	TArray<FDcEnv>& Envs = DcEnvDetails::ThreadEnvs();
+	check(Envs.Num() >= 2);
+	return Envs[Envs.Num() - 2];
 }
 
 FDcEnv& DcPushEnv()
 {
-	return gDcEnvs[gDcEnvs.Emplace()];
+	TArray<FDcEnv>& Envs = DcEnvDetails::ThreadEnvs();
+	return Envs[Envs.Emplace()];
 }
 
 void DcPopEnv()
 {
-	gDcEnvs.RemoveAt(gDcEnvs.Num() - 1);
+	TArray<FDcEnv>& Envs = DcEnvDetails::Envs;
+	Envs.RemoveAt(Envs.Num() - 1);
+}
+
+void DcFlushThreadEnv()
+{
+	TArray<FDcEnv>& Envs = DcEnvDetails::Envs;
+	while (Envs.Num())
+		DcPopEnv();
+
+	Envs.Empty();
+}
+
+void DcSetSharedDiagConsumer(TSharedPtr<IDcDiagnosticConsumer> InConsumer)
+{
+	FScopeLock Lock(&DcEnvDetails::SharedConsumerLock);
+	DcEnvDetails::SharedConsumer = MoveTemp(InConsumer);
+}
+
+TSharedPtr<IDcDiagnosticConsumer> DcGetSharedDiagConsumer()
+{
+	FScopeLock Lock(&DcEnvDetails::SharedConsumerLock);
+	return DcEnvDetails::SharedConsumer;
 }
 
 FDcDiagnostic& FDcEnv::Diag(FDcErrorCode InErr)
 {
-	return Diagnostics[Diagnostics.Emplace(InErr)];
+	if (DiagMode == EDcDiagMode::Silent)
+	{
+		SilentDiag.Code = InErr;
+		return SilentDiag;
+	}
+
+	FDcDiagnostic& Diag = Diagnostics[Diagnostics.Emplace(InErr)];
+	Diag.bDeferred = DiagMode == EDcDiagMode::Deferred;
+	return Diag;
 }
 
 void FDcEnv::FlushDiags()
@@ -34,10 +93,27 @@ void FDcEnv::FlushDiags()
 	if (DiagConsumer.IsValid())
 	{
 		for (FDcDiagnostic& Diag : Diagnostics)
+		{
+			Diag.FormatDeferred();
 			DiagConsumer->HandleDiagnostic(Diag);
+		}
 
 		DiagConsumer->OnPostFlushDiags();
 	}
+	else if (bForwardToSharedConsumer)
+	{
+		FScopeLock Lock(&DcEnvDetails::SharedConsumerLock);
+		if (IDcDiagnosticConsumer* SharedConsumer = DcEnvDetails::SharedConsumer.Get())
+		{
+			for (FDcDiagnostic& Diag : Diagnostics)
+			{
+				Diag.FormatDeferred();
+				SharedConsumer->HandleDiagnostic(Diag);
+			}
+
+			SharedConsumer->OnPostFlushDiags();
+		}
+	}
 
 	Diagnostics.Empty();
 }
@@ -47,14 +123,12 @@ FDcEnv::~FDcEnv()
 	FlushDiags();
 }
 
-namespace DcEnvDetails {
-
-bool bInitialized = false;
-
-} // namespace DcEnvDetails
-
 FDcResult DcFail()
 {
+	//	only walk stack when formatting right away, deferred and silent failures are expected to be cheap
+	if (DcEnv().DiagMode != EDcDiagMode::Full)
+		return DC_FAIL(DcDCommon, PlaceHoldError);
+
 	//	attach a stack trace as otherwise it's very difficult to find
 	return DC_FAIL(DcDCommon, PlaceHoldError)
 		<< FDcDiagnosticStringNoEscape(DcDiagnosticUtils::StackWalkToString(0));
@@ -75,21 +149,24 @@ void DcStartUp(EDcInitializeAction InAction)
 	DcDiagGroups.Emplace(&DcDSerDe::Details);
 	DcDiagGroups.Emplace(&DcDMsgPack::Details);
 
-	DcPushEnv();
+	DcEnvDetails::ThreadEnvs();
 	DcEnvDetails::bInitialized = true;
 
 	if (InAction == EDcInitializeAction::SetAsConsole)
 	{
 		DcEnv().DiagConsumer = MakeShareable(new FDcDefaultLogDiagnosticConsumer());
+		DcSetSharedDiagConsumer(MakeShareable(new FDcDefaultLogDiagnosticConsumer()));
 	}
 }
 
 void DcShutDown()
 {
-	while (gDcEnvs.Num())
-		DcPopEnv();
+	//	only envs on this thread, workers release theirs with `DcFlushThreadEnv`
+	DcFlushThreadEnv();
 
+	DcSetSharedDiagConsumer(nullptr);
 	DcDiagGroups.RemoveAt(0, DcDiagGroups.Num());
+	FDcEnumTable::ResetCache();
 
 	DcEnvDetails::bInitialized = false;
 }
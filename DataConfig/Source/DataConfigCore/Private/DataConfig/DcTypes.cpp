@@ -1,4 +1,141 @@
 #include "DataConfig/DcTypes.h"
+#include "DataConfig/Misc/DcUtf8.h"
+#include "Misc/StringBuilder.h"
 
 DEFINE_LOG_CATEGORY(LogDataConfigCore);
 
+FString FDcStringViewData::ToString() const &
+{
+	switch (Type)
+	{
+		case EType::Tchar: return FString(Num, GetTcharPtr());
+		case EType::Ascii: return FString(Num, GetAsciiPtr());
+		case EType::Utf8: return DcUtf8::ToString((const uint8*)GetUtf8Ptr(), Num, CharNum);
+		default: return Owned;
+	}
+}
+
+FString FDcStringViewData::ToString() &&
+{
+	if (Type == EType::Owned)
+		return MoveTemp(Owned);
+
+	return static_cast<const FDcStringViewData&>(*this).ToString();
+}
+
+FName FDcStringViewData::ToName() const
+{
+	switch (Type)
+	{
+		case EType::Tchar: return FName(Num, GetTcharPtr());
+		case EType::Ascii: return FName(Num, GetAsciiPtr());
+		case EType::Utf8:
+		{
+			//	decode on stack as names are short
+			TArray<TCHAR, TInlineAllocator<NAME_SIZE>> Chars;
+			Chars.Reserve(CharNum);
+			DcUtf8::ForEachChar((const uint8*)GetUtf8Ptr(), Num, [&Chars](TCHAR Ch)
+			{
+				Chars.Add(Ch);
+				return true;
+			});
+			return FName(Chars.Num(), Chars.GetData());
+		}
+		default: return FName(Owned);
+	}
+}
+
+void FDcStringViewData::AppendTo(FStringBuilderBase& Sb) const
+{
+	switch (Type)
+	{
+		case EType::Tchar:
+			Sb.Append(GetTcharPtr(), Num);
+			break;
+		case EType::Ascii:
+		{
+			const ANSICHAR* Ptr = GetAsciiPtr();
+			for (int32 Ix = 0; Ix < Num; Ix++)
+				Sb.AppendChar((TCHAR)Ptr[Ix]);
+			break;
+		}
+		case EType::Utf8:
+		{
+			DcUtf8::ForEachChar((const uint8*)GetUtf8Ptr(), Num, [&Sb](TCHAR Ch)
+			{
+				Sb.AppendChar(Ch);
+				return true;
+			});
+			break;
+		}
+		default:
+			Sb.Append(*Owned, Owned.Len());
+			break;
+	}
+}
+
+bool FDcStringViewData::Equals(FStringView Other) const
+{
+	if (Len() != Other.Len())
+		return false;
+
+	switch (Type)
+	{
+		case EType::Tchar:
+			return FCString::Strncmp(GetTcharPtr(), Other.GetData(), Num) == 0;
+		case EType::Ascii:
+		{
+			const ANSICHAR* Ptr = GetAsciiPtr();
+			for (int32 Ix = 0; Ix < Num; Ix++)
+			{
+				if ((TCHAR)Ptr[Ix] != Other[Ix])
+					return false;
+			}
+			return true;
+		}
+		case EType::Utf8:
+		{
+			int32 Ix = 0;
+			return DcUtf8::ForEachChar((const uint8*)GetUtf8Ptr(), Num, [&Other, &Ix](TCHAR Ch)
+			{
+				return Ch == Other[Ix++];
+			});
+		}
+		default:
+			return FCString::Strncmp(*Owned, Other.GetData(), Owned.Len()) == 0;
+	}
+}
+
+bool FDcStringViewData::Equals(const FDcStringViewData& Other) const
+{
+	if (Len() != Other.Len())
+		return false;
+
+	//	valid UTF8 is canonical so equal strings have equal bytes
+	if (IsUtf8Bytes() && Other.IsUtf8Bytes())
+		return Num == Other.Num && FPlatformMemory::Memcmp(DataPtr, Other.DataPtr, Num) == 0;
+
+	if (Other.IsUtf8Bytes())
+		return Other.Equals(*this);
+
+	switch (Other.Type)
+	{
+		case EType::Tchar: return Equals(FStringView(Other.GetTcharPtr(), Other.Num));
+		default: return Equals(FStringView(Other.Owned));
+	}
+}
+
+TCHAR FDcStringViewData::GetUtf8Char(int32 Ix) const
+{
+	TCHAR Ret = TCHAR('\0');
+	int32 CharIx = 0;
+	DcUtf8::ForEachChar((const uint8*)GetUtf8Ptr(), Num, [&Ret, &CharIx, Ix](TCHAR Ch)
+	{
+		if (CharIx++ != Ix)
+			return true;
+
+		Ret = Ch;
+		return false;
+	});
+	return Ret;
+}
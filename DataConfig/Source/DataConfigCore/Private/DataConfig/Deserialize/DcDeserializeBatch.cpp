@@ -0,0 +1,126 @@
+#include "DataConfig/Deserialize/DcDeserializeBatch.h"
+#include "DataConfig/Deserialize/DcDeserializer.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Source/DcMappedFile.h"
+#include "DataConfig/DcEnv.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include <atomic>
+
+namespace DcDeserializeBatchDetails
+{
+
+static FDcResult DeserializeWithReader(FDcDeserializeContext& Ctx, FDcReader& Reader)
+{
+	Ctx.Reader = &Reader;
+	DC_TRY(Ctx.Prepare());
+	return Ctx.Deserializer->Deserialize(Ctx);
+}
+
+static FDcResult LoadJob(const FDcBatchLoadJob& Job, FDcDeserializer* Deserializer, const FDcDeserializeProjection* Projection)
+{
+	TArrayView<const uint8> Data = Job.Buffer;
+	FDcMappedFile File;
+	if (!Job.FilePath.IsEmpty())
+	{
+		DC_TRY(File.Open(*Job.FilePath));
+		Data = TArrayView<const uint8>(File.GetData(), File.Num());
+	}
+
+	FDcPropertyWriter Writer(Job.Target);
+	FDcDeserializeContext Ctx;
+	Ctx.Writer = &Writer;
+	Ctx.Deserializer = Deserializer;
+	Ctx.Projection = Projection;
+	Ctx.Properties.Add(Job.Target.Property);
+
+	if (Job.Format == EDcBatchLoadFormat::Json)
+	{
+		int32 Offset = 0;
+		if (Data.Num() >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+			Offset = 3;
+
+		FDcAnsiJsonReader Reader((const ANSICHAR*)Data.GetData() + Offset, Data.Num() - Offset);
+		Reader.DiagFilePath = Job.FilePath;
+
+		DC_TRY(DeserializeWithReader(Ctx, Reader));
+		return Reader.FinishRead();
+	}
+	else if (Job.Format == EDcBatchLoadFormat::MsgPack)
+	{
+		FDcMsgPackReader Reader(FDcBlobViewData{const_cast<uint8*>(Data.GetData()), Data.Num()});
+		return DeserializeWithReader(Ctx, Reader);
+	}
+	else
+	{
+		return DcNoEntry();
+	}
+}
+
+} // namespace DcDeserializeBatchDetails
+
+FDcBatchLoadResults DcBatchLoad(TArrayView<const FDcBatchLoadJob> Jobs, const FDcBatchLoadConfig& Config)
+{
+	using namespace DcDeserializeBatchDetails;
+
+	FDcBatchLoadResults Ret;
+	Ret.Results.SetNum(Jobs.Num());
+	if (Jobs.Num() == 0)
+		return Ret;
+
+	//	resolve lazy statics on the calling thread before fanning out
+	FDcDeserializer* JsonDeserializer = Config.JsonDeserializer
+		? Config.JsonDeserializer
+		: &DcGetDefaultJsonDeserializer();
+	FDcDeserializer* MsgPackDeserializer = Config.MsgPackDeserializer
+		? Config.MsgPackDeserializer
+		: &DcGetDefaultMsgPackDeserializer();
+	checkf(JsonDeserializer->IsFrozen() && MsgPackDeserializer->IsFrozen(),
+		TEXT("batch load deserializers must be frozen"));
+	(void)FDcPropertyConfig::MakeDefault();
+
+	int32 NumWorkers = Config.NumWorkers > 0
+		? Config.NumWorkers
+		: FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	NumWorkers = FMath::Clamp(NumWorkers, 1, Jobs.Num());
+
+	//	workers pull jobs from a shared counter so uneven documents still balance out
+	std::atomic<int32> NextJobIx{0};
+	ParallelFor(NumWorkers, [&](int32)
+	{
+		while (true)
+		{
+			int32 JobIx = NextJobIx.fetch_add(1, std::memory_order_relaxed);
+			if (JobIx >= Jobs.Num())
+				break;
+
+			const FDcBatchLoadJob& Job = Jobs[JobIx];
+			FDcBatchLoadResult& Result = Ret.Results[JobIx];
+
+			FDcScopedEnv ScopedEnv;
+			FDcEnv& Env = DcEnv();
+			Env.bExpectFail = true;
+			Env.DiagMode = Config.DiagMode;
+
+			FDcDeserializer* Deserializer = Job.Format == EDcBatchLoadFormat::MsgPack
+				? MsgPackDeserializer
+				: JsonDeserializer;
+			Result.bOk = LoadJob(Job, Deserializer, Config.Projection).Ok();
+
+			//	take diagnostics before the env pops so they aren't flushed
+			Result.Diagnostics = MoveTemp(Env.Diagnostics);
+		}
+	}, NumWorkers == 1);
+
+	for (FDcBatchLoadResult& Result : Ret.Results)
+	{
+		if (!Result.bOk)
+			Ret.NumFailed++;
+	}
+
+	return Ret;
+}
+
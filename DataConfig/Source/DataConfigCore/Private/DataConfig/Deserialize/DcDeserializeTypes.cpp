@@ -3,6 +3,7 @@
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
 #include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Misc/DcUtf8.h"
 
 FDcResult FDcDeserializeContext::Prepare()
 {
@@ -38,6 +39,152 @@ FDcResult FDcDeserializeContext::Prepare()
 		return DC_FAIL(DcDSerDe, ContextExpectOneProperty) << Properties.Num();
 	}
 
+	ProjectionNode = Projection ? 0 : INDEX_NONE;
+
 	State = EState::Ready;
 	return DcOk();
 }
+
+FDcDeserializeProjection::FDcDeserializeProjection()
+{
+	Nodes.AddDefaulted();
+}
+
+void FDcDeserializeProjection::AddPath(FStringView Path)
+{
+	int32 NodeIx = 0;
+	while (Path.Len())
+	{
+		int32 DotIx;
+		FStringView Segment = Path;
+		if (Path.FindChar(TCHAR('.'), DotIx))
+		{
+			Segment = Path.Left(DotIx);
+			Path.RightChopInline(DotIx + 1);
+		}
+		else
+		{
+			Path.Reset();
+		}
+
+		if (Segment.Len() == 0)
+			continue;
+
+		FName Name(Segment.Len(), Segment.GetData());
+		if (int32* ChildPtr = Nodes[NodeIx].Children.Find(Name))
+		{
+			NodeIx = *ChildPtr;
+		}
+		else
+		{
+			int32 ChildIx = Nodes.AddDefaulted();
+			Nodes[NodeIx].Children.Add(Name, ChildIx);
+			NodeIx = ChildIx;
+		}
+	}
+
+	if (NodeIx != 0)
+		Nodes[NodeIx].bSelectAll = true;
+}
+
+UObject* FDcObjectReferenceCache::Find(UClass* Class, const FDcStringViewData& Str) const
+{
+	for (auto It = Entries.CreateConstKeyIterator(FDcTypeResolveCache::HashStr(Str)); It; ++It)
+	{
+		const FEntry& Entry = It.Value();
+		if (Entry.Class == Class && Str.Equals(FStringView(Entry.Str)))
+			return Entry.Object.Get();
+	}
+
+	return nullptr;
+}
+
+void FDcObjectReferenceCache::Add(UClass* Class, const FDcStringViewData& Str, UObject* Object)
+{
+	check(Object);
+	uint32 Hash = FDcTypeResolveCache::HashStr(Str);
+	for (auto It = Entries.CreateKeyIterator(Hash); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+		if (Entry.Class == Class && Str.Equals(FStringView(Entry.Str)))
+		{
+			Entry.Object = Object;
+			return;
+		}
+	}
+
+	Entries.Add(Hash, {Str.ToString(), Class, Object});
+}
+
+uint32 FDcTypeResolveCache::HashStr(const FDcStringViewData& Str)
+{
+	//	FNV-1a
+	uint32 Hash = 2166136261u;
+	auto _Step = [&Hash](TCHAR Ch)
+	{
+		Hash = (Hash ^ (uint32)Ch) * 16777619u;
+		return true;
+	};
+
+	switch (Str.Type)
+	{
+		case FDcStringViewData::EType::Tchar:
+		{
+			const TCHAR* Ptr = Str.GetTcharPtr();
+			for (int32 Ix = 0; Ix < Str.Num; Ix++)
+				_Step(Ptr[Ix]);
+			break;
+		}
+		case FDcStringViewData::EType::Ascii:
+		{
+			const ANSICHAR* Ptr = Str.GetAsciiPtr();
+			for (int32 Ix = 0; Ix < Str.Num; Ix++)
+				_Step((TCHAR)Ptr[Ix]);
+			break;
+		}
+		case FDcStringViewData::EType::Utf8:
+			DcUtf8::ForEachChar((const uint8*)Str.GetUtf8Ptr(), Str.Num, _Step);
+			break;
+		default:
+			for (TCHAR Ch : Str.Owned)
+				_Step(Ch);
+			break;
+	}
+
+	return Hash;
+}
+
+UStruct* FDcTypeResolveCache::Find(const FDcStringViewData& Str, UClass* Kind) const
+{
+	for (auto It = Entries.CreateConstKeyIterator(HashStr(Str)); It; ++It)
+	{
+		const FEntry& Entry = It.Value();
+		if (Entry.Kind != Kind || !Str.Equals(FStringView(Entry.Str)))
+			continue;
+
+		UStruct* Type = Entry.Type.Get();
+		if (Type == nullptr || Type->HasAnyFlags(RF_NewerVersionExists))
+			return nullptr;
+
+		return Type;
+	}
+
+	return nullptr;
+}
+
+void FDcTypeResolveCache::Add(const FDcStringViewData& Str, UClass* Kind, UStruct* Type)
+{
+	check(Type);
+	uint32 Hash = HashStr(Str);
+	for (auto It = Entries.CreateKeyIterator(Hash); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+		if (Entry.Kind == Kind && Str.Equals(FStringView(Entry.Str)))
+		{
+			Entry.Type = Type;
+			return;
+		}
+	}
+
+	Entries.Add(Hash, {Str.ToString(), Kind, Type});
+}
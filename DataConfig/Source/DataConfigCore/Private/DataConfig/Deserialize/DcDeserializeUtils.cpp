@@ -3,6 +3,10 @@
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Reader/DcTapeReader.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "Misc/PackageName.h"
 
 namespace DcDeserializeUtils
 {
@@ -22,6 +26,25 @@ FDcResult RecursiveDeserialize(FDcDeserializeContext& Ctx)
 	return DcOk();
 }
 
+FDcResult RecursiveDeserializeField(FDcDeserializeContext& Ctx, FName FieldName)
+{
+	if (Ctx.ProjectionNode == INDEX_NONE)
+	{
+		DC_TRY(Ctx.Writer->WriteName(FieldName));
+		return RecursiveDeserialize(Ctx);
+	}
+
+	const int32* ChildPtr = Ctx.Projection->Nodes[Ctx.ProjectionNode].Children.Find(FieldName);
+	if (ChildPtr == nullptr)
+		return Ctx.Reader->SkipValue();
+
+	int32 ChildNode = Ctx.Projection->Nodes[*ChildPtr].bSelectAll ? INDEX_NONE : *ChildPtr;
+	TDcStoreThenReset<int32> RestoreNode(Ctx.ProjectionNode, ChildNode);
+
+	DC_TRY(Ctx.Writer->WriteName(FieldName));
+	return RecursiveDeserialize(Ctx);
+}
+
 EDcDeserializePredicateResult PredicateIsRootProperty(FDcDeserializeContext& Ctx)
 {
 	check(Ctx.Properties.Num() > 0);
@@ -30,6 +53,132 @@ EDcDeserializePredicateResult PredicateIsRootProperty(FDcDeserializeContext& Ctx
 		: EDcDeserializePredicateResult::Pass;
 }
 
+FDcResult ReadMetaType(FDcReader* Reader, FString* OutPtr)
+{
+	if (FDcTapeReader* TapeReader = Reader->CastById<FDcTapeReader>())
+	{
+		bool bFound;
+		DC_TRY(TapeReader->ReadMapStringByKey(TEXT("$type"), OutPtr, &bFound));
+		if (!bFound)
+			return DC_FAIL(DcDSerDe, ExpectMetaType);
+
+		return DcOk();
+	}
+
+	FString Str;
+	DC_TRY(Reader->ReadString(&Str));
+	if (Str != TEXT("$type"))
+		return DC_FAIL(DcDSerDe, ExpectMetaType);
+
+	return Reader->ReadString(OutPtr);
+}
+
+FDcResult ReadMetaType(FDcReader* Reader, FDcStringViewData* OutPtr)
+{
+	if (FDcTapeReader* TapeReader = Reader->CastById<FDcTapeReader>())
+	{
+		bool bFound;
+		DC_TRY(TapeReader->ReadMapStringByKey(TEXT("$type"), OutPtr, &bFound));
+		if (!bFound)
+			return DC_FAIL(DcDSerDe, ExpectMetaType);
+
+		return DcOk();
+	}
+
+	FDcStringViewData Key;
+	DC_TRY(Reader->ReadStringView(&Key));
+	if (!Key.Equals(TEXT("$type")))
+		return DC_FAIL(DcDSerDe, ExpectMetaType);
+
+	return Reader->ReadStringView(OutPtr);
+}
+
+FDcResult ResolveDeferredReferences(const FDcDeferredReferences& Deferred, FDcObjectReferenceCache* Cache)
+{
+	for (const FDcDeferredReferences::FEntry& Entry : Deferred.Entries)
+	{
+		FString PathStr = Entry.Path.ToString();
+		UClass* LoadClass = Entry.bIsClass ? UClass::StaticClass() : Entry.ExpectClass;
+
+		UObject* Loaded = Cache ? Cache->Find(LoadClass, PathStr) : nullptr;
+		if (!Loaded)
+		{
+			DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *PathStr, Loaded));
+			if (Cache)
+				Cache->Add(LoadClass, PathStr, Loaded);
+		}
+
+		if (Entry.bIsClass)
+		{
+			if (!Loaded->IsA<UClass>())
+			{
+				return DC_FAIL(DcDSerDe, UObjectTypeMismatch)
+					<< TEXT("UClass") << Loaded->GetClass()->GetFName();
+			}
+
+			DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(CastChecked<UClass>(Loaded), Entry.ExpectClass));
+		}
+		else
+		{
+			DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(Loaded->GetClass(), Entry.ExpectClass));
+		}
+	}
+
+	return DcOk();
+}
+
+void LoadDeferredReferencesAsync(const FDcDeferredReferences& Deferred, TFunction<void(FDcResult)> OnLoaded)
+{
+	TSet<FString> PackageNames;
+	for (const FDcDeferredReferences::FEntry& Entry : Deferred.Entries)
+	{
+		FString PackageName = Entry.Path.GetLongPackageName();
+		//	native packages are always loaded
+		if (!FPackageName::IsScriptPackage(PackageName))
+			PackageNames.Add(MoveTemp(PackageName));
+	}
+
+	if (PackageNames.Num() == 0)
+	{
+		OnLoaded(ResolveDeferredReferences(Deferred));
+		return;
+	}
+
+	struct FPendingLoads
+	{
+		int32 Pending;
+		bool bAllLoaded;
+		FDcDeferredReferences Deferred;
+		TFunction<void(FDcResult)> OnLoaded;
+	};
+
+	TSharedRef<FPendingLoads> Loads = MakeShared<FPendingLoads>();
+	Loads->Pending = PackageNames.Num();
+	Loads->bAllLoaded = true;
+	Loads->Deferred = Deferred;
+	Loads->OnLoaded = MoveTemp(OnLoaded);
+	for (const FString& PackageName : PackageNames)
+	{
+		LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda(
+			[Loads](const FName& LoadedName, UPackage* Package, EAsyncLoadingResult::Type Result)
+			{
+				if (Result != EAsyncLoadingResult::Succeeded || Package == nullptr)
+				{
+					Loads->bAllLoaded = false;
+					DC_FAIL(DcDSerDe, PackageAsyncLoadFailed) << LoadedName << (int32)Result;
+				}
+
+				if (--Loads->Pending > 0)
+					return;
+
+				//	packages are in memory now, resolve to check objects and classes
+				Loads->OnLoaded(Loads->bAllLoaded
+					? ResolveDeferredReferences(Loads->Deferred)
+					: FDcResult{FDcResult::EStatus::Error});
+			}));
+	}
+}
+
 } // namespace DcDeserializeUtils
 
 
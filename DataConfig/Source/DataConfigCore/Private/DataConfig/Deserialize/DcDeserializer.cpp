@@ -11,7 +11,7 @@
 namespace DcDeserializerDetails
 {
 
-static FORCEINLINE FDcResult ExecuteDeserializeHandler(FDcDeserializeContext& Ctx, FDcDeserializeDelegate& Handler)
+static FORCEINLINE FDcResult ExecuteDeserializeHandler(FDcDeserializeContext& Ctx, const FDcDeserializeDelegate& Handler)
 {
 	if (!Handler.IsBound())
 		return DC_FAIL(DcDCommon, StaleDelegate);
@@ -19,25 +19,26 @@ static FORCEINLINE FDcResult ExecuteDeserializeHandler(FDcDeserializeContext& Ct
 	return Handler.Execute(Ctx);
 }
 
-static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& Ctx)
+//	handler containers of either the instance or its frozen snapshot
+struct FHandlers
 {
-	//	use predicated deserializers first, if it's not handled then try direct handlers
-	for (auto& PredEntry : Self->PredicatedDeserializers)
-	{
-		if (!PredEntry.Predicate.IsBound())
-			return DC_FAIL(DcDCommon, StaleDelegate);
+	const TArray<FDcDeserializer::FPredicatedHandlerEntry>& PredicatedDeserializers;
+	const TMap<UClass*, FDcDeserializeDelegate>& UClassDeserializerMap;
+	const TMap<FFieldClass*, FDcDeserializeDelegate>& FieldClassDeserializerMap;
+	const TMap<UStruct*, FDcDeserializeDelegate>& StructDeserializeMap;
+};
 
-		if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
-			return ExecuteDeserializeHandler(Ctx, PredEntry.Handler);
-	}
+using FResolutionCache = TMap<FDcDeserializer::FResolutionKey, FDcDeserializer::FResolutionEntry>;
 
+static FDcResult ResolveDirectHandler(const FHandlers& Handlers, FDcDeserializeContext& Ctx, const FDcDeserializeDelegate*& OutHandlerPtr)
+{
 	FFieldVariant& Property = Ctx.TopProperty();
-	FDcDeserializeDelegate* HandlerPtr = nullptr;
+	const FDcDeserializeDelegate* HandlerPtr = nullptr;
 
 	if (!Ctx.bSkipStructHandlers)
 	{
 		if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
-			HandlerPtr = Self->StructDeserializeMap.Find(Struct);
+			HandlerPtr = Handlers.StructDeserializeMap.Find(Struct);
 	}
 
 	if (!HandlerPtr)
@@ -47,7 +48,7 @@ static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& C
 			UObject* Object = CastChecked<UObject>(Property.ToUObjectUnsafe());
 			check(IsValid(Object));
 			UClass* Class = Object->GetClass();
-			HandlerPtr = Self->UClassDeserializerMap.Find(Class);
+			HandlerPtr = Handlers.UClassDeserializerMap.Find(Class);
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << Class->GetFName();
@@ -57,34 +58,200 @@ static FDcResult DeserializeBody(FDcDeserializer* Self, FDcDeserializeContext& C
 			FField* Field = Property.ToFieldUnsafe();
 			check(Field->IsValidLowLevel());
 			FFieldClass* FieldClass = Field->GetClass();
-			HandlerPtr = Self->FieldClassDeserializerMap.Find(FieldClass);
+			HandlerPtr = Handlers.FieldClassDeserializerMap.Find(FieldClass);
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << FieldClass->GetFName();
 		}
 	}
 
+	OutHandlerPtr = HandlerPtr;
+	return DcOk();
+}
+
+static FDcResult DeserializeBody(const FHandlers& Handlers, FDcDeserializeContext& Ctx)
+{
+	//	use predicated deserializers first, if it's not handled then try direct handlers
+	for (auto& PredEntry : Handlers.PredicatedDeserializers)
+	{
+		if (!PredEntry.Predicate.IsBound())
+			return DC_FAIL(DcDCommon, StaleDelegate);
+
+		if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
+			return ExecuteDeserializeHandler(Ctx, PredEntry.Handler);
+	}
+
+	const FDcDeserializeDelegate* HandlerPtr = nullptr;
+	DC_TRY(ResolveDirectHandler(Handlers, Ctx, HandlerPtr));
+
 	return ExecuteDeserializeHandler(Ctx, *HandlerPtr);
 }
 
-static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
+static FORCEINLINE bool IsPure(const FDcDeserializer::FPredicatedHandlerEntry& PredEntry)
 {
-	if (Diag.Highlights.IndexOfByPredicate([&Ctx](auto& Highlight){
-		return Highlight.Owner == Ctx.Deserializer;}) != INDEX_NONE)
-		return;
+	return PredEntry.Flag == EDcDeserializePredicateFlag::Pure;
+}
 
-	FDcDiagnosticHighlight Highlight(Ctx.Deserializer, TEXT("DcSerializer"));
+static void CheckResolutionCacheStale(FDcDeserializer* Self)
+{
+	int32 Nums[4] = {
+		Self->PredicatedDeserializers.Num(),
+		Self->UClassDeserializerMap.Num(),
+		Self->FieldClassDeserializerMap.Num(),
+		Self->StructDeserializeMap.Num(),
+	};
+
+	if (FMemory::Memcmp(Nums, Self->ResolutionHandlerNums, sizeof(Nums)) != 0)
+	{
+		Self->ResolutionCache.Reset();
+		FMemory::Memcpy(Self->ResolutionHandlerNums, Nums, sizeof(Nums));
+	}
+}
+
+//	frozen instances are shared so each thread memoizes on its own. Slots are tagged by generation,
+//	which is unique per `Freeze` and `ResetResolutionCache`, thus entries of a destroyed instance
+//	never match. Returned cache is only valid until the next call on this thread.
+static FResolutionCache& GetThreadResolutionCache(FDcDeserializer* Self)
+{
+	struct FSlot
+	{
+		int32 Generation;
+		FResolutionCache Cache;
+	};
+
+	constexpr int32 MaxSlots = 4;
+	static thread_local TArray<FSlot, TInlineAllocator<MaxSlots>> Slots;
+
+	int32 Generation = Self->ResolutionGeneration.GetValue();
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Generation == Generation)
+			return Slot.Cache;
+	}
+
+	if (Slots.Num() == MaxSlots)
+		Slots.RemoveAt(0);
+
+	FSlot& Slot = Slots.AddDefaulted_GetRef();
+	Slot.Generation = Generation;
+	return Slot.Cache;
+}
+
+static FDcResult DeserializeBodyCached(const FHandlers& Handlers, FResolutionCache& Cache, FDcDeserializer::FResolutionStats* Stats, FDcDeserializeContext& Ctx)
+{
+	FFieldVariant& Property = Ctx.TopProperty();
+	FDcDeserializer::FResolutionKey Key{
+		Property.IsUObject() ? (void*)Property.ToUObjectUnsafe() : (void*)Property.ToFieldUnsafe(),
+		Ctx.bSkipStructHandlers,
+		Ctx.Writer->IsWritingScalarArrayItem()
+	};
+
+	const TArray<FDcDeserializer::FPredicatedHandlerEntry>& Entries = Handlers.PredicatedDeserializers;
+	if (const FDcDeserializer::FResolutionEntry* CachedPtr = Cache.Find(Key))
+	{
+		//	copy out as `Cache` can be touched by nested deserialization
+		FDcDeserializer::FResolutionEntry Cached = *CachedPtr;
+		if (Stats)
+			Stats->Hits++;
+
+		//	impure predicates ordered before the cached decision still need to run
+		int32 EndIx = Cached.PredicateIx == INDEX_NONE ? Entries.Num() : Cached.PredicateIx;
+		for (int32 Ix = 0; Ix < EndIx; Ix++)
+		{
+			auto& PredEntry = Entries[Ix];
+			if (IsPure(PredEntry))
+				continue;
+
+			if (!PredEntry.Predicate.IsBound())
+				return DC_FAIL(DcDCommon, StaleDelegate);
+
+			if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
+				return ExecuteDeserializeHandler(Ctx, PredEntry.Handler);
+		}
+
+		return Cached.PredicateIx == INDEX_NONE
+			? ExecuteDeserializeHandler(Ctx, *Cached.DirectHandler)
+			: ExecuteDeserializeHandler(Ctx, Entries[Cached.PredicateIx].Handler);
+	}
+
+	if (Stats)
+		Stats->Misses++;
+	for (int32 Ix = 0; Ix < Entries.Num(); Ix++)
+	{
+		auto& PredEntry = Entries[Ix];
+		if (!PredEntry.Predicate.IsBound())
+			return DC_FAIL(DcDCommon, StaleDelegate);
+
+		if (PredEntry.Predicate.Execute(Ctx) == EDcDeserializePredicateResult::Process)
+		{
+			//	decisions of impure predicates aren't cached as pure ones after it are unknown
+			if (IsPure(PredEntry))
+				Cache.Add(Key, {Ix, nullptr});
+
+			return ExecuteDeserializeHandler(Ctx, PredEntry.Handler);
+		}
+	}
+
+	const FDcDeserializeDelegate* HandlerPtr = nullptr;
+	DC_TRY(ResolveDirectHandler(Handlers, Ctx, HandlerPtr));
+	Cache.Add(Key, {INDEX_NONE, HandlerPtr});
+
+	return ExecuteDeserializeHandler(Ctx, *HandlerPtr);
+}
+
+static FORCEINLINE FDcResult Resolve(FDcDeserializer* Self, FDcDeserializeContext& Ctx)
+{
+	if (Self->IsFrozen())
+	{
+		const FDcDeserializer::FFrozenHandlers& Frozen = *Self->Frozen;
+		checkf(Self->PredicatedDeserializers.Num() == 0
+			&& Self->UClassDeserializerMap.Num() == 0
+			&& Self->FieldClassDeserializerMap.Num() == 0
+			&& Self->StructDeserializeMap.Num() == 0
+			&& Self->bUseResolutionCache == Frozen.bUseResolutionCache,
+			TEXT("Frozen deserializer modified"));
+
+		FHandlers Handlers{
+			Frozen.PredicatedDeserializers,
+			Frozen.UClassDeserializerMap,
+			Frozen.FieldClassDeserializerMap,
+			Frozen.StructDeserializeMap,
+		};
+
+		return Frozen.bUseResolutionCache
+			? DeserializeBodyCached(Handlers, GetThreadResolutionCache(Self), nullptr, Ctx)
+			: DeserializeBody(Handlers, Ctx);
+	}
+
+	FHandlers Handlers{
+		Self->PredicatedDeserializers,
+		Self->UClassDeserializerMap,
+		Self->FieldClassDeserializerMap,
+		Self->StructDeserializeMap,
+	};
+
+	if (Self->bUseResolutionCache)
+	{
+		CheckResolutionCacheStale(Self);
+		return DeserializeBodyCached(Handlers, Self->ResolutionCache, &Self->ResolutionStats, Ctx);
+	}
+
+	return DeserializeBody(Handlers, Ctx);
+}
+
+static FString FormatContextStack(TArrayView<const FName> PropertyNames, TArrayView<UObject* const> Objects)
+{
 	TStringBuilder<1024> Sb;
 	{
 		Sb.Append(TEXT("\n### Properties:"));
-		int Num = Ctx.Properties.Num();
+		int Num = PropertyNames.Num();
 		if (Num)
 		{
 			Sb.Appendf(TEXT(" (%d) :"), Num);
-			for (FFieldVariant& Field : Ctx.Properties)
+			for (const FName& Name : PropertyNames)
 			{
 				Sb.Append(TEXT("\n  - "));
-				Sb.Append(Field.GetName());
+				Sb.Append(Name.ToString());
 			}
 		}
 		else
@@ -95,11 +262,11 @@ static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
 
 	{
 		Sb.Append(TEXT("\n### Objects:"));
-		int Num = Ctx.Objects.Num();
+		int Num = Objects.Num();
 		if (Num)
 		{
 			Sb.Appendf(TEXT(" (%d) :"), Num);
-			for (UObject* Obj : Ctx.Objects)
+			for (UObject* Obj : Objects)
 			{
 				Sb.Append(TEXT("\n  - "));
 				Sb.Append(DcDiagnosticUtils::SafeObjectName(Obj));
@@ -111,9 +278,40 @@ static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
 		}
 	}
 
-	Highlight.Formatted = Sb.ToString();
-	Diag << MoveTemp(Highlight);
+	return Sb.ToString();
+}
+
+static void AmendDiagnostic(FDcDiagnostic& Diag, FDcDeserializeContext& Ctx)
+{
+	if (Diag.Highlights.IndexOfByPredicate([&Ctx](auto& Highlight){
+		return Highlight.Owner == Ctx.Deserializer;}) != INDEX_NONE)
+		return;
+
+	FDcDiagnosticHighlight Highlight(Ctx.Deserializer, TEXT("DcSerializer"));
+
+	TArray<FName> PropertyNames;
+	PropertyNames.Reserve(Ctx.Properties.Num());
+	for (FFieldVariant& Field : Ctx.Properties)
+		PropertyNames.Add(Field.GetFName());
+
+	if (DcEnv().DiagMode == EDcDiagMode::Deferred)
+	{
+		//	objects can be collected before flush, hold them weakly
+		TArray<TWeakObjectPtr<UObject>> WeakObjects(Ctx.Objects);
+		Highlight.DeferredFormat = [PropertyNames = MoveTemp(PropertyNames), WeakObjects = MoveTemp(WeakObjects)](FDcDiagnosticHighlight& Self)
+		{
+			TArray<UObject*> Objects;
+			for (const TWeakObjectPtr<UObject>& Weak : WeakObjects)
+				Objects.Add(Weak.Get());
+			Self.Formatted = FormatContextStack(PropertyNames, Objects);
+		};
+	}
+	else
+	{
+		Highlight.Formatted = FormatContextStack(PropertyNames, Ctx.Objects);
+	}
 
+	Diag << MoveTemp(Highlight);
 }
 
 }	// namespace DcDeserializerDetails
@@ -123,6 +321,9 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 	auto _AmendDiag = [](FDcDeserializeContext& Ctx)
 	{
 		FDcDiagnostic& Diag = DcEnv().GetLastDiag();
+		if (Diag.bMuted)
+			return;
+
 		DcDiagnosticUtils::AmendDiagnostic(Diag, Ctx.Reader, Ctx.Writer);
 		DcDeserializerDetails::AmendDiagnostic(Diag, Ctx);
 	};
@@ -141,14 +342,14 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 			Ctx.State = ECtxState::DeserializeEnded;
 		};
 
-		FDcResult Result = DcDeserializerDetails::DeserializeBody(this, Ctx);
+		FDcResult Result = DcDeserializerDetails::Resolve(this, Ctx);
 		if (!Result.Ok()) _AmendDiag(Ctx);
 
 		return Result;
 	}
 	else if (Ctx.State == FDcDeserializeContext::EState::DeserializeInProgress)
 	{
-		FDcResult Result = DcDeserializerDetails::DeserializeBody(this, Ctx);
+		FDcResult Result = DcDeserializerDetails::Resolve(this, Ctx);
 		if (!Result.Ok()) _AmendDiag(Ctx);
 
 		return Result;
@@ -161,24 +362,67 @@ FDcResult FDcDeserializer::Deserialize(FDcDeserializeContext& Ctx)
 
 void FDcDeserializer::AddDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(PropertyClass && !UClassDeserializerMap.Contains(PropertyClass));
 	UClassDeserializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
 void FDcDeserializer::AddDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(PropertyClass && !FieldClassDeserializerMap.Contains(PropertyClass));
 	FieldClassDeserializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
-void FDcDeserializer::AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name)
+void FDcDeserializer::AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name, EDcDeserializePredicateFlag Flag)
 {
-	PredicatedDeserializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name});
+	check(!bFrozen);
+	ResetResolutionCache();
+	PredicatedDeserializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name, Flag});
 }
 
 void FDcDeserializer::AddStructHandler(UStruct* Struct, FDcDeserializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(Struct && !StructDeserializeMap.Contains(Struct));
 	StructDeserializeMap.Add(Struct, Delegate);
 }
 
+void FDcDeserializer::InsertPredicatedHandler(int32 Index, FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name, EDcDeserializePredicateFlag Flag)
+{
+	check(!bFrozen);
+	ResetResolutionCache();
+	PredicatedDeserializers.Insert(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name, Flag}, Index);
+}
+
+void FDcDeserializer::ResetResolutionCache()
+{
+	static FThreadSafeCounter NextGeneration;
+
+	ResolutionCache.Reset();
+	ResolutionGeneration.Set(NextGeneration.Increment());
+}
+
+void FDcDeserializer::Freeze()
+{
+	check(!bFrozen);
+
+	FFrozenHandlers* Handlers = new FFrozenHandlers();
+	Handlers->PredicatedDeserializers = MoveTemp(PredicatedDeserializers);
+	Handlers->UClassDeserializerMap = MoveTemp(UClassDeserializerMap);
+	Handlers->FieldClassDeserializerMap = MoveTemp(FieldClassDeserializerMap);
+	Handlers->StructDeserializeMap = MoveTemp(StructDeserializeMap);
+	Handlers->bUseResolutionCache = bUseResolutionCache;
+
+	PredicatedDeserializers.Empty();
+	UClassDeserializerMap.Empty();
+	FieldClassDeserializerMap.Empty();
+	StructDeserializeMap.Empty();
+
+	Frozen.Reset(Handlers);
+	ResetResolutionCache();
+	bFrozen = true;
+}
@@ -25,13 +25,15 @@ void DcSetupJsonDeserializeHandlers(FDcDeserializer& Deserializer, EDcJsonDeseri
 		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(PredicateIsScalarArrayProperty),
 			FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcDeserializePredicateFlag::Pure
 		);
 
 		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(PredicateIsEnumProperty),
 			FDcDeserializeDelegate::CreateStatic(HandlerStringToEnumDeserialize),
-			FName(TEXT("Enum"))
+			FName(TEXT("Enum")),
+			EDcDeserializePredicateFlag::Pure
 		);
 
 		Deserializer.AddPredicatedHandler(
@@ -100,7 +102,8 @@ void DcSetupPropertyPipeDeserializeHandlers(FDcDeserializer& Deserializer)
 		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(DcCommonHandlers::PredicateIsScalarArrayProperty),
 			FDcDeserializeDelegate::CreateStatic(DcCommonHandlers::HandlerArrayDeserialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcDeserializePredicateFlag::Pure
 		);
 	}
 
@@ -138,7 +141,8 @@ void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPack
 		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(PredicateIsScalarArrayProperty),
 			FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcDeserializePredicateFlag::Pure
 		);
 	}
 
@@ -167,7 +171,8 @@ void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPack
 	Deserializer.AddPredicatedHandler(
 		FDcDeserializePredicate::CreateStatic(DcMsgPackHandlers::PredicateIsBlobProperty),
 		FDcDeserializeDelegate::CreateStatic(DcMsgPackHandlers::HandlerBlobDeserialize),
-		FName(TEXT("Blob"))
+		FName(TEXT("Blob")),
+		EDcDeserializePredicateFlag::Pure
 	);
 
 	if (Type == EDcMsgPackDeserializeType::Default
@@ -182,7 +187,8 @@ void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deserializer, EDcMsgPack
 		Deserializer.AddPredicatedHandler(
 			FDcDeserializePredicate::CreateStatic(PredicateIsEnumProperty),
 			FDcDeserializeDelegate::CreateStatic(HandlerStringToEnumDeserialize),
-			FName(TEXT("Enum"))
+			FName(TEXT("Enum")),
+			EDcDeserializePredicateFlag::Pure
 		);
 
 		Deserializer.AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeNameDeserialize));
@@ -333,3 +339,49 @@ void DcSetupCoreTypesDeserializeHandlers(FDcDeserializer& Deserializer)
 #endif // ENGINE_MAJOR_VERSION == 5
 
 }
+
+namespace DcDeserializerSetupDetails
+{
+
+template<typename TSetup>
+static TUniquePtr<FDcDeserializer> MakeFrozen(TSetup&& Setup)
+{
+	TUniquePtr<FDcDeserializer> Ret = MakeUnique<FDcDeserializer>();
+	Setup(*Ret);
+	Ret->Freeze();
+	return Ret;
+}
+
+} // namespace DcDeserializerSetupDetails
+
+FDcDeserializer& DcGetDefaultJsonDeserializer(EDcJsonDeserializeType Type)
+{
+	using namespace DcDeserializerSetupDetails;
+	static TUniquePtr<FDcDeserializer> _DEFAULTS[] = {
+		MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupJsonDeserializeHandlers(Deserializer, EDcJsonDeserializeType::Default); }),
+		MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupJsonDeserializeHandlers(Deserializer, EDcJsonDeserializeType::StringSoftLazy); }),
+	};
+
+	return *_DEFAULTS[(int)Type];
+}
+
+FDcDeserializer& DcGetDefaultPropertyPipeDeserializer()
+{
+	using namespace DcDeserializerSetupDetails;
+	static TUniquePtr<FDcDeserializer> _DEFAULT = MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupPropertyPipeDeserializeHandlers(Deserializer); });
+
+	return *_DEFAULT;
+}
+
+FDcDeserializer& DcGetDefaultMsgPackDeserializer(EDcMsgPackDeserializeType Type)
+{
+	using namespace DcDeserializerSetupDetails;
+	static TUniquePtr<FDcDeserializer> _DEFAULTS[] = {
+		MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupMsgPackDeserializeHandlers(Deserializer, EDcMsgPackDeserializeType::Default); }),
+		MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupMsgPackDeserializeHandlers(Deserializer, EDcMsgPackDeserializeType::StringSoftLazy); }),
+		MakeFrozen([](FDcDeserializer& Deserializer){ DcSetupMsgPackDeserializeHandlers(Deserializer, EDcMsgPackDeserializeType::InMemory); }),
+	};
+
+	return *_DEFAULTS[(int)Type];
+}
+
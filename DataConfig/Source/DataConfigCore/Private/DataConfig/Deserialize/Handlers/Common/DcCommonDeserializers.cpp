@@ -5,6 +5,7 @@
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
 #include "DataConfig/SerDe/DcSerDeCommon.inl"
 #include "DataConfig/SerDe/DcSerDeUtils.inl"
+#include "DataConfig/SerDe/DcEnumTable.h"
 
 namespace DcCommonHandlers {
 
@@ -67,6 +68,17 @@ EDcDeserializePredicateResult PredicateIsEnumProperty(FDcDeserializeContext& Ctx
 		: EDcDeserializePredicateResult::Pass;
 }
 
+static FDcResult ReadEnumValueByName(FDcDeserializeContext& Ctx, const FDcEnumTable& Table, int64& OutValue)
+{
+	FDcStringViewData Value;
+	DC_TRY(Ctx.Reader->ReadStringView(&Value));
+
+	if (!Table.FindValueByName(Value, OutValue))
+		return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Table.Enum->GetFName() << Value.ToString();
+
+	return DcOk();
+}
+
 FDcResult HandlerStringToEnumDeserialize(FDcDeserializeContext& Ctx)
 {
 	FFieldVariant& TopProperty = Ctx.TopProperty();
@@ -89,33 +101,12 @@ FDcResult HandlerStringToEnumDeserialize(FDcDeserializeContext& Ctx)
 		return DcOk();
 	}
 
-	bool bIsBitFlags;
-
-#if WITH_EDITORONLY_DATA
-
-	#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-	#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-	#endif
-
-#else // WITH_EDITORONLY_DATA
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
+	TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Table = FDcEnumTable::Get(Enum);
 
-
-	if (!bIsBitFlags)
+	if (!Table->bIsBitFlags)
 	{
-		FString Value;
-		DC_TRY(Ctx.Reader->ReadString(&Value));
-
-		FName ValueName(Enum->GenerateFullEnumName(*Value));
-		if (!Enum->IsValidEnumName(ValueName))
-			return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
-
 		FDcEnumData EnumData;
-		EnumData.Signed64 = Enum->GetValueByName(ValueName);
+		DC_TRY(ReadEnumValueByName(Ctx, *Table, EnumData.Signed64));
 
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
 		return DcOk();
@@ -133,14 +124,9 @@ FDcResult HandlerStringToEnumDeserialize(FDcDeserializeContext& Ctx)
 			if (Next == EDcDataEntry::ArrayEnd)
 				break;
 
-			FString Value;
-			DC_TRY(Ctx.Reader->ReadString(&Value));
-
-			FName ValueName(Enum->GenerateFullEnumName(*Value));
-			if (!Enum->IsValidEnumName(ValueName))
-				return DC_FAIL(DcDReadWrite, EnumNameNotFound) << Enum->GetFName() << Value;
-
-			EnumData.Signed64 |= Enum->GetValueByName(ValueName);
+			int64 Value;
+			DC_TRY(ReadEnumValueByName(Ctx, *Table, Value));
+			EnumData.Signed64 |= Value;
 		}
 		DC_TRY(Ctx.Reader->ReadArrayEnd());
 		DC_TRY(Ctx.Writer->WriteEnum(EnumData));
@@ -176,9 +162,7 @@ FDcResult HandlerMapToStructDeserialize(FDcDeserializeContext& Ctx)
 
 		FName FieldName;
 		DC_TRY(Ctx.Reader->ReadName(&FieldName));
-		DC_TRY(Ctx.Writer->WriteName(FieldName));
-
-		DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
+		DC_TRY(DcDeserializeUtils::RecursiveDeserializeField(Ctx, FieldName));
 	}
 
 	DC_TRY(Ctx.Reader->ReadMapEnd());
@@ -203,17 +187,17 @@ FDcResult HandlerMapToClassDeserialize(FDcDeserializeContext& Ctx)
 		}
 		else if (CurPeek == EDcDataEntry::String)
 		{
-			FString Value;
-			DC_TRY(Ctx.Reader->ReadString(&Value));
+			FDcStringViewData Value;
+			DC_TRY(Ctx.Reader->ReadStringView(&Value));
 			if (DcSerDeUtils::IsMeta(Value))
 			{
 				//	skip next object
-				DC_TRY(DcSerDeUtils::ReadNoopConsumeValue(Ctx.Reader));
+				DC_TRY(Ctx.Reader->SkipValue());
 				continue;
 			}
 			else
 			{
-				DC_TRY(Ctx.Writer->WriteName(FName(*Value)));
+				DC_TRY(DcDeserializeUtils::RecursiveDeserializeField(Ctx, Value.ToName()));
 			}
 		}
 		else
@@ -221,8 +205,6 @@ FDcResult HandlerMapToClassDeserialize(FDcDeserializeContext& Ctx)
 			return DC_FAIL(DcDSerDe, DataEntryMismatch2)
 				<< EDcDataEntry::Name << EDcDataEntry::String << CurPeek;
 		}
-
-		DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 	}
 
 	DC_TRY(Ctx.Reader->ReadMapEnd());
@@ -278,6 +260,8 @@ FDcResult HandlerMapOrArrayOfKeyValueDeserialize(FDcDeserializeContext& Ctx)
 	{
 		DC_TRY(Ctx.Reader->ReadArrayRoot());
 		DC_TRY(Ctx.Writer->WriteMapRoot());
+		//	each `{"$key":..., "$value":...}` item is a pair
+		DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 		EDcDataEntry Cur;
 		while (true)
@@ -291,14 +275,14 @@ FDcResult HandlerMapOrArrayOfKeyValueDeserialize(FDcDeserializeContext& Ctx)
 			//		"$value" : <arbitrary value>
 			//	}
 
-			FString MetaKey;
+			FDcStringViewData MetaKey;
 			DC_TRY(Ctx.Reader->ReadMapRoot());
-			DC_TRY(Ctx.Reader->ReadString(&MetaKey));
+			DC_TRY(Ctx.Reader->ReadStringView(&MetaKey));
 			DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$key")));
 
 			DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
 
-			DC_TRY(Ctx.Reader->ReadString(&MetaKey));
+			DC_TRY(Ctx.Reader->ReadStringView(&MetaKey));
 			DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$value")));
 
 			DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
@@ -38,7 +38,8 @@ FDcResult HandlerStructDeserialize(FDcDeserializeContext& Ctx)
 		FDcDeserializeContext,
 		FDcReader,
 		FDcPropertyWriter,
-		&DcDeserializeUtils::RecursiveDeserialize
+		&DcDeserializeUtils::RecursiveDeserialize,
+		&DcDeserializeUtils::RecursiveDeserializeField
 	>(Ctx);
 }
 
@@ -48,7 +49,8 @@ FDcResult HandlerClassDeserialize(FDcDeserializeContext& Ctx)
 		FDcDeserializeContext,
 		FDcReader,
 		FDcPropertyWriter,
-		&DcDeserializeUtils::RecursiveDeserialize
+		&DcDeserializeUtils::RecursiveDeserialize,
+		&DcDeserializeUtils::RecursiveDeserializeField
 	>(Ctx);
 }
 
@@ -121,8 +121,49 @@ FStringFormatArg DcConvertArg(FDcDataVariant& Var)
 	}
 }
 
+void FDcDiagnostic::FormatDeferred()
+{
+	using EKind = FDcDiagnosticDeferredArg::EKind;
+	for (FDcDiagnosticDeferredArg& Deferred : DeferredArgs)
+	{
+		FDcDataVariant& Arg = Args[Deferred.Index];
+		if (Deferred.Kind == EKind::EscapeString)
+		{
+			Arg = Deferred.Str.ReplaceCharWithEscapedChar();
+		}
+		else if (Deferred.Kind == EKind::DataEntryName)
+		{
+			UEnum* DataEntryEnum = StaticEnum<EDcDataEntry>();
+			check(DataEntryEnum);
+			Arg = DataEntryEnum->GetNameByIndex((int32)Deferred.Entry);
+		}
+		else if (Deferred.Kind == EKind::FieldFullName)
+		{
+			Arg = Deferred.FieldOwner.IsValid()
+				? Deferred.Field.GetFullName()
+				: DcPropertyUtils::SafeNameToString(Deferred.FieldName);
+		}
+		else
+		{
+			checkNoEntry();
+		}
+	}
+	DeferredArgs.Empty();
+
+	for (FDcDiagnosticHighlight& Highlight : Highlights)
+	{
+		if (!Highlight.DeferredFormat)
+			continue;
+
+		Highlight.DeferredFormat(Highlight);
+		Highlight.DeferredFormat = nullptr;
+	}
+}
+
 void DcFormatDiagnostic(FOutputDevice& Output, FDcDiagnostic& Diag)
 {
+	Diag.FormatDeferred();
+
 	const FDcDiagnosticDetail* Detail = DcFindDiagnosticDetail(Diag.Code);
 	if (Detail)
 	{
@@ -15,6 +15,9 @@ static FDcDiagnosticDetail _CommonDetails[] = {
 	{ StaleDelegateWithName, TEXT("Stale delegate: {0}") },
 
 	{ CustomMessage, TEXT("Custom Diagnostic Message: {0}") },
+
+	{ FileMapFailed, TEXT("Failed to map file: '{0}'") },
+	{ FileTooLarge, TEXT("File too large: '{0}', size '{1}'") },
 };
 
 FDcDiagnosticGroup Details = {
@@ -23,6 +23,7 @@ static FDcDiagnosticDetail _JSONDetails[] = {
 	{ ExpectStateInProgress, TEXT("Expect internal state to be 'InProgress', Actual: {0}"), },
 	{ ExpectStateUninitializedOrFinished, TEXT("Expect internal state to be 'Uninitialized' or 'Finished', Actual: {0}"), },
 	{ UnexpectedTrailingToken, TEXT("Expect ending but found trailing tokens, Actual: {0}"), },
+	{ InvalidUtf8, TEXT("Invalid UTF8 sequence in string"), },
 
 	//	Number
 	{ NumberInvalidChar, TEXT("Invalid char in number: '{0}'"), },
@@ -19,6 +19,7 @@ static FDcDiagnosticDetail _MsgPackDetails[] = {
 	{ SizeOverInt32Max, TEXT("Size over int32::max isn't supported yet."), },
 	{ ArrayRemains, TEXT("Array ins't fully consumed on end, remains: {0}"), },
 	{ MapRemains, TEXT("Map ins't fully consumed on end, remains: {0}"), },
+	{ InvalidUtf8, TEXT("Invalid UTF8 string at index: {0}"), },
 
 };
 
@@ -44,6 +44,11 @@ static FDcDiagnosticDetail _ReadWriteDetails[] = {
 	{ PipeReadWriteMismatch, TEXT("Pipe visit read write mismatch. Reader peeks '{0}' but writer rejects it.") },
 	//	skip
 	{ SkipOutOfRange, TEXT("Skipping out of range, Container actual length : {0}") },
+	//	tape reader
+	{ TapeUnsupportedDataEntry, TEXT("Tape can't store data entry '{0}'") },
+	{ TapeNumberOutOfRange, TEXT("Number can't be read as '{0}', Actual: '{1}'") },
+	//	sink
+	{ SinkWriteFailed, TEXT("Failed writing '{0}' bytes to sink") },
 };
 
 FDcDiagnosticGroup Details = {
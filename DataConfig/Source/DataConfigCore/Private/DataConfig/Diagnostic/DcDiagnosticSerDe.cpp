@@ -57,6 +57,9 @@ struct FDcDiagnosticDetail _DeserializeDetails[] = {
 	{ DateTimeParseFail, TEXT("DateTime parse failed: '{0}") },
 	{ TimespanParseFail, TEXT("Timespan parse failed: '{0}") },
 
+	//	References
+	{ PackageAsyncLoadFailed, TEXT("Async load package failed, Package: '{0}', Result: '{1}'") },
+
 };
 
 FDcDiagnosticGroup Details = {
@@ -43,6 +43,9 @@ namespace DcDiagnosticUtils
 
 void AmendDiagnostic(FDcDiagnostic& Diag, FDcReader* Reader, FDcWriter* Writer)
 {
+	if (Diag.bMuted)
+		return;
+
 	bool bHasReaderDiag = false;
 	bool bHasWriterDiag = false;
 	for (FDcDiagnosticHighlight& Highlight : Diag.Highlights)
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Math/NumericLimits.h"
+#include "Templates/IsSigned.h"
+
+///	Number parsing on already delimited JSON number tokens.
+///	Token grammar is validated by `TDcJsonReader::ReadNumberToken` so these don't check for it again.
+///	Formatting functions write into `Buf` of at least `FormatBufferSize` chars without terminator
+///	and return chars written.
+namespace DcJsonNumber
+{
+
+///	Parse a run of decimal digits into its magnitude.
+///	Returns false on empty input, non digit char or uint64 overflow.
+template<typename CharType>
+bool ParseIntegerMagnitude(const CharType* Ptr, int32 Num, uint64& OutMagnitude);
+
+///	Parse a number token with Eisel-Lemire, exact for up to 19 significant digits.
+///	Returns false when the result can't be decided and caller should fallback.
+template<typename CharType>
+bool TryParseDouble(const CharType* Ptr, int32 Num, double& OutValue);
+
+static constexpr int32 FormatBufferSize = 32;
+
+///	Format shortest digits that round trip with Schubfach, laid out like JavaScript `Number.toString`.
+///	Expects finite value, caller should check for NaN and Inf.
+template<typename CharType>
+int32 FormatDouble(double Value, CharType* Buf);
+
+template<typename CharType>
+int32 FormatFloat(float Value, CharType* Buf);
+
+template<typename CharType>
+int32 FormatInt64(int64 Value, CharType* Buf);
+
+template<typename CharType>
+int32 FormatUInt64(uint64 Value, CharType* Buf);
+
+template<typename TInt>
+FORCEINLINE bool MagnitudeToInteger(uint64 Magnitude, bool bNegative, TInt& OutValue)
+{
+	if (!TIsSigned<TInt>::Value)
+	{
+		if (bNegative && Magnitude != 0)
+			return false;
+		if (Magnitude > (uint64)TNumericLimits<TInt>::Max())
+			return false;
+
+		OutValue = (TInt)Magnitude;
+		return true;
+	}
+	else
+	{
+		uint64 Limit = (uint64)TNumericLimits<TInt>::Max() + (bNegative ? 1 : 0);
+		if (Magnitude > Limit)
+			return false;
+
+		OutValue = bNegative
+			? (TInt)(0 - Magnitude)
+			: (TInt)Magnitude;
+		return true;
+	}
+}
+
+} // namespace DcJsonNumber
+
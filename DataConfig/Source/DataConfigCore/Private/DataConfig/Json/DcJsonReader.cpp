@@ -5,28 +5,50 @@
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Source/DcHighlightFormatter.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
+#include "DataConfig/Json/DcJsonScanDetails.h"
+#include "DataConfig/Json/DcJsonNumber.h"
+#include "DataConfig/Misc/DcUtf8.h"
 
 namespace DcJsonReaderDetails
 {
 
-template<typename CharType>
-struct TNumericDispatch
+FORCEINLINE FDcStringViewData MakeBorrowedStringView(const ANSICHAR* Ptr, int32 Num)
 {
-	using CString = TCString<CharType>;
+	//	caller ensures there's only ascii chars
+	return FDcStringViewData::FromAscii(Ptr, Num);
+}
 
-	static FORCEINLINE void ParseIntDispatch(int8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(int64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoi64(Ptr, OutEnd, 10); }
+FORCEINLINE FDcStringViewData MakeBorrowedStringView(const WIDECHAR* Ptr, int32 Num)
+{
+	static_assert(sizeof(WIDECHAR) == sizeof(TCHAR), "expect WIDECHAR to be TCHAR");
+	return FDcStringViewData::FromTchar((const TCHAR*)Ptr, Num);
+}
 
-	static FORCEINLINE void ParseIntDispatch(uint8& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint16& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint32& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
-	static FORCEINLINE void ParseIntDispatch(uint64& OutValue, CharType** OutEnd, const CharType* Ptr) { OutValue = CString::Strtoui64(Ptr, OutEnd, 10); }
+FORCEINLINE uint32 HashStringView(const FDcStringViewData& View)
+{
+	switch (View.Type)
+	{
+		case FDcStringViewData::EType::Tchar: return DcJsonKeySet::HashChars(View.GetTcharPtr(), View.Num);
+		case FDcStringViewData::EType::Ascii: return DcJsonKeySet::HashChars(View.GetAsciiPtr(), View.Num);
+		case FDcStringViewData::EType::Utf8: return DcJsonKeySet::HashUtf8Chars(View.GetUtf8Ptr(), View.Num);
+		default: return DcJsonKeySet::HashChars(*View.Owned, View.Owned.Len());
+	}
+}
 
-	static FORCEINLINE void ParseFloatDispatch(float& OutValue, const CharType* Ptr) { OutValue = CString::Atof(Ptr); }
-	static FORCEINLINE void ParseFloatDispatch(double& OutValue, const CharType* Ptr) { OutValue = CString::Atod(Ptr); }
+template<typename CharType>
+struct TNumericDispatch
+{
+	using CString = TCString<CharType>;
 
+	//	fallback for the few cases that `DcJsonNumber::TryParseDouble` can't decide.
+	//	source isn't terminated, mapped files end at the mapping and streams leave stale bytes after the token
+	static double ParseDoubleFallback(const CharType* Ptr, int32 Num)
+	{
+		TArray<CharType, TInlineAllocator<64>> Terminated;
+		Terminated.Append(Ptr, Num);
+		Terminated.Add(CharType(0));
+		return CString::Atod(Terminated.GetData());
+	}
 };
 
 template<typename CharType>
@@ -34,6 +56,28 @@ struct TJsonReaderClassIdSelector;
 template<> struct TJsonReaderClassIdSelector<ANSICHAR> { static constexpr const TCHAR* Id = TEXT("AnsiCharDcJsonReader"); };
 template<> struct TJsonReaderClassIdSelector<WIDECHAR> { static constexpr const TCHAR* Id = TEXT("WideCharDcJsonReader"); };
 
+//	block scanning only applies to UTF8 input, wide char reader falls through to the per char loop
+template<typename CharType>
+struct TScanDispatch
+{
+	static FORCEINLINE int32 ScanStringRun(const CharType* Ptr, int32 Num, bool& bOutNonAscii) { return 0; }
+	static FORCEINLINE void ScanWhitespaceRun(const CharType* Ptr, int32 Num, DcJsonScanDetails::FWhitespaceRun& OutRun) {}
+};
+
+template<>
+struct TScanDispatch<ANSICHAR>
+{
+	static FORCEINLINE int32 ScanStringRun(const ANSICHAR* Ptr, int32 Num, bool& bOutNonAscii)
+	{
+		return DcJsonScanDetails::ScanStringRun((const uint8*)Ptr, Num, bOutNonAscii);
+	}
+
+	static FORCEINLINE void ScanWhitespaceRun(const ANSICHAR* Ptr, int32 Num, DcJsonScanDetails::FWhitespaceRun& OutRun)
+	{
+		DcJsonScanDetails::ScanWhitespaceRun((const uint8*)Ptr, Num, OutRun);
+	}
+};
+
 } // namespace DcJsonReaderDetails
 
 
@@ -168,12 +212,14 @@ static FDcResult ParseInteger(TSelf* Self, TInt* OutPtr)
 	int IntOffset = Self->Token.Flag.bNumberHasDecimal
 		? Self->Token.Flag.NumberDecimalOffset
 		: Self->Token.Ref.Num;
+	int SignOffset = Self->Token.Flag.bNumberIsNegative ? 1 : 0;
 	const CharType* BeginPtr = Self->Token.Ref.GetBeginPtr();
-	CharType* EndPtr = nullptr;
 
+	//	fractional part is ignored, exponent and out of range values are rejected
+	uint64 Magnitude;
 	TInt Value;
-	DcJsonReaderDetails::TNumericDispatch<CharType>::ParseIntDispatch(Value, &EndPtr, BeginPtr);
-	if (EndPtr - BeginPtr != IntOffset)
+	if (!DcJsonNumber::ParseIntegerMagnitude(BeginPtr + SignOffset, IntOffset - SignOffset, Magnitude)
+		|| !DcJsonNumber::MagnitudeToInteger(Magnitude, (bool)Self->Token.Flag.bNumberIsNegative, Value))
 		return DC_FAIL(DcDJSON, ParseIntegerFailed) << Self->FormatHighlight(Self->Token.Ref);
 
 	ReadOut(OutPtr, Value);
@@ -229,10 +275,11 @@ static FDcResult ReadFloating(TSelf* Self, TFloat* OutPtr)
 	{
 		DC_TRY(Self->CheckNotObjectKey());
 
-		TFloat Value;
-		DcJsonReaderDetails::TNumericDispatch<CharType>::ParseFloatDispatch(Value, Self->Token.Ref.GetBeginPtr());
+		double Value;
+		if (!DcJsonNumber::TryParseDouble(Self->Token.Ref.GetBeginPtr(), Self->Token.Ref.Num, Value))
+			Value = DcJsonReaderDetails::TNumericDispatch<CharType>::ParseDoubleFallback(Self->Token.Ref.GetBeginPtr(), Self->Token.Ref.Num);
 
-		ReadOut(OutPtr, Value);
+		ReadOut(OutPtr, (TFloat)Value);
 		DC_TRY(Self->EndTopRead());
 		return DcOk();
 	}
@@ -244,6 +291,217 @@ static FDcResult ReadFloating(TSelf* Self, TFloat* OutPtr)
 	}
 }
 
+static FORCEINLINE void SkipStringRun(TSelf* Self)
+{
+	bool bHasNonAscii = false;
+	int32 Run = DcJsonReaderDetails::TScanDispatch<CharType>::ScanStringRun(
+		Self->Buf.Buffer + Self->Cur, Self->Buf.Num - Self->Cur, bHasNonAscii);
+
+	if (Run > 0)
+	{
+		Self->AdvanceN(Run);
+		if (bHasNonAscii)
+			Self->Token.Flag.bStringHasNonAscii = true;
+	}
+}
+
+static FORCEINLINE void SkipWhitespaceRun(TSelf* Self)
+{
+	DcJsonScanDetails::FWhitespaceRun Run;
+	DcJsonReaderDetails::TScanDispatch<CharType>::ScanWhitespaceRun(
+		Self->Buf.Buffer + Self->Cur, Self->Buf.Num - Self->Cur, Run);
+
+	if (Run.Num == 0)
+		return;
+
+	Self->Cur += Run.Num;
+	if (Run.NewLineCount > 0)
+	{
+		//	matches `NewLine()` then `Advance()` on each line break
+		Self->Loc.Line += Run.NewLineCount;
+		Self->Loc.Column = Run.Num - Run.LastNewLineIx;
+	}
+	else
+	{
+		Self->Loc.Column += Run.Num;
+	}
+}
+
+//	scan ahead from `Cur` and count items of the container just opened without touching reader states.
+//	it only tracks brackets, strings and comments, malformed input is left for the actual read to report.
+static int32 CountContainerItems(TSelf* Self)
+{
+	const CharType* Ptr = Self->Buf.Buffer;
+	int32 Num = Self->Buf.Num;
+	int32 Ix = Self->Cur;
+
+	int32 Depth = 0;
+	int32 Count = 0;
+	bool bPendingItem = false;
+	while (Ix < Num)
+	{
+		CharType Ch = Ptr[Ix];
+		if (Ch == '"')
+		{
+			Ix++;
+			while (true)
+			{
+				if (Ix >= Num)
+					return INDEX_NONE;
+
+				bool bHasNonAscii = false;
+				Ix += DcJsonReaderDetails::TScanDispatch<CharType>::ScanStringRun(Ptr + Ix, Num - Ix, bHasNonAscii);
+				if (Ix >= Num)
+					return INDEX_NONE;
+
+				CharType StrCh = Ptr[Ix];
+				if (StrCh == '"')
+				{
+					Ix++;
+					break;
+				}
+
+				Ix += StrCh == '\\' ? 2 : 1;
+			}
+
+			bPendingItem = true;
+			continue;
+		}
+		else if (Ch == '/' && Ix + 1 < Num && Ptr[Ix + 1] == '/')
+		{
+			while (Ix < Num && Ptr[Ix] != '\n')
+				Ix++;
+			continue;
+		}
+		else if (Ch == '/' && Ix + 1 < Num && Ptr[Ix + 1] == '*')
+		{
+			Ix += 2;
+			while (Ix + 1 < Num && !(Ptr[Ix] == '*' && Ptr[Ix + 1] == '/'))
+				Ix++;
+			if (Ix + 1 >= Num)
+				return INDEX_NONE;
+
+			Ix += 2;
+			continue;
+		}
+		else if (Ch == '[' || Ch == '{')
+		{
+			Depth++;
+			bPendingItem = true;
+		}
+		else if (Ch == ']' || Ch == '}')
+		{
+			if (Depth == 0)
+				return bPendingItem ? Count + 1 : Count;
+
+			Depth--;
+		}
+		else if (Ch == ',')
+		{
+			//	skip trailing comma
+			if (Depth == 0 && bPendingItem)
+			{
+				Count++;
+				bPendingItem = false;
+			}
+		}
+		else if (Ch != ' ' && Ch != '\t' && Ch != '\r' && Ch != '\n')
+		{
+			bPendingItem = true;
+		}
+
+		Ix++;
+	}
+
+	return INDEX_NONE;
+}
+
+//	scan ahead from `Cur` to the bracket closing the container just opened, tracking strings and comments
+//	like `CountContainerItems`. content in between isn't validated. gives `INDEX_NONE` when unclosed.
+static int32 FindContainerClose(TSelf* Self, int32& OutNewLineCount, int32& OutLastNewLineIx)
+{
+	const CharType* Ptr = Self->Buf.Buffer;
+	int32 Num = Self->Buf.Num;
+	int32 Ix = Self->Cur;
+
+	int32 Depth = 0;
+	OutNewLineCount = 0;
+	OutLastNewLineIx = INDEX_NONE;
+	while (Ix < Num)
+	{
+		CharType Ch = Ptr[Ix];
+		if (Ch == '"')
+		{
+			Ix++;
+			while (true)
+			{
+				if (Ix >= Num)
+					return INDEX_NONE;
+
+				bool bHasNonAscii = false;
+				Ix += DcJsonReaderDetails::TScanDispatch<CharType>::ScanStringRun(Ptr + Ix, Num - Ix, bHasNonAscii);
+				if (Ix >= Num)
+					return INDEX_NONE;
+
+				CharType StrCh = Ptr[Ix];
+				if (StrCh == '"')
+				{
+					Ix++;
+					break;
+				}
+
+				Ix += StrCh == '\\' ? 2 : 1;
+			}
+
+			continue;
+		}
+		else if (Ch == '/' && Ix + 1 < Num && Ptr[Ix + 1] == '/')
+		{
+			while (Ix < Num && Ptr[Ix] != '\n')
+				Ix++;
+			continue;
+		}
+		else if (Ch == '/' && Ix + 1 < Num && Ptr[Ix + 1] == '*')
+		{
+			Ix += 2;
+			while (Ix + 1 < Num && !(Ptr[Ix] == '*' && Ptr[Ix + 1] == '/'))
+			{
+				if (Ptr[Ix] == '\n')
+				{
+					OutNewLineCount++;
+					OutLastNewLineIx = Ix;
+				}
+				Ix++;
+			}
+			if (Ix + 1 >= Num)
+				return INDEX_NONE;
+
+			Ix += 2;
+			continue;
+		}
+		else if (Ch == '[' || Ch == '{')
+		{
+			Depth++;
+		}
+		else if (Ch == ']' || Ch == '}')
+		{
+			if (Depth == 0)
+				return Ix;
+
+			Depth--;
+		}
+		else if (Ch == '\n')
+		{
+			OutNewLineCount++;
+			OutLastNewLineIx = Ix;
+		}
+
+		Ix++;
+	}
+
+	return INDEX_NONE;
+}
+
 static void Reset(TSelf* Self, const CharType* InStrPtr, int32 Num)
 {
 	Self->Buf = typename TSelf::SourceView(InStrPtr, Num);
@@ -255,6 +513,11 @@ static void Reset(TSelf* Self, const CharType* InStrPtr, int32 Num)
 	Self->CachedNext.Reset();
 	Self->DiagFilePath.Empty();
 
+	Self->Stream = nullptr;
+	Self->StreamBuf.Empty();
+	Self->StreamNum = 0;
+	Self->bStreamEnded = false;
+
 	Self->State = TSelf::EState::InProgress;
 	Self->bTopObjectAtValue = false;
 	Self->bNeedConsumeToken = true;
@@ -347,9 +610,80 @@ FDcResult TDcJsonReader<CharType>::SetNewString(const CharType* InStrPtr, int32
 	return DcOk();
 }
 
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::SetNewStream(FDcSourceStream* InStream, int32 InChunkSize)
+{
+	check(InStream != nullptr && InChunkSize > 0);
+	if (State == EState::InProgress)
+		DC_TRY(FinishRead());
+
+	if (State != EState::Uninitialized
+		&& State != EState::FinishedStr)
+		return DC_FAIL(DcDJSON, ExpectStateUninitializedOrFinished) << State;
+
+	FDcJsonReaderDetails<CharType>::Reset(this, nullptr, 0);
+	Stream = InStream;
+	StreamChunkSize = Align(InChunkSize, (int32)sizeof(CharType));
+	return DcOk();
+}
+
+template<typename CharType>
+bool TDcJsonReader<CharType>::FillStream(int32 MinNum)
+{
+	while (Buf.Num < MinNum && !bStreamEnded)
+	{
+		if (StreamBuf.Num() - StreamNum < StreamChunkSize)
+			StreamBuf.SetNumUninitialized(StreamNum + StreamChunkSize);
+
+		int64 ReadNum = Stream->Read(StreamBuf.GetData() + StreamNum, StreamChunkSize);
+		if (ReadNum <= 0)
+			bStreamEnded = true;
+		else
+			StreamNum += (int32)ReadNum;
+
+		//	refs are offsets into `Buf` so they stay valid when the storage moves
+		Buf = SourceView((const CharType*)StreamBuf.GetData(), StreamNum / (int32)sizeof(CharType));
+	}
+
+	return Buf.Num >= MinNum;
+}
+
+template<typename CharType>
+void TDcJsonReader<CharType>::CompactStream()
+{
+	//	drop consumed chars that no live token refers to, only called before a read
+	//	so there're no token copies on the stack
+	bool bTokenValid = Token.Ref.IsValid();
+	bool bCachedNextValid = CachedNext.Ref.IsValid();
+
+	int32 KeepBegin = Cur;
+	if (bTokenValid)
+		KeepBegin = FMath::Min(KeepBegin, Token.Ref.Begin);
+	if (bCachedNextValid)
+		KeepBegin = FMath::Min(KeepBegin, CachedNext.Ref.Begin);
+
+	int32 Drop = KeepBegin - StreamRetainNum;
+	if (Drop * (int32)sizeof(CharType) < StreamChunkSize)
+		return;
+
+	int32 DropBytes = Drop * (int32)sizeof(CharType);
+	FMemory::Memmove(StreamBuf.GetData(), StreamBuf.GetData() + DropBytes, StreamNum - DropBytes);
+	StreamNum -= DropBytes;
+	Buf = SourceView((const CharType*)StreamBuf.GetData(), StreamNum / (int32)sizeof(CharType));
+
+	Cur -= Drop;
+	if (bTokenValid)
+		Token.Ref.Begin -= Drop;
+	if (bCachedNextValid)
+		CachedNext.Ref.Begin -= Drop;
+}
+
 template <typename CharType>
 FDcResult TDcJsonReader<CharType>::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
 {
+	if (Stream)
+		CompactStream();
+
 	if(bNeedConsumeToken)
 	{
 		DC_TRY(ConsumeEffectiveToken());
@@ -362,6 +696,9 @@ FDcResult TDcJsonReader<CharType>::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
 template<typename CharType>
 FDcResult TDcJsonReader<CharType>::PeekRead(EDcDataEntry* OutPtr)
 {
+	if (Stream)
+		CompactStream();
+
 	if (bNeedConsumeToken)
 	{
 		DC_TRY(ConsumeEffectiveToken());
@@ -431,14 +768,19 @@ FDcResult TDcJsonReader<CharType>::CheckNotObjectKey()
 }
 
 template<typename CharType>
-FDcResult TDcJsonReader<CharType>::CheckObjectDuplicatedKey(const FString& Key)
+FDcResult TDcJsonReader<CharType>::CheckObjectDuplicatedKey(const FDcStringViewData& Key)
 {
 	check(Keys.Num() && IsAtObjectKey());
-	if (Keys.Top().Contains(Key))
-		return DC_FAIL(DcDJSON, DuplicatedKey) << Key << FormatHighlight(Token.Ref);
-	else
-		Keys.Top().Add(Key);
+	if (!bCheckDuplicatedKey)
+		return DcOk();
 
+	uint32 Hash = DcJsonReaderDetails::HashStringView(Key);
+	FKeys& TopKeys = Keys.Top();
+	if (TopKeys.Contains(Hash, [&Key](const FDcStringViewData& Existed) { return Existed.Equals(Key); }))
+		return DC_FAIL(DcDJSON, DuplicatedKey) << Key.ToString() << FormatHighlight(Token.Ref);
+
+	//	borrowed keys point into `Buf`, only escaped or transcoded keys are copied
+	TopKeys.Add(Hash, FDcStringViewData(Key));
 	return DcOk();
 }
 
@@ -457,16 +799,16 @@ FDcResult TDcJsonReader<CharType>::ReadName(FName* OutPtr)
 	DC_TRY(CheckConsumeToken(EDcDataEntry::Name));
 	if (Token.Type == ETokenType::String)
 	{
-		FString ParsedStr;
-		DC_TRY(ParseStringToken(ParsedStr));
+		FDcStringViewData ParsedView;
+		DC_TRY(ParseStringTokenView(ParsedView));
 
 		if (IsAtObjectKey())
-			DC_TRY(CheckObjectDuplicatedKey(ParsedStr));
+			DC_TRY(CheckObjectDuplicatedKey(ParsedView));
 
-		if (ParsedStr.Len() >= NAME_SIZE)
+		if (ParsedView.Len() >= NAME_SIZE)
 			return DC_FAIL(DcDReadWrite, FNameOverSize);
 
-		ReadOut(OutPtr, FName(ParsedStr));
+		ReadOut(OutPtr, ParsedView.ToName());
 
 		DC_TRY(EndTopRead());
 		return DcOk();
@@ -485,13 +827,13 @@ FDcResult TDcJsonReader<CharType>::ReadString(FString* OutPtr)
 	DC_TRY(CheckConsumeToken(EDcDataEntry::String));
 	if (Token.Type == ETokenType::String)
 	{
-		FString ParsedStr;
-		DC_TRY(ParseStringToken(ParsedStr));
+		FDcStringViewData ParsedView;
+		DC_TRY(ParseStringTokenView(ParsedView));
 
 		if (IsAtObjectKey())
-			DC_TRY(CheckObjectDuplicatedKey(ParsedStr));
+			DC_TRY(CheckObjectDuplicatedKey(ParsedView));
 
-		ReadOut(OutPtr, MoveTemp(ParsedStr));
+		ReadOut(OutPtr, MoveTemp(ParsedView).ToString());
 		DC_TRY(EndTopRead());
 		return DcOk();
 	}
@@ -509,19 +851,52 @@ FDcResult TDcJsonReader<CharType>::ReadString(FString* OutPtr)
 	}
 }
 
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::ReadStringView(FDcStringViewData* OutPtr)
+{
+	DC_TRY(CheckConsumeToken(EDcDataEntry::String));
+	if (Token.Type == ETokenType::String)
+	{
+		FDcStringViewData ParsedView;
+		DC_TRY(ParseStringTokenView(ParsedView));
+
+		if (IsAtObjectKey())
+			DC_TRY(CheckObjectDuplicatedKey(ParsedView));
+
+		ReadOut(OutPtr, MoveTemp(ParsedView));
+		DC_TRY(EndTopRead());
+		return DcOk();
+	}
+	else if (Token.Type == ETokenType::Number)
+	{
+		if (Stream)
+			ReadOut(OutPtr, FDcStringViewData::FromOwned(Token.Ref.CharsToString()));
+		else
+			ReadOut(OutPtr, DcJsonReaderDetails::MakeBorrowedStringView(Token.Ref.GetBeginPtr(), Token.Ref.Num));
+		DC_TRY(EndTopRead());
+		return DcOk();
+	}
+	else
+	{
+		return DC_FAIL(DcDJSON, ReadTypeMismatch)
+			<< EDcDataEntry::String << FDcJsonReaderDetails<CharType>::TokenTypeToDataEntry(Token.Type)
+			<< FormatHighlight(Token.Ref);
+	}
+}
+
 template<typename CharType>
 FDcResult TDcJsonReader<CharType>::ReadText(FText* OutPtr)
 {
 	DC_TRY(CheckConsumeToken(EDcDataEntry::Text));
 	if (Token.Type == ETokenType::String)
 	{
-		FString ParsedStr;
-		DC_TRY(ParseStringToken(ParsedStr));
+		FDcStringViewData ParsedView;
+		DC_TRY(ParseStringTokenView(ParsedView));
 
 		if (IsAtObjectKey())
-			DC_TRY(CheckObjectDuplicatedKey(ParsedStr));
+			DC_TRY(CheckObjectDuplicatedKey(ParsedView));
 
-		ReadOut(OutPtr, FTextStringHelper::CreateFromBuffer(*ParsedStr));
+		ReadOut(OutPtr, FTextStringHelper::CreateFromBuffer(*MoveTemp(ParsedView).ToString()));
 		DC_TRY(EndTopRead());
 		return DcOk();
 	}
@@ -542,6 +917,8 @@ FDcResult TDcJsonReader<CharType>::ReadStringToken()
 	Advance();
 	while (true)
 	{
+		FDcJsonReaderDetails<CharType>::SkipStringRun(this);
+
 		CharType Char = PeekChar();
 		if (Char == CharType('\0')
 			|| SourceUtils::IsLineBreak(Char))
@@ -592,19 +969,31 @@ FDcResult TDcJsonReader<CharType>::ReadStringToken()
 }
 
 template <typename CharType>
-FString TDcJsonReader<CharType>::ConvertStringTokenToLiteral(SourceRef Ref)
+FDcResult TDcJsonReader<CharType>::ValidateStringUtf8(SourceRef Ref, int32& OutCharNum)
+{
+	if (!DcUtf8::Validate((const uint8*)Ref.GetBeginPtr(), Ref.Num, OutCharNum))
+		return DC_FAIL(DcDJSON, InvalidUtf8) << FormatHighlight(Ref);
+
+	return DcOk();
+}
+
+template <typename CharType>
+FDcResult TDcJsonReader<CharType>::ConvertStringTokenToLiteral(SourceRef Ref, FString& OutStr)
 {
 	if (DcTypeUtils::TIsSame<CharType, ANSICHAR>::Value
 		&& Token.Flag.bStringHasNonAscii)
 	{
-		//	UTF8 conv when detects non ascii chars
-		FUTF8ToTCHAR UTF8Conv((const ANSICHAR*)Ref.GetBeginPtr(), Ref.Num);
-		return FString(UTF8Conv.Length(), UTF8Conv.Get());
+		//	validate then decode straight into a string of the exact size
+		int32 CharNum;
+		DC_TRY(ValidateStringUtf8(Ref, CharNum));
+		OutStr = DcUtf8::ToString((const uint8*)Ref.GetBeginPtr(), Ref.Num, CharNum);
 	}
 	else
 	{
-		return Ref.CharsToString();
+		OutStr = Ref.CharsToString();
 	}
+
+	return DcOk();
 }
 
 template <typename CharType>
@@ -624,16 +1013,46 @@ FDcResult TDcJsonReader<CharType>::ParseStringToken(FString &OutStr)
 
 	if (!Token.Flag.bStringHasEscapeChar)
 	{
-		OutStr = ConvertStringTokenToLiteral(UnquotedRef);
-		return DcOk();
+		return ConvertStringTokenToLiteral(UnquotedRef, OutStr);
 	}
 	else
 	{
-		FString UnquotedStr = ConvertStringTokenToLiteral(UnquotedRef);
+		FString UnquotedStr;
+		DC_TRY(ConvertStringTokenToLiteral(UnquotedRef, UnquotedStr));
 		return FDcJsonReaderDetails<CharType>::ParseQuotedString(this, UnquotedStr, OutStr);
 	}
 }
 
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::ParseStringTokenView(FDcStringViewData& OutView)
+{
+	check(Token.Type == ETokenType::String);
+
+	//	streamed window moves so views are always owned
+	if (Token.Flag.bStringHasEscapeChar || Stream)
+	{
+		FString ParsedStr;
+		DC_TRY(ParseStringToken(ParsedStr));
+		OutView = FDcStringViewData::FromOwned(MoveTemp(ParsedStr));
+		return DcOk();
+	}
+
+	const CharType* Ptr = Token.Ref.GetBeginPtr() + 1;
+	int32 Num = Token.Ref.Num - 2;
+	if (DcTypeUtils::TIsSame<CharType, ANSICHAR>::Value
+		&& Token.Flag.bStringHasNonAscii)
+	{
+		//	hand out validated UTF8 bytes and leave decoding to the consumer
+		int32 CharNum;
+		DC_TRY(ValidateStringUtf8(SourceRef{&Buf, Token.Ref.Begin + 1, Num}, CharNum));
+		OutView = FDcStringViewData::FromUtf8((const ANSICHAR*)Ptr, Num, CharNum);
+		return DcOk();
+	}
+
+	OutView = DcJsonReaderDetails::MakeBorrowedStringView(Ptr, Num);
+	return DcOk();
+}
+
 template<typename CharType>
 FDcResult TDcJsonReader<CharType>::ReadNumberToken()
 {
@@ -802,6 +1221,7 @@ template<typename CharType>
 void TDcJsonReader<CharType>::ReadWhiteSpace()
 {
 	Token.Ref.Begin = Cur;
+	FDcJsonReaderDetails<CharType>::SkipWhitespaceRun(this);
 
 	while (!IsAtEnd())
 	{
@@ -917,6 +1337,9 @@ FDcResult TDcJsonReader<CharType>::ReadTokenAsDataEntry(EDcDataEntry* OutPtr)
 template<typename CharType>
 FDcResult TDcJsonReader<CharType>::CheckConsumeToken(EDcDataEntry Expect)
 {
+	if (Stream)
+		CompactStream();
+
 	if (bNeedConsumeToken)
 	{
 		EDcDataEntry Actual;
@@ -1089,6 +1512,92 @@ FDcResult TDcJsonReader<CharType>::ReadArrayEnd()
 	}
 }
 
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::PeekContainerSize(int32* OutPtr)
+{
+	//	only right after entering a container, `Cur` is then just past the open bracket
+	if (!bCountContainerSize
+		|| !bNeedConsumeToken
+		|| CachedNext.IsValid())
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	if ((Token.Type == ETokenType::SquareOpen && GetTopState() == EParseState::Array)
+		|| (Token.Type == ETokenType::CurlyOpen && GetTopState() == EParseState::Object))
+		return ReadOutOk(OutPtr, FDcJsonReaderDetails<CharType>::CountContainerItems(this));
+
+	return ReadOutOk(OutPtr, INDEX_NONE);
+}
+
+template<typename CharType>
+FDcResult TDcJsonReader<CharType>::SkipValue()
+{
+	//	stream only retains a window around the current token
+	if (Stream)
+		return FDcReader::SkipValue();
+
+	EDcDataEntry Next;
+	DC_TRY(PeekRead(&Next));
+
+	if (Token.Type == ETokenType::CurlyOpen
+		|| Token.Type == ETokenType::SquareOpen)
+	{
+		DC_TRY(CheckNotObjectKey());
+
+		int32 NewLineCount;
+		int32 LastNewLineIx;
+		int32 CloseIx = FDcJsonReaderDetails<CharType>::FindContainerClose(this, NewLineCount, LastNewLineIx);
+		if (CloseIx == INDEX_NONE)
+		{
+			if (Token.Type == ETokenType::CurlyOpen)
+				return DC_FAIL(DcDJSON, EndUnclosedObject) << FormatHighlight(Token.Ref);
+			else
+				return DC_FAIL(DcDJSON, EndUnclosedArray) << FormatHighlight(Token.Ref);
+		}
+
+		Token.Type = Token.Type == ETokenType::CurlyOpen
+			? ETokenType::CurlyClose
+			: ETokenType::SquareClose;
+		Token.Ref.Begin = CloseIx;
+		Token.Ref.Num = 1;
+
+		if (NewLineCount > 0)
+		{
+			Loc.Line += NewLineCount;
+			Loc.Column = CloseIx + 1 - LastNewLineIx;
+		}
+		else
+		{
+			Loc.Column += CloseIx + 1 - Cur;
+		}
+		Cur = CloseIx + 1;
+	}
+	else if (Token.Type == ETokenType::String)
+	{
+		//	a key is skipped on its own like any other read, still check it's not
+		//	duplicated so skipping accepts the same input as reading
+		if (IsAtObjectKey())
+		{
+			FDcStringViewData ParsedView;
+			DC_TRY(ParseStringTokenView(ParsedView));
+			DC_TRY(CheckObjectDuplicatedKey(ParsedView));
+		}
+	}
+	else if (Token.Type == ETokenType::Number
+		|| Token.Type == ETokenType::True
+		|| Token.Type == ETokenType::False
+		|| Token.Type == ETokenType::Null)
+	{
+		DC_TRY(CheckNotObjectKey());
+	}
+	else
+	{
+		return DC_FAIL(DcDJSON, UnexpectedToken) << FormatHighlight(Token.Ref);
+	}
+
+	bNeedConsumeToken = true;
+	return EndTopRead();
+}
+
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt8(int8* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt16(int16* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
 template<typename CharType> FDcResult TDcJsonReader<CharType>::ReadInt32(int32* OutPtr) { return FDcJsonReaderDetails<CharType>::ReadSignedInteger(this, OutPtr); }
@@ -1242,7 +1751,11 @@ bool TDcJsonReader<CharType>::IsAtEnd(int N)
 {
 	check(State != EState::Uninitialized && State != EState::Invalid);
 	check(Cur >= 0);
-	return Cur + N >= Buf.Num;
+	if (Cur + N < Buf.Num)
+		return false;
+
+	return Stream == nullptr
+		|| !FillStream(Cur + N + 1);
 }
 
 template<typename CharType>
@@ -1295,16 +1808,43 @@ template<typename CharType>
 FDcDiagnosticHighlight TDcJsonReader<CharType>::FormatHighlight(SourceRef SpanRef)
 {
 	FDcDiagnosticHighlight OutHighlight(this, ClassId().ToString());
+	EDcDiagMode DiagMode = DcEnv().DiagMode;
+	if (DiagMode == EDcDiagMode::Silent)
+		return OutHighlight;
+
 	OutHighlight.FileContext.Emplace();
 	OutHighlight.FileContext->Loc = Loc;
 	OutHighlight.FileContext->FilePath = DiagFilePath.IsEmpty() ? TEXT("<in-memory>") : DiagFilePath;
 
-	THightlightFormatter<CharType> Highlighter;
-	OutHighlight.Formatted = Highlighter.FormatHighlight(SpanRef, Loc.Line);
+	auto _Format = [](SourceRef Ref, int Line)
+	{
+		THightlightFormatter<CharType> Highlighter;
+		FString Formatted = Highlighter.FormatHighlight(Ref, Line);
+		return Formatted.IsEmpty()
+			? FString(TEXT("<contents empty>"))
+			: Formatted;
+	};
+
+	if (DiagMode == EDcDiagMode::Deferred
+		&& SpanRef.IsValid())
+	{
+		//	copy only the lines shown as the buffer can be gone on flush
+		SourceRef Window = THightlightFormatter<CharType>::FindContextWindow(SpanRef);
+		TArray<CharType> Chars(Window.GetBeginPtr(), Window.Num);
+		int32 Begin = SpanRef.Begin - Window.Begin;
+		int32 Num = SpanRef.Num;
+		int Line = Loc.Line;
 
-	if (OutHighlight.Formatted.IsEmpty())
-		OutHighlight.Formatted = TEXT("<contents empty>");
+		OutHighlight.DeferredFormat = [_Format, Chars = MoveTemp(Chars), Begin, Num, Line](FDcDiagnosticHighlight& Self)
+		{
+			SourceView View(Chars.GetData(), Chars.Num());
+			Self.Formatted = _Format(SourceRef{ &View, Begin, Num }, Line);
+		};
+
+		return OutHighlight;
+	}
 
+	OutHighlight.Formatted = _Format(SpanRef, Loc.Line);
 	return OutHighlight;
 }
 
@@ -1318,3 +1858,28 @@ void TDcJsonReader<CharType>::FormatDiagnostic(FDcDiagnostic& Diag)
 template struct DATACONFIGCORE_API TDcJsonReader<ANSICHAR>;
 template struct DATACONFIGCORE_API TDcJsonReader<WIDECHAR>;
 
+FDcResult FDcMappedJsonReader::OpenFile(const TCHAR* Path)
+{
+	//	finish previous read before the old mapping goes away
+	if (State == EState::InProgress)
+		DC_TRY(FinishRead());
+
+	//	`File.Open` drops the old mapping first, so never leave `Buf` pointing
+	//	into it even if opening fails
+	FDcJsonReaderDetails<ANSICHAR>::Reset(this, nullptr, 0);
+
+	DC_TRY(File.Open(Path));
+
+	const ANSICHAR* Ptr = (const ANSICHAR*)File.GetData();
+	int32 Num = File.Num();
+	if (Num >= 3 && (uint8)Ptr[0] == 0xEF && (uint8)Ptr[1] == 0xBB && (uint8)Ptr[2] == 0xBF)
+	{
+		Ptr += 3;
+		Num -= 3;
+	}
+
+	DC_TRY(SetNewString(Ptr, Num));
+	DiagFilePath = Path;
+	return DcOk();
+}
+
@@ -0,0 +1,52 @@
+#include "DataConfig/Json/DcJsonScan.h"
+#include "DataConfig/Json/DcJsonScanDetails.h"
+
+namespace DcJsonScanDetails
+{
+
+EDcJsonScanImpl GScanImpl = DcJsonScan::GetNativeImpl();
+
+} // namespace DcJsonScanDetails
+
+namespace DcJsonScan
+{
+
+EDcJsonScanImpl GetNativeImpl()
+{
+#if DC_JSON_SCAN_SSE2
+	//	SSE2 is baseline on all x64 targets
+	return EDcJsonScanImpl::SSE2;
+#elif DC_JSON_SCAN_NEON
+	return EDcJsonScanImpl::NEON;
+#else
+	return EDcJsonScanImpl::Scalar;
+#endif
+}
+
+EDcJsonScanImpl GetImpl()
+{
+	return DcJsonScanDetails::GScanImpl;
+}
+
+void SetImpl(EDcJsonScanImpl InImpl)
+{
+	if (InImpl == EDcJsonScanImpl::Scalar
+		|| InImpl == GetNativeImpl())
+		DcJsonScanDetails::GScanImpl = InImpl;
+	else
+		DcJsonScanDetails::GScanImpl = EDcJsonScanImpl::Scalar;
+}
+
+const TCHAR* ImplToString(EDcJsonScanImpl InImpl)
+{
+	switch (InImpl)
+	{
+		case EDcJsonScanImpl::Scalar: return TEXT("Scalar");
+		case EDcJsonScanImpl::SSE2: return TEXT("SSE2");
+		case EDcJsonScanImpl::NEON: return TEXT("NEON");
+		default: return TEXT("<invalid>");
+	}
+}
+
+} // namespace DcJsonScan
+
@@ -0,0 +1,394 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Math/UnrealMathUtility.h"
+#include "DataConfig/Json/DcJsonScan.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#define DC_JSON_SCAN_NEON 1
+	#define DC_JSON_SCAN_SSE2 0
+	#include <arm_neon.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+	#define DC_JSON_SCAN_NEON 0
+	#define DC_JSON_SCAN_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define DC_JSON_SCAN_NEON 0
+	#define DC_JSON_SCAN_SSE2 0
+#endif
+
+///	Stage 1 block classifiers for UTF8 JSON input.
+///	These only find the next "interesting" byte and leave tokenizing to `TDcJsonReader`.
+///	`ScanEscapeRun` does the same for `TDcJsonWriter` on `TCHAR` strings.
+namespace DcJsonScanDetails
+{
+
+extern EDcJsonScanImpl GScanImpl;
+
+struct FWhitespaceRun
+{
+	int32 Num = 0;
+	int32 NewLineCount = 0;
+	int32 LastNewLineIx = 0;
+};
+
+//	string content stops at quote, backslash and any control char below 0x20
+//	DEL and all bytes >= 0x80 mark the token as non ascii
+FORCEINLINE bool IsStringStop(uint8 Ch) { return Ch == '"' || Ch == '\\' || Ch < 0x20; }
+FORCEINLINE bool IsNonAscii(uint8 Ch) { return Ch >= 0x7f; }
+FORCEINLINE bool IsWhitespace(uint8 Ch) { return Ch == ' ' || Ch == '\t' || Ch == '\n' || Ch == '\r'; }
+
+//	writer escapes quote, backslash, control chars below 0x20 and 0x7f-0xa0, same as `TDcCSourceUtils::IsControl`
+FORCEINLINE bool IsEscapeStop(uint32 Ch) { return Ch == '"' || Ch == '\\' || Ch <= 0x1f || (Ch >= 0x7f && Ch <= 0xa0); }
+
+FORCEINLINE int32 ScanStringScalar(const uint8* Ptr, int32 Ix, int32 Num, bool& bOutNonAscii)
+{
+	for (; Ix < Num; Ix++)
+	{
+		uint8 Ch = Ptr[Ix];
+		if (IsStringStop(Ch))
+			break;
+
+		bOutNonAscii |= IsNonAscii(Ch);
+	}
+	return Ix;
+}
+
+FORCEINLINE int32 ScanAsciiScalar(const uint8* Ptr, int32 Ix, int32 Num)
+{
+	for (; Ix < Num; Ix++)
+	{
+		if (Ptr[Ix] >= 0x80)
+			break;
+	}
+	return Ix;
+}
+
+FORCEINLINE void ScanWhitespaceScalar(const uint8* Ptr, int32 Ix, int32 Num, FWhitespaceRun& OutRun)
+{
+	for (; Ix < Num; Ix++)
+	{
+		uint8 Ch = Ptr[Ix];
+		if (!IsWhitespace(Ch))
+			break;
+
+		if (Ch == '\n')
+		{
+			OutRun.NewLineCount++;
+			OutRun.LastNewLineIx = Ix;
+		}
+	}
+	OutRun.Num = Ix;
+}
+
+FORCEINLINE int32 ScanEscapeScalar(const TCHAR* Ptr, int32 Ix, int32 Num)
+{
+	for (; Ix < Num; Ix++)
+	{
+		if (IsEscapeStop((uint32)Ptr[Ix]))
+			break;
+	}
+	return Ix;
+}
+
+#if DC_JSON_SCAN_SSE2
+
+FORCEINLINE int32 ScanStringSSE2(const uint8* Ptr, int32 Num, bool& bOutNonAscii)
+{
+	const __m128i Quote = _mm_set1_epi8('"');
+	const __m128i Backslash = _mm_set1_epi8('\\');
+	const __m128i CtrlMax = _mm_set1_epi8(0x1f);
+	const __m128i NonAsciiMin = _mm_set1_epi8(0x7f);
+
+	uint32 NonAscii = 0;
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		__m128i Block = _mm_loadu_si128((const __m128i*)(Ptr + Ix));
+
+		//	unsigned compares through min/max
+		__m128i IsCtrl = _mm_cmpeq_epi8(_mm_min_epu8(Block, CtrlMax), Block);
+		__m128i IsHigh = _mm_cmpeq_epi8(_mm_max_epu8(Block, NonAsciiMin), Block);
+		__m128i IsStop = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(Block, Quote), _mm_cmpeq_epi8(Block, Backslash)),
+			IsCtrl);
+
+		uint32 StopMask = (uint32)_mm_movemask_epi8(IsStop);
+		uint32 HighMask = (uint32)_mm_movemask_epi8(IsHigh);
+		if (StopMask)
+		{
+			uint32 Offset = FMath::CountTrailingZeros(StopMask);
+			NonAscii |= HighMask & ((1u << Offset) - 1);
+			bOutNonAscii |= NonAscii != 0;
+			return Ix + Offset;
+		}
+
+		NonAscii |= HighMask;
+	}
+
+	bOutNonAscii |= NonAscii != 0;
+	return ScanStringScalar(Ptr, Ix, Num, bOutNonAscii);
+}
+
+FORCEINLINE void ScanWhitespaceSSE2(const uint8* Ptr, int32 Num, FWhitespaceRun& OutRun)
+{
+	const __m128i Space = _mm_set1_epi8(' ');
+	const __m128i Tab = _mm_set1_epi8('\t');
+	const __m128i LF = _mm_set1_epi8('\n');
+	const __m128i CR = _mm_set1_epi8('\r');
+
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		__m128i Block = _mm_loadu_si128((const __m128i*)(Ptr + Ix));
+		__m128i IsLF = _mm_cmpeq_epi8(Block, LF);
+		__m128i IsWs = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(Block, Space), _mm_cmpeq_epi8(Block, Tab)),
+			_mm_or_si128(IsLF, _mm_cmpeq_epi8(Block, CR)));
+
+		uint32 NotWsMask = ~(uint32)_mm_movemask_epi8(IsWs) & 0xffff;
+		uint32 NewLineMask = (uint32)_mm_movemask_epi8(IsLF);
+		if (NotWsMask)
+			NewLineMask &= (1u << FMath::CountTrailingZeros(NotWsMask)) - 1;
+
+		if (NewLineMask)
+		{
+			OutRun.NewLineCount += FMath::CountBits(NewLineMask);
+			OutRun.LastNewLineIx = Ix + FMath::FloorLog2(NewLineMask);
+		}
+
+		if (NotWsMask)
+		{
+			OutRun.Num = Ix + FMath::CountTrailingZeros(NotWsMask);
+			return;
+		}
+	}
+
+	ScanWhitespaceScalar(Ptr, Ix, Num, OutRun);
+}
+
+FORCEINLINE int32 ScanAsciiSSE2(const uint8* Ptr, int32 Num)
+{
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		//	movemask picks up the high bit directly
+		uint32 HighMask = (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(Ptr + Ix)));
+		if (HighMask)
+			return Ix + FMath::CountTrailingZeros(HighMask);
+	}
+
+	return ScanAsciiScalar(Ptr, Ix, Num);
+}
+
+//	same as scalar on 16 bit chars, 8 at a time
+FORCEINLINE int32 ScanEscapeSSE2(const TCHAR* Ptr, int32 Num)
+{
+	const __m128i Quote = _mm_set1_epi16('"');
+	const __m128i Backslash = _mm_set1_epi16('\\');
+	const __m128i CtrlMax = _mm_set1_epi16(0x1f);
+	const __m128i HighCtrlMin = _mm_set1_epi16(0x7f);
+	const __m128i HighCtrlSpan = _mm_set1_epi16(0xa0 - 0x7f);
+	const __m128i Zero = _mm_setzero_si128();
+
+	int32 Ix = 0;
+	for (; Ix + 8 <= Num; Ix += 8)
+	{
+		__m128i Block = _mm_loadu_si128((const __m128i*)(Ptr + Ix));
+
+		//	unsigned `x <= Max` as saturated `x - Max == 0`
+		__m128i IsCtrl = _mm_cmpeq_epi16(_mm_subs_epu16(Block, CtrlMax), Zero);
+		__m128i IsHighCtrl = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(Block, HighCtrlMin), HighCtrlSpan), Zero);
+		__m128i IsStop = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi16(Block, Quote), _mm_cmpeq_epi16(Block, Backslash)),
+			_mm_or_si128(IsCtrl, IsHighCtrl));
+
+		uint32 StopMask = (uint32)_mm_movemask_epi8(IsStop);
+		if (StopMask)
+			return Ix + (FMath::CountTrailingZeros(StopMask) >> 1);
+	}
+
+	return ScanEscapeScalar(Ptr, Ix, Num);
+}
+
+#endif // DC_JSON_SCAN_SSE2
+
+#if DC_JSON_SCAN_NEON
+
+//	NEON has no movemask, narrow each byte lane to a nibble instead
+FORCEINLINE uint64 NeonNibbleMask(uint8x16_t Cmp)
+{
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Cmp), 4)), 0);
+}
+
+FORCEINLINE int32 ScanStringNEON(const uint8* Ptr, int32 Num, bool& bOutNonAscii)
+{
+	const uint8x16_t Quote = vdupq_n_u8('"');
+	const uint8x16_t Backslash = vdupq_n_u8('\\');
+	const uint8x16_t CtrlEnd = vdupq_n_u8(0x20);
+	const uint8x16_t NonAsciiMin = vdupq_n_u8(0x7f);
+
+	uint64 NonAscii = 0;
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		uint8x16_t Block = vld1q_u8(Ptr + Ix);
+		uint8x16_t IsStop = vorrq_u8(
+			vorrq_u8(vceqq_u8(Block, Quote), vceqq_u8(Block, Backslash)),
+			vcltq_u8(Block, CtrlEnd));
+
+		uint64 StopMask = NeonNibbleMask(IsStop);
+		uint64 HighMask = NeonNibbleMask(vcgeq_u8(Block, NonAsciiMin));
+		if (StopMask)
+		{
+			uint32 Offset = (uint32)FMath::CountTrailingZeros64(StopMask) >> 2;
+			NonAscii |= HighMask & ((uint64(1) << (Offset * 4)) - 1);
+			bOutNonAscii |= NonAscii != 0;
+			return Ix + Offset;
+		}
+
+		NonAscii |= HighMask;
+	}
+
+	bOutNonAscii |= NonAscii != 0;
+	return ScanStringScalar(Ptr, Ix, Num, bOutNonAscii);
+}
+
+FORCEINLINE void ScanWhitespaceNEON(const uint8* Ptr, int32 Num, FWhitespaceRun& OutRun)
+{
+	const uint8x16_t Space = vdupq_n_u8(' ');
+	const uint8x16_t Tab = vdupq_n_u8('\t');
+	const uint8x16_t LF = vdupq_n_u8('\n');
+	const uint8x16_t CR = vdupq_n_u8('\r');
+
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		uint8x16_t Block = vld1q_u8(Ptr + Ix);
+		uint8x16_t IsLF = vceqq_u8(Block, LF);
+		uint8x16_t IsWs = vorrq_u8(
+			vorrq_u8(vceqq_u8(Block, Space), vceqq_u8(Block, Tab)),
+			vorrq_u8(IsLF, vceqq_u8(Block, CR)));
+
+		uint64 NotWsMask = ~NeonNibbleMask(IsWs);
+		uint64 NewLineMask = NeonNibbleMask(IsLF);
+		if (NotWsMask)
+			NewLineMask &= (uint64(1) << (FMath::CountTrailingZeros64(NotWsMask) & ~3)) - 1;
+
+		if (NewLineMask)
+		{
+			OutRun.NewLineCount += FMath::CountBits(NewLineMask) >> 2;
+			OutRun.LastNewLineIx = Ix + (FMath::FloorLog2_64(NewLineMask) >> 2);
+		}
+
+		if (NotWsMask)
+		{
+			OutRun.Num = Ix + ((uint32)FMath::CountTrailingZeros64(NotWsMask) >> 2);
+			return;
+		}
+	}
+
+	ScanWhitespaceScalar(Ptr, Ix, Num, OutRun);
+}
+
+FORCEINLINE int32 ScanAsciiNEON(const uint8* Ptr, int32 Num)
+{
+	const uint8x16_t HighMin = vdupq_n_u8(0x80);
+
+	int32 Ix = 0;
+	for (; Ix + 16 <= Num; Ix += 16)
+	{
+		uint64 HighMask = NeonNibbleMask(vcgeq_u8(vld1q_u8(Ptr + Ix), HighMin));
+		if (HighMask)
+			return Ix + ((uint32)FMath::CountTrailingZeros64(HighMask) >> 2);
+	}
+
+	return ScanAsciiScalar(Ptr, Ix, Num);
+}
+
+FORCEINLINE int32 ScanEscapeNEON(const TCHAR* Ptr, int32 Num)
+{
+	const uint16x8_t Quote = vdupq_n_u16('"');
+	const uint16x8_t Backslash = vdupq_n_u16('\\');
+	const uint16x8_t CtrlMax = vdupq_n_u16(0x1f);
+	const uint16x8_t HighCtrlMin = vdupq_n_u16(0x7f);
+	const uint16x8_t HighCtrlSpan = vdupq_n_u16(0xa0 - 0x7f);
+
+	int32 Ix = 0;
+	for (; Ix + 8 <= Num; Ix += 8)
+	{
+		uint16x8_t Block = vld1q_u16((const uint16*)(Ptr + Ix));
+		uint16x8_t IsStop = vorrq_u16(
+			vorrq_u16(vceqq_u16(Block, Quote), vceqq_u16(Block, Backslash)),
+			vorrq_u16(vcleq_u16(Block, CtrlMax), vcleq_u16(vsubq_u16(Block, HighCtrlMin), HighCtrlSpan)));
+
+		//	narrow each lane to a byte
+		uint64 StopMask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(IsStop)), 0);
+		if (StopMask)
+			return Ix + ((uint32)FMath::CountTrailingZeros64(StopMask) >> 3);
+	}
+
+	return ScanEscapeScalar(Ptr, Ix, Num);
+}
+
+#endif // DC_JSON_SCAN_NEON
+
+///	returns number of plain string bytes at `Ptr` before the next quote, backslash or control char
+FORCEINLINE int32 ScanStringRun(const uint8* Ptr, int32 Num, bool& bOutNonAscii)
+{
+#if DC_JSON_SCAN_SSE2
+	if (GScanImpl == EDcJsonScanImpl::SSE2)
+		return ScanStringSSE2(Ptr, Num, bOutNonAscii);
+#endif
+#if DC_JSON_SCAN_NEON
+	if (GScanImpl == EDcJsonScanImpl::NEON)
+		return ScanStringNEON(Ptr, Num, bOutNonAscii);
+#endif
+	return ScanStringScalar(Ptr, 0, Num, bOutNonAscii);
+}
+
+///	find the whitespace run at `Ptr` and count newlines in it
+FORCEINLINE void ScanWhitespaceRun(const uint8* Ptr, int32 Num, FWhitespaceRun& OutRun)
+{
+#if DC_JSON_SCAN_SSE2
+	if (GScanImpl == EDcJsonScanImpl::SSE2)
+		return ScanWhitespaceSSE2(Ptr, Num, OutRun);
+#endif
+#if DC_JSON_SCAN_NEON
+	if (GScanImpl == EDcJsonScanImpl::NEON)
+		return ScanWhitespaceNEON(Ptr, Num, OutRun);
+#endif
+	return ScanWhitespaceScalar(Ptr, 0, Num, OutRun);
+}
+
+///	returns number of ascii bytes at `Ptr` before the first byte >= 0x80
+FORCEINLINE int32 ScanAsciiRun(const uint8* Ptr, int32 Num)
+{
+#if DC_JSON_SCAN_SSE2
+	if (GScanImpl == EDcJsonScanImpl::SSE2)
+		return ScanAsciiSSE2(Ptr, Num);
+#endif
+#if DC_JSON_SCAN_NEON
+	if (GScanImpl == EDcJsonScanImpl::NEON)
+		return ScanAsciiNEON(Ptr, Num);
+#endif
+	return ScanAsciiScalar(Ptr, 0, Num);
+}
+
+///	returns number of chars at `Ptr` that can be written as is before the next one needing escape
+FORCEINLINE int32 ScanEscapeRun(const TCHAR* Ptr, int32 Num)
+{
+	//	vectorized paths assume 16 bit `TCHAR`
+#if DC_JSON_SCAN_SSE2
+	if (sizeof(TCHAR) == 2 && GScanImpl == EDcJsonScanImpl::SSE2)
+		return ScanEscapeSSE2(Ptr, Num);
+#endif
+#if DC_JSON_SCAN_NEON
+	if (sizeof(TCHAR) == 2 && GScanImpl == EDcJsonScanImpl::NEON)
+		return ScanEscapeNEON(Ptr, Num);
+#endif
+	return ScanEscapeScalar(Ptr, 0, Num);
+}
+
+} // namespace DcJsonScanDetails
+
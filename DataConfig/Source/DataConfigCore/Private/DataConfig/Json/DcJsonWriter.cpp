@@ -1,8 +1,12 @@
 #include "DataConfig/Json/DcJsonWriter.h"
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Source/DcHighlightFormatter.h"
 #include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/Misc/DcUtf8.h"
+#include "DataConfig/Json/DcJsonNumber.h"
+#include "DataConfig/Json/DcJsonScanDetails.h"
 
 
 //	compile hack for c++14 constexpr
@@ -63,14 +67,34 @@ FORCEINLINE bool IsValidWriterKey(EDcDataEntry Entry)
 	}
 }
 
-static FORCEINLINE void WriteSbStringDispatch(TDcJsonWriter<WIDECHAR>::StringBuilder& Sb, const FString& Value)
+static FORCEINLINE void WriteSbCharsDispatch(TDcJsonWriter<WIDECHAR>::StringBuilder& Sb, const TCHAR* Ptr, int32 Num)
 {
-	Sb << Value;
+	Sb.Append(Ptr, Num);
 }
 
-static FORCEINLINE void WriteSbStringDispatch(TDcJsonWriter<ANSICHAR>::StringBuilder& Sb, const FString& Value)
+static FORCEINLINE void WriteSbCharsDispatch(TDcJsonWriter<ANSICHAR>::StringBuilder& Sb, const TCHAR* Ptr, int32 Num)
 {
-	Sb << FTCHARToUTF8(*Value).Get();
+	//	encode into the builder directly without a temporary UTF8 buffer
+	DcUtf8::EncodeChars(Ptr, Num, [&Sb](ANSICHAR Ch) { Sb.AppendChar(Ch); });
+}
+
+template<typename TStringBuilder>
+static FORCEINLINE void WriteSbStringDispatch(TStringBuilder& Sb, const FString& Value)
+{
+	WriteSbCharsDispatch(Sb, *Value, Value.Len());
+}
+
+static FORCEINLINE bool WriteSinkDispatch(FDcSinkStream* Sink, TArray<uint8>& Buf, const WIDECHAR* Ptr, int32 Num)
+{
+	Buf.Reset(Num);
+	DcUtf8::EncodeChars((const TCHAR*)Ptr, Num, [&Buf](ANSICHAR Ch) { Buf.Add((uint8)Ch); });
+	return Sink->Write(Buf.GetData(), Buf.Num());
+}
+
+static FORCEINLINE bool WriteSinkDispatch(FDcSinkStream* Sink, TArray<uint8>& Buf, const ANSICHAR* Ptr, int32 Num)
+{
+	//	already UTF8
+	return Sink->Write((const uint8*)Ptr, Num);
 }
 
 template<typename CharType>
@@ -154,87 +178,56 @@ static FORCEINLINE_DEBUGGABLE void ConsumeNeedNewLineAndIndent(TSelf* Self)
 }
 
 
-static void WriteEscapedString(TSelf* Self, const FString& Str)
+static void WriteEscapedChar(TSelf* Self, TCHAR Ch)
 {
-	//  note how we always read from TCHAR but write by CharType
-	using StringSourceUtils = TDcCSourceUtils<TCHAR>;
+	static const CharType _HEX_DIGITS[] = {
+		'0', '1', '2', '3', '4', '5', '6', '7',
+		'8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+	};
 
-	//	pre pass to scan for escape chars
-	bool bNeedEscape = false;
-	for (int Ix = 0; Ix < Str.Len(); Ix++)
+	Self->Sb << CharType('\\');
+	switch (Ch)
 	{
-		TCHAR Ch = Str[Ix];
-
-		switch (Ch)
+		case TCHAR('\\'): Self->Sb << CharType('\\'); break;
+		case TCHAR('\n'): Self->Sb << CharType('n'); break;
+		case TCHAR('\t'): Self->Sb << CharType('t'); break;
+		case TCHAR('\b'): Self->Sb << CharType('b'); break;
+		case TCHAR('\f'): Self->Sb << CharType('f'); break;
+		case TCHAR('\r'): Self->Sb << CharType('r'); break;
+		case TCHAR('\"'): Self->Sb << CharType('"'); break;
+		default:
 		{
-			case TCHAR('\\'):
-			case TCHAR('\n'):
-			case TCHAR('\t'):
-			case TCHAR('\b'):
-			case TCHAR('\f'):
-			case TCHAR('\r'):
-			case TCHAR('\"'):
-				bNeedEscape = true;
-				break;
-			default:
-				break;
-		}
-
-		if (StringSourceUtils::IsControl(Ch))
-			bNeedEscape = true;
-
-		if (bNeedEscape)
+			Self->Sb << CharType('u');
+			for (int32 Shift = 12; Shift >= 0; Shift -= 4)
+				Self->Sb << _HEX_DIGITS[((uint32)Ch >> Shift) & 0xF];
 			break;
+		}
 	}
+}
 
-	if (!bNeedEscape)
-	{
-		Self->Sb << CharType('"');
-		DcJsonWriterDetails::WriteSbStringDispatch(Self->Sb, Str);
-		Self->Sb << CharType('"');
-		return;
-	}
+static void WriteEscapedString(TSelf* Self, const FString& Str)
+{
+	//  note how we always read from TCHAR but write by CharType
+	//	single pass, plain runs are found by block scan and flushed into `Sb` between escaped chars
+	const TCHAR* Ptr = *Str;
+	int32 Num = Str.Len();
 
-	FString Escaped(TEXT(""), Str.Len() + 16);
-	Escaped.AppendChar(TCHAR('"'));
-	for (int Ix = 0; Ix < Str.Len(); Ix++)
+	Self->Sb << CharType('"');
+	int32 Ix = 0;
+	while (true)
 	{
-		TCHAR Ch = Str[Ix];
+		int32 Run = DcJsonScanDetails::ScanEscapeRun(Ptr + Ix, Num - Ix);
+		if (Run > 0)
+			DcJsonWriterDetails::WriteSbCharsDispatch(Self->Sb, Ptr + Ix, Run);
 
-		const static TCHAR _SLASH_ESCAPED[] = { '\\', '\\', 0 };
-		const static TCHAR _N_ESCAPED[] = { '\\', 'n', 0 };
-		const static TCHAR _T_ESCAPED[] = { '\\', 't', 0 };
-		const static TCHAR _B_ESCAPED[] = { '\\', 'b', 0 };
-		const static TCHAR _F_ESCAPED[] = { '\\', 'f', 0 };
-		const static TCHAR _R_ESCAPED[] = { '\\', 'r', 0 };
-		const static TCHAR _DQUOTE_ESCAPED[] = { '\\', '"', 0 };
+		Ix += Run;
+		if (Ix >= Num)
+			break;
 
-		switch (Ch)
-		{
-			case TCHAR('\\'): Escaped.Append(_SLASH_ESCAPED); break;
-			case TCHAR('\n'): Escaped.Append(_N_ESCAPED); break;
-			case TCHAR('\t'): Escaped.Append(_T_ESCAPED); break;
-			case TCHAR('\b'): Escaped.Append(_B_ESCAPED); break;
-			case TCHAR('\f'): Escaped.Append(_F_ESCAPED); break;
-			case TCHAR('\r'): Escaped.Append(_R_ESCAPED); break;
-			case TCHAR('\"'): Escaped.Append(_DQUOTE_ESCAPED); break;
-			default:
-			{
-				if (StringSourceUtils::IsControl(Ch))
-				{
-					const static TCHAR _CONTROL_ESCAPE_FMT[] = { '\\', 'u', '%', '0', '4', 'x', 0 };
-					Escaped.Appendf(_CONTROL_ESCAPE_FMT, Ch);
-				}
-				else
-				{
-					Escaped.AppendChar(Ch);
-				}
-				break;
-			}
-		}
+		WriteEscapedChar(Self, Ptr[Ix]);
+		Ix++;
 	}
-	Escaped.AppendChar(TCHAR('"'));
-	DcJsonWriterDetails::WriteSbStringDispatch(Self->Sb, Escaped);
+	Self->Sb << CharType('"');
 }
 
 
@@ -261,14 +254,44 @@ static FORCEINLINE void BeginWriteValuePosition(TSelf* Self)
 	ConsumeWriteRightSpacing(Self);
 }
 
-static FORCEINLINE void EndWriteValuePosition(TSelf* Self)
+static FORCEINLINE FDcResult EndWriteValuePosition(TSelf* Self)
 {
 	Self->State.bNeedComma = true;
 	Self->State.bTopObjectAtValue = false;
 	Self->State.bTopContainerNotEmpty = true;
+
+	//	only flush on value end so strings are never split
+	if (Self->Sink && Self->Sb.Len() >= Self->SinkFlushSize)
+		return Self->FlushSink();
+
+	return DcOk();
+}
+
+static FDcResult CheckDuplicatedKey(TSelf* Self, int32 Begin, int32 End)
+{
+	//	key excludes quotes so it's directly comparable
+	const CharType* Key = Self->Sb.GetData() + Begin + 1;
+	int32 KeyNum = End - Begin - 2;
+	uint32 Hash = DcJsonKeySet::HashChars(Key, KeyNum);
+
+	const CharType* Data = Self->KeyChars.GetData();
+	typename TSelf::FKeys& TopKeys = Self->Keys.Top();
+	bool bDuplicated = TopKeys.Contains(Hash, [Data, Key, KeyNum](const typename TSelf::FKeySpan& Existed)
+	{
+		return Existed.Num == KeyNum
+			&& FPlatformMemory::Memcmp(Data + Existed.Begin, Key, KeyNum * sizeof(CharType)) == 0;
+	});
+
+	if (bDuplicated)
+		return DC_FAIL(DcDJSON, DuplicatedKey) << FString(KeyNum, Key);
+
+	typename TSelf::FKeySpan Span{Self->KeyChars.Num(), KeyNum};
+	Self->KeyChars.Append(Key, KeyNum);
+	TopKeys.Add(Hash, MoveTemp(Span));
+	return DcOk();
 }
 
-static void WriteString(TSelf* Self, const FString& Value)
+static FDcResult WriteString(TSelf* Self, const FString& Value)
 {
 	using EWriteState = typename TSelf::EWriteState;
 
@@ -280,7 +303,11 @@ static void WriteString(TSelf* Self, const FString& Value)
 		ConsumeNeedNewLineAndIndent(Self);
 		ConsumeWriteComma(Self);
 
+		int32 KeyBegin = Self->Sb.Len();
 		WriteEscapedString(Self, Value);
+		if (Self->bCheckDuplicatedKey && Self->Keys.Num())
+			DC_TRY(CheckDuplicatedKey(Self, KeyBegin, Self->Sb.Len()));
+
 		Self->Sb << Self->ActiveConfig().LeftSpacingLiteral;
 		Self->Sb << ":";
 
@@ -291,8 +318,10 @@ static void WriteString(TSelf* Self, const FString& Value)
 	{
 		BeginWriteValuePosition(Self);
 		WriteEscapedString(Self, Value);
-		EndWriteValuePosition(Self);
+		DC_TRY(EndWriteValuePosition(Self));
 	}
+
+	return DcOk();
 }
 
 static FDcResult WriteNumericFmt(TSelf* Self, const CharType* Fmt, ...)
@@ -312,20 +341,56 @@ static FDcResult WriteNumericFmt(TSelf* Self, const CharType* Fmt, ...)
 		return DC_FAIL(DcDJSON, UnexpectedObjectEnd) << Fmt;
 
 	Self->Sb.Append(Buf, Ret);
-	EndWriteValuePosition(Self);
-	return DcOk();
+	return EndWriteValuePosition(Self);
+}
+
+template<typename TValue, int32 (*Format)(TValue, CharType*)>
+static FDcResult WriteNumericFast(TSelf* Self, TValue Value)
+{
+	DC_TRY(CheckAtValuePosition(Self));
+
+	BeginWriteValuePosition(Self);
+
+	CharType Buf[DcJsonNumber::FormatBufferSize];
+	int32 Len = Format(Value, Buf);
+
+	Self->Sb.Append(Buf, Len);
+	return EndWriteValuePosition(Self);
 }
 
 static FDcResult WriteI64Dispatch(TSelf* Self, const int64& Value)
 {
+	if (Self->ActiveConfig().bFastNumeric)
+		return WriteNumericFast<int64, &DcJsonNumber::FormatInt64<CharType>>(Self, Value);
+
 	return WriteNumericFmt(Self, Self->ActiveConfig().Int64FormatLiteral, Value);
 }
 
 static FDcResult WriteU64Dispatch(TSelf* Self, const uint64& Value)
 {
+	if (Self->ActiveConfig().bFastNumeric)
+		return WriteNumericFast<uint64, &DcJsonNumber::FormatUInt64<CharType>>(Self, Value);
+
 	return WriteNumericFmt(Self, Self->ActiveConfig().UInt64FormatLiteral, Value);
 }
 
+//	non finite values still go through printf
+static FDcResult WriteFloatDispatch(TSelf* Self, const float& Value)
+{
+	if (Self->ActiveConfig().bFastNumeric && FMath::IsFinite(Value))
+		return WriteNumericFast<float, &DcJsonNumber::FormatFloat<CharType>>(Self, Value);
+
+	return WriteNumericFmt(Self, Self->ActiveConfig().FloatFormatLiteral, Value);
+}
+
+static FDcResult WriteDoubleDispatch(TSelf* Self, const double& Value)
+{
+	if (Self->ActiveConfig().bFastNumeric && FMath::IsFinite(Value))
+		return WriteNumericFast<double, &DcJsonNumber::FormatDouble<CharType>>(Self, Value);
+
+	return WriteNumericFmt(Self, Self->ActiveConfig().DoubleFormatLiteral, Value);
+}
+
 };
 
 template<typename CharType>
@@ -371,9 +436,7 @@ FDcResult TDcJsonWriter<CharType>::WriteNone()
 	Details::BeginWriteValuePosition(this);
 	const static CharType _NULL[] = { 'n','u','l','l',0 };
 	Sb << _NULL;
-	Details::EndWriteValuePosition(this);
-
-	return DcOk();
+	return Details::EndWriteValuePosition(this);
 }
 
 template<typename CharType>
@@ -392,30 +455,25 @@ FDcResult TDcJsonWriter<CharType>::WriteBool(bool bValue)
 		Sb << _TRUE;
 	else
 		Sb << _FALSE;
-	Details::EndWriteValuePosition(this);
-
-	return DcOk();
+	return Details::EndWriteValuePosition(this);
 }
 
 template<typename CharType>
 FDcResult TDcJsonWriter<CharType>::WriteString(const FString& Value)
 {
-	FDcJsonWriterDetails<CharType>::WriteString(this, Value);
-	return DcOk();
+	return FDcJsonWriterDetails<CharType>::WriteString(this, Value);
 }
 
 template<typename CharType>
 FDcResult TDcJsonWriter<CharType>::WriteText(const FText& Value)
 {
-	FDcJsonWriterDetails<CharType>::WriteString(this, Value.ToString());
-	return DcOk();
+	return FDcJsonWriterDetails<CharType>::WriteString(this, Value.ToString());
 }
 
 template<typename CharType>
 FDcResult TDcJsonWriter<CharType>::WriteName(const FName& Value)
 {
-	FDcJsonWriterDetails<CharType>::WriteString(this, Value.ToString());
-	return DcOk();
+	return FDcJsonWriterDetails<CharType>::WriteString(this, Value.ToString());
 }
 
 template<typename CharType>
@@ -431,6 +489,8 @@ FDcResult TDcJsonWriter<CharType>::WriteMapRoot()
 		ActiveConfig().bUsesNewLine && ActiveConfig().bNestedObjectStartsOnNewLine);
 
 	States.Push(EWriteState::Object);
+	Keys.AddDefaulted();
+	KeyCharsMarks.Add(KeyChars.Num());
 	Sb << CharType('{');
 	++State.Indent;
 	State.bTopContainerNotEmpty = false;
@@ -450,6 +510,8 @@ FDcResult TDcJsonWriter<CharType>::WriteMapEnd()
 		|| State.bTopObjectAtValue)
 		return DC_FAIL(DcDJSON, UnexpectedObjectEnd);
 
+	Keys.Pop();
+	KeyChars.SetNum(KeyCharsMarks.Pop());
 	--State.Indent;
 	if (State.bTopContainerNotEmpty && ActiveConfig().bUsesNewLine)
 	{
@@ -460,8 +522,7 @@ FDcResult TDcJsonWriter<CharType>::WriteMapEnd()
 
 	Sb << CharType('}');
 
-	Details::EndWriteValuePosition(this);
-	return DcOk();
+	return Details::EndWriteValuePosition(this);
 }
 
 template<typename CharType>
@@ -504,8 +565,7 @@ FDcResult TDcJsonWriter<CharType>::WriteArrayEnd()
 
 	Sb << CharType(']');
 
-	Details::EndWriteValuePosition(this);
-	return DcOk();
+	return Details::EndWriteValuePosition(this);
 }
 
 template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteInt8(const int8& Value) { return FDcJsonWriterDetails<CharType>::WriteI64Dispatch(this, Value); }
@@ -518,8 +578,8 @@ template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteUInt16(const
 template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteUInt32(const uint32& Value) { return FDcJsonWriterDetails<CharType>::WriteU64Dispatch(this, Value); }
 template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteUInt64(const uint64& Value) { return FDcJsonWriterDetails<CharType>::WriteU64Dispatch(this, Value); }
 
-template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteFloat(const float& Value) { return FDcJsonWriterDetails<CharType>::WriteNumericFmt(this, ActiveConfig().FloatFormatLiteral, Value); }
-template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteDouble(const double& Value) { return FDcJsonWriterDetails<CharType>::WriteNumericFmt(this, ActiveConfig().DoubleFormatLiteral, Value); }
+template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteFloat(const float& Value) { return FDcJsonWriterDetails<CharType>::WriteFloatDispatch(this, Value); }
+template<typename CharType> FDcResult TDcJsonWriter<CharType>::WriteDouble(const double& Value) { return FDcJsonWriterDetails<CharType>::WriteDoubleDispatch(this, Value); }
 
 template <typename CharType>
 void TDcJsonWriter<CharType>::FormatDiagnostic(FDcDiagnostic& Diag)
@@ -553,7 +613,29 @@ FDcResult TDcJsonWriter<CharType>::WriteRawStringValue(const FString& Value)
 
 	Details::BeginWriteValuePosition(this);
 	DcJsonWriterDetails::WriteSbStringDispatch(Sb, Value);
-	Details::EndWriteValuePosition(this);
+	return Details::EndWriteValuePosition(this);
+}
+
+template<typename CharType>
+FDcResult TDcJsonWriter<CharType>::SetSink(FDcSinkStream* InSink, int32 InFlushSize)
+{
+	DC_TRY(FlushSink());
+
+	Sink = InSink;
+	SinkFlushSize = InFlushSize;
+	return DcOk();
+}
+
+template<typename CharType>
+FDcResult TDcJsonWriter<CharType>::FlushSink()
+{
+	if (Sink == nullptr || Sb.Len() == 0)
+		return DcOk();
+
+	if (!DcJsonWriterDetails::WriteSinkDispatch(Sink, SinkBuf, Sb.GetData(), Sb.Len()))
+		return DC_FAIL(DcDReadWrite, SinkWriteFailed) << Sb.Len();
+
+	Sb.Reset();
 	return DcOk();
 }
 
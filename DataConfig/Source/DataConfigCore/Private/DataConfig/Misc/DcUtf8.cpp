@@ -0,0 +1,94 @@
+#include "DataConfig/Misc/DcUtf8.h"
+#include "DataConfig/Json/DcJsonScanDetails.h"
+
+namespace DcUtf8
+{
+
+int32 ScanAsciiRun(const uint8* Ptr, int32 Num)
+{
+	return DcJsonScanDetails::ScanAsciiRun(Ptr, Num);
+}
+
+bool Validate(const uint8* Ptr, int32 Num, int32& OutCharNum)
+{
+	int32 CharNum = 0;
+	int32 Ix = 0;
+	while (Ix < Num)
+	{
+		//	skip ascii runs by blocks then check one multi byte sequence
+		int32 Run = DcJsonScanDetails::ScanAsciiRun(Ptr + Ix, Num - Ix);
+		Ix += Run;
+		CharNum += Run;
+		if (Ix >= Num)
+			break;
+
+		uint8 Lead = Ptr[Ix];
+		int32 SeqNum;
+		uint8 SecondMin = 0x80;
+		uint8 SecondMax = 0xBF;
+		if (Lead >= 0xC2 && Lead <= 0xDF)
+		{
+			SeqNum = 2;
+		}
+		else if (Lead >= 0xE0 && Lead <= 0xEF)
+		{
+			SeqNum = 3;
+			if (Lead == 0xE0)
+				SecondMin = 0xA0;	//	overlong
+			else if (Lead == 0xED)
+				SecondMax = 0x9F;	//	surrogates
+		}
+		else if (Lead >= 0xF0 && Lead <= 0xF4)
+		{
+			SeqNum = 4;
+			if (Lead == 0xF0)
+				SecondMin = 0x90;	//	overlong
+			else if (Lead == 0xF4)
+				SecondMax = 0x8F;	//	above U+10FFFF
+		}
+		else
+		{
+			return false;
+		}
+
+		if (Ix + SeqNum > Num)
+			return false;
+
+		if (Ptr[Ix + 1] < SecondMin || Ptr[Ix + 1] > SecondMax)
+			return false;
+
+		for (int32 SeqIx = 2; SeqIx < SeqNum; SeqIx++)
+		{
+			if ((Ptr[Ix + SeqIx] & 0xC0) != 0x80)
+				return false;
+		}
+
+		CharNum += (SeqNum == 4 && sizeof(TCHAR) == 2) ? 2 : 1;
+		Ix += SeqNum;
+	}
+
+	OutCharNum = CharNum;
+	return true;
+}
+
+FString ToString(const uint8* Ptr, int32 Num, int32 CharNum)
+{
+	FString Ret;
+	if (CharNum == 0)
+		return Ret;
+
+	auto& Chars = Ret.GetCharArray();
+	Chars.SetNumUninitialized(CharNum + 1);
+	TCHAR* Out = Chars.GetData();
+	ForEachChar(Ptr, Num, [&Out](TCHAR Ch)
+	{
+		*Out++ = Ch;
+		return true;
+	});
+	check(Out == Chars.GetData() + CharNum);
+	*Out = TCHAR('\0');
+	return Ret;
+}
+
+} // namespace DcUtf8
+
@@ -4,6 +4,7 @@
 #include "DataConfig/Diagnostic/DcDiagnosticMsgPack.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/Misc/DcUtf8.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 
 namespace DcMsgPackReaderDetails
@@ -167,6 +168,72 @@ FORCEINLINE FDcResult ReadExtDispatch(FDcMsgPackReader* Self, uint8* OutType, FD
 	return EndTopRead(Self);
 }
 
+FORCEINLINE_DEBUGGABLE FDcResult ReadStringSize(FDcMsgPackReader* Self, int32* OutSize)
+{
+	uint8 TypeByte;
+	DC_TRY(ReadTypeByte(Self, &TypeByte));
+	if (TypeByte >= DcMsgPackCommon::MSGPACK_MINFIXSTR && TypeByte <= DcMsgPackCommon::MSGPACK_MAXFIXSTR)
+	{
+		*OutSize = 0b0001'1111 & TypeByte;
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR8)
+	{
+		uint8 Byte;
+		DC_TRY(Read1(Self, &Byte));
+		*OutSize = Byte;
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR16)
+	{
+		FDcBytes2 Bytes;
+		DC_TRY(ReadN(Self, &Bytes));
+		*OutSize = Bytes.As<uint16>();
+	}
+	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR32)
+	{
+		FDcBytes4 Bytes;
+		DC_TRY(ReadN(Self, &Bytes));
+		uint32 USize = Bytes.As<uint32>();
+		if (USize > (uint32)TNumericLimits<int32>::Max())
+			return DC_FAIL(DcDMsgPack, SizeOverInt32Max);
+
+		*OutSize = (int32)USize;
+	}
+	else
+	{
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch)
+			<< EDcDataEntry::String << DcMsgPackCommon::TypeByteToDataEntry(TypeByte);
+	}
+
+	return DcOk();
+}
+
+FORCEINLINE FDcResult ValidateUtf8(FDcMsgPackReader* Self, int32 AsciiNum, int32 Size, int32& OutCharNum)
+{
+	const uint8* Ptr = Self->View.DataPtr + Self->State.Index;
+	if (!DcUtf8::Validate(Ptr + AsciiNum, Size - AsciiNum, OutCharNum))
+		return DC_FAIL(DcDMsgPack, InvalidUtf8) << Self->State.Index;
+
+	OutCharNum += AsciiNum;
+	return DcOk();
+}
+
+template<typename TSize>
+FORCEINLINE FDcResult ReadSizeN(FDcMsgPackReader* Self, int64* OutSize)
+{
+	FDcFixedBytes<sizeof(TSize)> Bytes;
+	DC_TRY(ReadN(Self, &Bytes));
+	*OutSize = Bytes.template As<TSize>();
+	return DcOk();
+}
+
+FORCEINLINE FDcResult ReadSize1(FDcMsgPackReader* Self, int64* OutSize)
+{
+	uint8 Byte;
+	DC_TRY(Read1(Self, &Byte));
+	*OutSize = Byte;
+	return DcOk();
+}
+
 } // namespace DcMsgPackReaderDetails
 
 
@@ -264,47 +331,42 @@ FDcResult FDcMsgPackReader::ReadString(FString* OutPtr)
 {
 	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
 
-	uint8 TypeByte;
-	DC_TRY(DcMsgPackReaderDetails::ReadTypeByte(this, &TypeByte));
 	int32 Size;
-	if (TypeByte >= DcMsgPackCommon::MSGPACK_MINFIXSTR && TypeByte <= DcMsgPackCommon::MSGPACK_MAXFIXSTR)
+	DC_TRY(DcMsgPackReaderDetails::ReadStringSize(this, &Size));
+	DC_TRY(DcMsgPackReaderDetails::CheckNoEOF(this, Size));
+	if (OutPtr)
 	{
-		Size = 0b0001'1111 & TypeByte;
+		const uint8* Ptr = View.DataPtr + State.Index;
+		int32 CharNum;
+		DC_TRY(DcMsgPackReaderDetails::ValidateUtf8(this, 0, Size, CharNum));
+		*OutPtr = DcUtf8::ToString(Ptr, Size, CharNum);
 	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR8)
-	{
-		uint8 Byte;
-		DC_TRY(DcMsgPackReaderDetails::Read1(this, &Byte));
-		Size = Byte;
-	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR16)
-	{
-		FDcBytes2 Bytes;
-		DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
-		Size = Bytes.As<uint16>();
-	}
-	else if (TypeByte == DcMsgPackCommon::MSGPACK_STR32)
-	{
-		FDcBytes4 Bytes;
-		DC_TRY(DcMsgPackReaderDetails::ReadN(this, &Bytes));
-		uint32 USize = Bytes.As<uint32>();
-		if (USize > (uint32)TNumericLimits<int32>::Max())
-			return DC_FAIL(DcDMsgPack, SizeOverInt32Max);
 
-		Size = (int32)USize;
-	}
-	else
-	{
-		return DC_FAIL(DcDReadWrite, DataTypeMismatch)
-			<< EDcDataEntry::String << DcMsgPackCommon::TypeByteToDataEntry(TypeByte);
-	}
+	State.Index += Size;
+	return DcMsgPackReaderDetails::EndTopRead(this);
+}
 
+FDcResult FDcMsgPackReader::ReadStringView(FDcStringViewData* OutPtr)
+{
+	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
+
+	int32 Size;
+	DC_TRY(DcMsgPackReaderDetails::ReadStringSize(this, &Size));
 	DC_TRY(DcMsgPackReaderDetails::CheckNoEOF(this, Size));
 	if (OutPtr)
 	{
-		//	UTF8 conv when detects non ascii chars
-		FUTF8ToTCHAR UTF8Conv((const ANSICHAR*)(View.DataPtr + State.Index), Size);
-		*OutPtr = FString(UTF8Conv.Length(), UTF8Conv.Get());
+		const ANSICHAR* Ptr = (const ANSICHAR*)(View.DataPtr + State.Index);
+		int32 AsciiNum = DcUtf8::ScanAsciiRun(View.DataPtr + State.Index, Size);
+		if (AsciiNum == Size)
+		{
+			*OutPtr = FDcStringViewData::FromAscii(Ptr, Size);
+		}
+		else
+		{
+			int32 CharNum;
+			DC_TRY(DcMsgPackReaderDetails::ValidateUtf8(this, AsciiNum, Size, CharNum));
+			*OutPtr = FDcStringViewData::FromUtf8(Ptr, Size, CharNum);
+		}
 	}
 
 	State.Index += Size;
@@ -313,14 +375,14 @@ FDcResult FDcMsgPackReader::ReadString(FString* OutPtr)
 
 FDcResult FDcMsgPackReader::ReadName(FName* OutPtr)
 {
-	FString Str;
-	DC_TRY(ReadString(&Str));
+	FDcStringViewData Str;
+	DC_TRY(ReadStringView(&Str));
 
 	if (Str.Len() >= NAME_SIZE)
 		return DC_FAIL(DcDReadWrite, FNameOverSize);
 
 	if (OutPtr)
-		*OutPtr = FName(Str);
+		*OutPtr = Str.ToName();
 
 	return DcOk();
 }
@@ -481,6 +543,138 @@ FDcResult FDcMsgPackReader::ReadArrayEnd()
 	return DcMsgPackReaderDetails::EndTopRead(this);
 }
 
+FDcResult FDcMsgPackReader::PeekContainerSize(int32* OutPtr)
+{
+	if (States.Num() == 0)
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	const FReadState& TopState = States.Top();
+	//	every item takes at least 1 byte, clamp header sizes so a malformed
+	//	blob can't make downstream reserve huge buffers
+	int32 BytesLeft = FMath::Max(View.Num - State.Index, 0);
+	if (TopState.Type == EReadState::Array)
+		return ReadOutOk(OutPtr, FMath::Min(TopState.Remain, BytesLeft));
+	else if (TopState.Type == EReadState::Map)
+		return ReadOutOk(OutPtr, FMath::Min(TopState.Remain, BytesLeft / 2));
+	else
+		return ReadOutOk(OutPtr, INDEX_NONE);
+}
+
+FDcResult FDcMsgPackReader::SkipValue()
+{
+	using namespace DcMsgPackCommon;
+	using namespace DcMsgPackReaderDetails;
+
+	DC_TRY(CheckTopStateRemains(this));
+
+	//	values left to skip, containers add their items without being entered
+	int64 Pending = 1;
+	while (Pending > 0)
+	{
+		Pending--;
+
+		uint8 TypeByte;
+		DC_TRY(ReadTypeByte(this, &TypeByte));
+
+		int64 Size = 0;
+		if (TypeByte <= MSGPACK_MAXFIXINT || TypeByte >= MSGPACK_MINNEGATIVEFIXINT)
+		{
+			//	fixint has no payload
+		}
+		else if (TypeByte <= MSGPACK_MAXFIXMAP)
+			Pending += 2 * (TypeByte & 0b1111);
+		else if (TypeByte <= MSGPACK_MAXFIXARRAY)
+			Pending += TypeByte & 0b1111;
+		else if (TypeByte <= MSGPACK_MAXFIXSTR)
+			Size = TypeByte & 0b0001'1111;
+		else
+		{
+			int64 Count = 0;
+			switch (TypeByte)
+			{
+				case MSGPACK_NIL:
+				case MSGPACK_FALSE:
+				case MSGPACK_TRUE:
+					break;
+				case MSGPACK_BIN8:
+				case MSGPACK_STR8:
+					DC_TRY(ReadSize1(this, &Size));
+					break;
+				case MSGPACK_BIN16:
+				case MSGPACK_STR16:
+					DC_TRY(ReadSizeN<uint16>(this, &Size));
+					break;
+				case MSGPACK_BIN32:
+				case MSGPACK_STR32:
+					DC_TRY(ReadSizeN<uint32>(this, &Size));
+					break;
+				//	ext has an extra type byte before data
+				case MSGPACK_EXT8:
+					DC_TRY(ReadSize1(this, &Size));
+					Size += 1;
+					break;
+				case MSGPACK_EXT16:
+					DC_TRY(ReadSizeN<uint16>(this, &Size));
+					Size += 1;
+					break;
+				case MSGPACK_EXT32:
+					DC_TRY(ReadSizeN<uint32>(this, &Size));
+					Size += 1;
+					break;
+				case MSGPACK_UINT8:
+				case MSGPACK_INT8:
+					Size = 1;
+					break;
+				case MSGPACK_UINT16:
+				case MSGPACK_INT16:
+					Size = 2;
+					break;
+				case MSGPACK_FLOAT32:
+				case MSGPACK_UINT32:
+				case MSGPACK_INT32:
+					Size = 4;
+					break;
+				case MSGPACK_FLOAT64:
+				case MSGPACK_UINT64:
+				case MSGPACK_INT64:
+					Size = 8;
+					break;
+				case MSGPACK_FIXEXT1: Size = 1 + 1; break;
+				case MSGPACK_FIXEXT2: Size = 1 + 2; break;
+				case MSGPACK_FIXEXT4: Size = 1 + 4; break;
+				case MSGPACK_FIXEXT8: Size = 1 + 8; break;
+				case MSGPACK_FIXEXT16: Size = 1 + 16; break;
+				case MSGPACK_ARRAY16:
+					DC_TRY(ReadSizeN<uint16>(this, &Count));
+					Pending += Count;
+					break;
+				case MSGPACK_ARRAY32:
+					DC_TRY(ReadSizeN<uint32>(this, &Count));
+					Pending += Count;
+					break;
+				case MSGPACK_MAP16:
+					DC_TRY(ReadSizeN<uint16>(this, &Count));
+					Pending += 2 * Count;
+					break;
+				case MSGPACK_MAP32:
+					DC_TRY(ReadSizeN<uint32>(this, &Count));
+					Pending += 2 * Count;
+					break;
+				default:
+					return DC_FAIL(DcDMsgPack, UnknownMsgTypeByte)
+						<< FString::Printf(TEXT("%x"), TypeByte);
+			}
+		}
+
+		if (Size > View.Num - State.Index)
+			return DC_FAIL(DcDMsgPack, ReadingPastEnd);
+
+		State.Index += (int32)Size;
+	}
+
+	return EndTopRead(this);
+}
+
 FDcResult FDcMsgPackReader::ReadInt8(int8* OutPtr)
 {
 	DC_TRY(DcMsgPackReaderDetails::CheckTopStateRemains(this));
@@ -644,3 +838,18 @@ void FDcMsgPackReader::FormatDiagnostic(FDcDiagnostic& Diag)
 	Diag << MoveTemp(Highlight);
 }
 
+FDcResult FDcMappedMsgPackReader::OpenFile(const TCHAR* Path)
+{
+	//	`File.Open` drops the old mapping first, so never leave the view pointing
+	//	into it even if opening fails
+	View = FDcBlobViewData{nullptr, 0};
+	States.Reset();
+	States.Add({EReadState::Root, false, 0});
+	State.Reset();
+
+	DC_TRY(File.Open(Path));
+
+	View = FDcBlobViewData{const_cast<uint8*>(File.GetData()), File.Num()};
+	return DcOk();
+}
+
@@ -2,7 +2,10 @@
 #include "DataConfig/MsgPack/DcMsgPackCommon.h"
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticMsgPack.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/Misc/DcUtf8.h"
+#include "Misc/EngineVersionComparison.h"
 
 namespace DcMsgPackWriterDetails
 {
@@ -18,11 +21,9 @@ static FORCEINLINE uint8 Mask_3b_5b(uint8 Lhs, uint8 Rhs)
 }
 
 template<typename TNumeric>
-static FORCEINLINE void WriteNumber(FDcMsgPackWriter::BufferType& Buffer, TNumeric Value)
+static FORCEINLINE void WriteNumberAt(uint8* StartPtr, TNumeric Value)
 {
 	constexpr int Size = sizeof(TNumeric);
-	int StartIx = Buffer.AddUninitialized(Size);
-	uint8* StartPtr = Buffer.GetData() + StartIx;
 	FPlatformMemory::Memcpy(StartPtr, &Value, Size);
 
 #if PLATFORM_LITTLE_ENDIAN
@@ -30,7 +31,59 @@ static FORCEINLINE void WriteNumber(FDcMsgPackWriter::BufferType& Buffer, TNumer
 #endif
 }
 
-static FORCEINLINE_DEBUGGABLE void EndWriteValuePosition(FDcMsgPackWriter* Self)
+template<typename TNumeric>
+static FORCEINLINE void WriteNumber(FDcMsgPackWriter::BufferType& Buffer, TNumeric Value)
+{
+	int StartIx = Buffer.AddUninitialized(sizeof(TNumeric));
+	WriteNumberAt(Buffer.GetData() + StartIx, Value);
+}
+
+static constexpr int32 MaxHeaderLen = 1 + sizeof(uint32);
+
+//	move bytes between headers down over unused header bytes, in one pass over `Buffer`.
+//	headers of open containers are written at 32bit width with a zero size, to be patched in sink
+static void CompactHeaders(FDcMsgPackWriter* Self)
+{
+	TArray<FDcMsgPackWriter::FPendingHeader>& Headers = Self->PendingHeaders;
+	if (Headers.Num() == 0)
+		return;
+
+	FDcMsgPackWriter::BufferType& Buffer = Self->Buffer;
+	uint8* Data = Buffer.GetData();
+	int32 WriteIx = Headers[0].HeaderIx;
+	int32 ReadIx = Headers[0].HeaderIx;
+	for (FDcMsgPackWriter::FPendingHeader& Header : Headers)
+	{
+		int32 SegLen = Header.HeaderIx - ReadIx;
+		FPlatformMemory::Memmove(Data + WriteIx, Data + ReadIx, SegLen);
+		WriteIx += SegLen;
+
+		if (Header.Len == 0)
+		{
+			FDcMsgPackWriter::FWriteState& State = Self->States[Header.StateIx];
+			State.HeaderIx = WriteIx;
+			State.PendingIx = INDEX_NONE;
+
+			Header.Len = MaxHeaderLen;
+			FPlatformMemory::Memzero(Header.Bytes + 1, MaxHeaderLen - 1);
+		}
+
+		FPlatformMemory::Memcpy(Data + WriteIx, Header.Bytes, Header.Len);
+		WriteIx += Header.Len;
+		ReadIx = Header.HeaderIx + MaxHeaderLen;
+	}
+
+	int32 TailLen = Buffer.Num() - ReadIx;
+	FPlatformMemory::Memmove(Data + WriteIx, Data + ReadIx, TailLen);
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	Buffer.SetNum(WriteIx + TailLen, false);
+#else
+	Buffer.SetNum(WriteIx + TailLen, EAllowShrinking::No);
+#endif
+	Headers.Reset();
+}
+
+static FORCEINLINE_DEBUGGABLE FDcResult EndWriteValuePosition(FDcMsgPackWriter* Self)
 {
 	FDcMsgPackWriter::FWriteState& TopState = Self->States.Top();
 	if (TopState.Type == FDcMsgPackWriter::EWriteState::Array)
@@ -51,14 +104,79 @@ static FORCEINLINE_DEBUGGABLE void EndWriteValuePosition(FDcMsgPackWriter* Self)
 	}
 	else
 	{
-		// pass
+		//	root level value done and all its headers are known
+		CompactHeaders(Self);
 	}
+
+	//	root level values are done, with patched headers the finished part of open containers can go too
+	if (Self->Sink
+		&& Self->Buffer.Num() >= Self->SinkFlushSize
+		&& (TopState.Type == FDcMsgPackWriter::EWriteState::Root || Self->bSinkPatchHeaders))
+		return Self->FlushSink();
+
+	return DcOk();
 }
 
-static FORCEINLINE_DEBUGGABLE void WriteTypeByte(FDcMsgPackWriter::FWriteState& State, uint8 TypeByte)
+static FORCEINLINE_DEBUGGABLE void WriteTypeByte(FDcMsgPackWriter* Self, uint8 TypeByte)
 {
-	State.Buffer.Add(TypeByte);
-	State.LastTypeByte = TypeByte;
+	Self->Buffer.Add(TypeByte);
+	Self->States.Top().LastTypeByte = TypeByte;
+}
+
+static FORCEINLINE_DEBUGGABLE void BeginContainer(FDcMsgPackWriter* Self, FDcMsgPackWriter::EWriteState Type, uint8 Type32)
+{
+	//	reserve max header width so ending a container never shifts its body
+	int32 HeaderIx = Self->Buffer.AddUninitialized(MaxHeaderLen);
+	FDcMsgPackWriter::FPendingHeader& Header = Self->PendingHeaders.AddDefaulted_GetRef();
+	Header.HeaderIx = HeaderIx;
+	Header.StateIx = Self->States.Num();
+	Header.Len = 0;
+	Header.Bytes[0] = Type32;
+
+	Self->States.Add({Type, false, 0, 0, HeaderIx, Self->PendingHeaders.Num() - 1});
+}
+
+static FDcResult EndContainer(FDcMsgPackWriter* Self, uint8 FixType, uint8 Type16, uint8 Type32)
+{
+	FDcMsgPackWriter::FWriteState TopState = Self->States.Pop();
+
+	if (TopState.PendingIx == INDEX_NONE)
+	{
+		//	header is already flushed at 32bit width, patch it in sink
+		check(TopState.HeaderIx < 0);
+		uint8 Header[MaxHeaderLen];
+		Header[0] = Type32;
+		WriteNumberAt(Header + 1, (uint32)TopState.Size);
+
+		if (!Self->Sink->Patch(-TopState.HeaderIx, Header, sizeof(Header)))
+			return DC_FAIL(DcDReadWrite, SinkWriteFailed) << (int32)sizeof(Header);
+
+		Self->States.Top().LastTypeByte = Type32;
+		return DcOk();
+	}
+
+	//	encode the minimal header, it's moved into place by `CompactHeaders`
+	FDcMsgPackWriter::FPendingHeader& Header = Self->PendingHeaders[TopState.PendingIx];
+	if (TopState.Size <= 0b1111)
+	{
+		Header.Bytes[0] = Mask_4b_4b(FixType, (uint8)TopState.Size);
+		Header.Len = 1;
+	}
+	else if (TopState.Size <= 0xFFFF)
+	{
+		Header.Bytes[0] = Type16;
+		WriteNumberAt(Header.Bytes + 1, (uint16)TopState.Size);
+		Header.Len = 1 + sizeof(uint16);
+	}
+	else
+	{
+		Header.Bytes[0] = Type32;
+		WriteNumberAt(Header.Bytes + 1, (uint32)TopState.Size);
+		Header.Len = 1 + sizeof(uint32);
+	}
+
+	Self->States.Top().LastTypeByte = Header.Bytes[0];
+	return DcOk();
 }
 
 template<int N>
@@ -101,12 +219,18 @@ FORCEINLINE bool IsValidWriteScalar(EDcDataEntry Entry)
 
 FDcMsgPackWriter::BufferType& FDcMsgPackWriter::GetMainBuffer()
 {
-	return States[0].Buffer;
+	return Buffer;
 }
 
 FDcMsgPackWriter::FDcMsgPackWriter()
 {
-	States.Add({EWriteState::Root, 0});
+	States.Add({EWriteState::Root, false, 0, 0, INDEX_NONE, INDEX_NONE});
+}
+
+FDcMsgPackWriter::FDcMsgPackWriter(int32 SizeHint)
+	: FDcMsgPackWriter()
+{
+	Buffer.Reserve(SizeHint);
 }
 
 FDcResult FDcMsgPackWriter::PeekWrite(EDcDataEntry Next, bool* bOutOk)
@@ -146,57 +270,53 @@ FDcResult FDcMsgPackWriter::PeekWrite(EDcDataEntry Next, bool* bOutOk)
 
 FDcResult FDcMsgPackWriter::WriteNone()
 {
-	DcMsgPackWriterDetails::WriteTypeByte(States.Top(), DcMsgPackCommon::MSGPACK_NIL);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_NIL);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteBool(bool Value)
 {
-	DcMsgPackWriterDetails::WriteTypeByte(States.Top(), Value
+	DcMsgPackWriterDetails::WriteTypeByte(this, Value
 		? DcMsgPackCommon::MSGPACK_TRUE : DcMsgPackCommon::MSGPACK_FALSE
 	);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteString(const FString& Value)
 {
-	FWriteState& TopState = States.Top();
-	FTCHARToUTF8 Encoded(*Value);
-	int Len = Encoded.Length();
-	const uint8* Bytes = (const uint8*)Encoded.Get();
+	//	size the UTF8 bytes first then encode straight into `Buffer`
+	int Len = 0;
+	DcUtf8::EncodeChars(*Value, Value.Len(), [&Len](ANSICHAR) { Len++; });
 	if (Len <= 0b11111)
 	{
 		DcMsgPackWriterDetails::WriteTypeByte(
-			TopState,
+			this,
 			DcMsgPackWriterDetails::Mask_3b_5b(
 				DcMsgPackCommon::MSGPACK_MINFIXSTR,
 				(uint8)Len
 		));
-		TopState.Buffer.Append(Bytes, Len);
 	}
 	else if (Len <= 0xFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_STR8);
-		TopState.Buffer.Add((uint8)Len);
-		TopState.Buffer.Append(Bytes, Len);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_STR8);
+		Buffer.Add((uint8)Len);
 	}
 	else if (Len <= 0xFFFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_STR16);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, (uint16)Len);
-		TopState.Buffer.Append(Bytes, Len);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_STR16);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, (uint16)Len);
 	}
 	else
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_STR32);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, (uint32)Len);
-		TopState.Buffer.Append(Bytes, Len);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_STR32);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, (uint32)Len);
 	}
 
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	int32 BytesIx = Buffer.AddUninitialized(Len);
+	uint8* Bytes = Buffer.GetData() + BytesIx;
+	DcUtf8::EncodeChars(*Value, Value.Len(), [&Bytes](ANSICHAR Ch) { *Bytes++ = (uint8)Ch; });
+
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteName(const FName& Name)
@@ -211,33 +331,31 @@ FDcResult FDcMsgPackWriter::WriteText(const FText& Value)
 
 FDcResult FDcMsgPackWriter::WriteBlob(const FDcBlobViewData& Value)
 {
-	FWriteState& TopState = States.Top();
 	if (Value.Num <= 0xFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_BIN8);
-		TopState.Buffer.Add((uint8)Value.Num);
-		TopState.Buffer.Append(Value.DataPtr, Value.Num);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_BIN8);
+		Buffer.Add((uint8)Value.Num);
+		Buffer.Append(Value.DataPtr, Value.Num);
 	}
 	else if (Value.Num <= 0xFFFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_BIN16);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, (uint16)Value.Num);
-		TopState.Buffer.Append(Value.DataPtr, Value.Num);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_BIN16);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, (uint16)Value.Num);
+		Buffer.Append(Value.DataPtr, Value.Num);
 	}
 	else
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_BIN32);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, (uint32)Value.Num);
-		TopState.Buffer.Append(Value.DataPtr, Value.Num);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_BIN32);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, (uint32)Value.Num);
+		Buffer.Append(Value.DataPtr, Value.Num);
 	}
 
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteMapRoot()
 {
-	States.Add({EWriteState::Map, 0, false});
+	DcMsgPackWriterDetails::BeginContainer(this, EWriteState::Map, DcMsgPackCommon::MSGPACK_MAP32);
 	return DcOk();
 }
 
@@ -248,39 +366,18 @@ FDcResult FDcMsgPackWriter::WriteMapEnd()
 		|| TopState.bMapAtValue)
 		return DC_FAIL(DcDMsgPack, UnexpectedMapEnd);
 
-	FWriteState& ParentState = States.Last(1);
-	if (TopState.Size <= 0b1111)
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(
-			ParentState,
-			DcMsgPackWriterDetails::Mask_4b_4b(
-				DcMsgPackCommon::MSGPACK_MINFIXMAP,
-				(uint8)TopState.Size
-		));
-	}
-	else if (TopState.Size <= 0xFFFF)
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(ParentState, DcMsgPackCommon::MSGPACK_MAP16);
-		DcMsgPackWriterDetails::WriteNumber(ParentState.Buffer, (uint16)TopState.Size);
-	}
-	else
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(ParentState, DcMsgPackCommon::MSGPACK_MAP32);
-		DcMsgPackWriterDetails::WriteNumber(ParentState.Buffer, (uint32)TopState.Size);
-	}
+	DC_TRY(DcMsgPackWriterDetails::EndContainer(this,
+		DcMsgPackCommon::MSGPACK_MINFIXMAP,
+		DcMsgPackCommon::MSGPACK_MAP16,
+		DcMsgPackCommon::MSGPACK_MAP32
+	));
 
-	ParentState.Buffer.Append(TopState.Buffer.GetData(), TopState.Buffer.Num());
-
-	// note buffers can shrink, reassign CurBuffer from top
-	States.RemoveAt(States.Num() - 1);
-
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteArrayRoot()
 {
-	States.Add({EWriteState::Array, 0});
+	DcMsgPackWriterDetails::BeginContainer(this, EWriteState::Array, DcMsgPackCommon::MSGPACK_ARRAY32);
 	return DcOk();
 }
 
@@ -290,220 +387,217 @@ FDcResult FDcMsgPackWriter::WriteArrayEnd()
 	if (TopState.Type != EWriteState::Array)
 		return DC_FAIL(DcDMsgPack, UnexpectedArrayEnd);
 
-	FWriteState& ParentState = States.Last(1);
-	if (TopState.Size <= 0b1111)
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(
-			ParentState,
-			DcMsgPackWriterDetails::Mask_4b_4b(
-				DcMsgPackCommon::MSGPACK_MINFIXARRAY,
-				(uint8)TopState.Size
-		));
-	}
-	else if (TopState.Size <= 0xFFFF)
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(ParentState, DcMsgPackCommon::MSGPACK_ARRAY16);
-		DcMsgPackWriterDetails::WriteNumber(ParentState.Buffer, (uint16)TopState.Size);
-	}
-	else
-	{
-		DcMsgPackWriterDetails::WriteTypeByte(ParentState, DcMsgPackCommon::MSGPACK_ARRAY32);
-		DcMsgPackWriterDetails::WriteNumber(ParentState.Buffer, (uint32)TopState.Size);
-	}
-
-	ParentState.Buffer.Append(TopState.Buffer.GetData(), TopState.Buffer.Num());
+	DC_TRY(DcMsgPackWriterDetails::EndContainer(this,
+		DcMsgPackCommon::MSGPACK_MINFIXARRAY,
+		DcMsgPackCommon::MSGPACK_ARRAY16,
+		DcMsgPackCommon::MSGPACK_ARRAY32
+	));
 
-	// note buffers can shrink, reassign CurBuffer from top
-	States.RemoveAt(States.Num() - 1);
-
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteUInt8(const uint8& Value)
 {
-	FWriteState& TopState = States.Top();
 	if (Value < 128)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, Value);
+		DcMsgPackWriterDetails::WriteTypeByte(this, Value);
 	}
 	else
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_UINT8);
-		TopState.Buffer.Add(Value);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_UINT8);
+		Buffer.Add(Value);
 	}
 
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteUInt16(const uint16& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_UINT16);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_UINT16);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteUInt32(const uint32& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_UINT32);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_UINT32);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteUInt64(const uint64& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_UINT64);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_UINT64);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteInt8(const int8& Value)
 {
-	FWriteState& TopState = States.Top();
 	if (Value >= -32)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, Value);
+		DcMsgPackWriterDetails::WriteTypeByte(this, Value);
 	}
 	else
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_INT8);
-		TopState.Buffer.Add(Value);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_INT8);
+		Buffer.Add(Value);
 	}
 
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteInt16(const int16& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_INT16);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_INT16);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteInt32(const int32& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_INT32);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_INT32);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteInt64(const int64& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_INT64);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_INT64);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFloat(const float& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FLOAT32);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FLOAT32);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteDouble(const double& Value)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FLOAT64);
-	DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Value);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FLOAT64);
+	DcMsgPackWriterDetails::WriteNumber(Buffer, Value);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFixExt1(uint8 Type, uint8 Byte)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FIXEXT1);
-	TopState.Buffer.Add(Type);
-	TopState.Buffer.Add(Byte);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FIXEXT1);
+	Buffer.Add(Type);
+	Buffer.Add(Byte);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFixExt2(uint8 Type, FDcBytes2 Bytes)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FIXEXT2);
-	TopState.Buffer.Add(Type);
-	DcMsgPackWriterDetails::WriteFixExt(TopState.Buffer, Bytes);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FIXEXT2);
+	Buffer.Add(Type);
+	DcMsgPackWriterDetails::WriteFixExt(Buffer, Bytes);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFixExt4(uint8 Type, FDcBytes4 Bytes)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FIXEXT4);
-	TopState.Buffer.Add(Type);
-	DcMsgPackWriterDetails::WriteFixExt(TopState.Buffer, Bytes);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FIXEXT4);
+	Buffer.Add(Type);
+	DcMsgPackWriterDetails::WriteFixExt(Buffer, Bytes);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFixExt8(uint8 Type, FDcBytes8 Bytes)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FIXEXT8);
-	TopState.Buffer.Add(Type);
-	DcMsgPackWriterDetails::WriteFixExt(TopState.Buffer, Bytes);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FIXEXT8);
+	Buffer.Add(Type);
+	DcMsgPackWriterDetails::WriteFixExt(Buffer, Bytes);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 FDcResult FDcMsgPackWriter::WriteFixExt16(uint8 Type, FDcBytes16 Bytes)
 {
-	FWriteState& TopState = States.Top();
-	DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_FIXEXT16);
-	TopState.Buffer.Add(Type);
-	DcMsgPackWriterDetails::WriteFixExt(TopState.Buffer, Bytes);
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
-	return DcOk();
+	DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_FIXEXT16);
+	Buffer.Add(Type);
+	DcMsgPackWriterDetails::WriteFixExt(Buffer, Bytes);
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
 }
 
 
 FDcResult FDcMsgPackWriter::WriteExt(uint8 Type, FDcBlobViewData Blob)
 {
-	FWriteState& TopState = States.Top();
 	int Size = Blob.Num;
 	if (Size <= 0xFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_EXT8);
-		TopState.Buffer.Add(Size);
-		TopState.Buffer.Add(Type);
-		TopState.Buffer.Append(Blob.DataPtr, Size);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_EXT8);
+		Buffer.Add(Size);
+		Buffer.Add(Type);
+		Buffer.Append(Blob.DataPtr, Size);
 	}
 	else if (Size <= 0xFFFF)
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_EXT16);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, (uint16)Size);
-		TopState.Buffer.Add(Type);
-		TopState.Buffer.Append(Blob.DataPtr, Size);
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_EXT16);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, (uint16)Size);
+		Buffer.Add(Type);
+		Buffer.Append(Blob.DataPtr, Size);
+	}
+	else
+	{
+		DcMsgPackWriterDetails::WriteTypeByte(this, DcMsgPackCommon::MSGPACK_EXT32);
+		DcMsgPackWriterDetails::WriteNumber(Buffer, Size);
+		Buffer.Add(Type);
+		Buffer.Append(Blob.DataPtr, Size);
+	}
+
+	return DcMsgPackWriterDetails::EndWriteValuePosition(this);
+}
+
+FDcResult FDcMsgPackWriter::SetSink(FDcSinkStream* InSink, int32 InFlushSize)
+{
+	//	flushed headers are patched in the current sink
+	for (int32 Ix = 1; Ix < States.Num(); Ix++)
+		checkf(States[Ix].PendingIx != INDEX_NONE, TEXT("can't change sink with flushed open containers"));
+	DC_TRY(FlushSink());
+
+	Sink = InSink;
+	SinkFlushSize = InFlushSize;
+	bSinkPatchHeaders = Sink != nullptr && Sink->CanPatch();
+	return DcOk();
+}
+
+FDcResult FDcMsgPackWriter::FlushSink()
+{
+	if (Sink == nullptr)
+		return DcOk();
+
+	int32 FlushNum;
+	if (bSinkPatchHeaders)
+	{
+		//	open containers are widened to be patched in sink later
+		DcMsgPackWriterDetails::CompactHeaders(this);
+		FlushNum = Buffer.Num();
 	}
 	else
 	{
-		DcMsgPackWriterDetails::WriteTypeByte(TopState, DcMsgPackCommon::MSGPACK_EXT32);
-		DcMsgPackWriterDetails::WriteNumber(TopState.Buffer, Size);
-		TopState.Buffer.Add(Type);
-		TopState.Buffer.Append(Blob.DataPtr, Size);
+		//	stop at the outermost open container as its header is patched in `Buffer`
+		FlushNum = States.Num() > 1 ? (int32)States[1].HeaderIx : Buffer.Num();
 	}
 
-	DcMsgPackWriterDetails::EndWriteValuePosition(this);
+	if (FlushNum == 0)
+		return DcOk();
+
+	if (!Sink->Write(Buffer.GetData(), FlushNum))
+		return DC_FAIL(DcDReadWrite, SinkWriteFailed) << FlushNum;
+
+	if (FlushNum == Buffer.Num())
+		Buffer.Reset();
+	else
+		Buffer.RemoveAt(0, FlushNum);
+
+	for (int32 Ix = 1; Ix < States.Num(); Ix++)
+		States[Ix].HeaderIx -= FlushNum;
+	for (FPendingHeader& Header : PendingHeaders)
+		Header.HeaderIx -= FlushNum;
+
 	return DcOk();
 }
 
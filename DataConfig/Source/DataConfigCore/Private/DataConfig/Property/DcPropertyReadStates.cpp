@@ -52,7 +52,7 @@ FDcResult FDcReadStateNone::PeekRead(FDcPropertyReader* Parent, EDcDataEntry* Ou
 	return DcOk();
 }
 
-void FDcReadStateNone::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateNone::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatNone(OutSegments, SegType);
 }
@@ -158,7 +158,7 @@ FDcResult FDcReadStateClass::ReadDataEntry(FDcPropertyReader* Parent, FFieldClas
 	}
 }
 
-void FDcReadStateClass::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateClass::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatClass(OutSegments, SegType, ObjectName, Class, Property);
 }
@@ -200,7 +200,11 @@ FDcResult FDcReadStateClass::ReadClassRootAccess(FDcPropertyReader* Parent, FDcC
 				Access.Name = Cls->GetFName();
 				Access.Control = FDcClassAccess::EControl::ExpandObject;
 
-				Property = Parent->Config.FirstProcessProperty(Cls->PropertyLink);
+				Table = Parent->Config.FindTable(Cls);
+				PropertyIx = 0;
+				Property = Table
+					? Table->GetProperty(0)
+					: Parent->Config.FirstProcessProperty(Cls->PropertyLink);
 				if (Property == nullptr)
 				{
 					State = EState::ExpectEnd;
@@ -292,7 +296,9 @@ FDcResult FDcReadStateClass::SkipRead(FDcPropertyReader* Parent)
 void FDcReadStateClass::EndValueRead(FDcPropertyReader* Parent)
 {
 	check(State == EState::ExpectValue);
-	Property = Parent->Config.NextProcessProperty(Property);
+	Property = Table
+		? Table->GetProperty(++PropertyIx)
+		: Parent->Config.NextProcessProperty(Property);
 	if (Property == nullptr)
 		State = EState::ExpectEnd;
 	else
@@ -429,7 +435,7 @@ FDcResult FDcReadStateStruct::ReadDataEntry(FDcPropertyReader* Parent, FFieldCla
 	}
 }
 
-void FDcReadStateStruct::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateStruct::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatStruct(OutSegments, SegType, StructName, StructClass, Property);
 }
@@ -441,7 +447,11 @@ FDcResult FDcReadStateStruct::ReadStructRootAccess(FDcPropertyReader* Parent, FD
 	{
 		Access.Name = StructClass->GetFName();
 
-		Property = Parent->Config.FirstProcessProperty(StructClass->PropertyLink);
+		Table = Parent->Config.FindTable(StructClass);
+		PropertyIx = 0;
+		Property = Table
+			? Table->GetProperty(0)
+			: Parent->Config.FirstProcessProperty(StructClass->PropertyLink);
 		if (Property == nullptr)
 		{
 			State = EState::ExpectEnd;
@@ -493,7 +503,9 @@ FDcResult FDcReadStateStruct::SkipRead(FDcPropertyReader* Parent)
 void FDcReadStateStruct::EndValueRead(FDcPropertyReader* Parent)
 {
 	check(State == EState::ExpectValue)
-	Property = Parent->Config.NextProcessProperty(Property);
+	Property = Table
+		? Table->GetProperty(++PropertyIx)
+		: Parent->Config.NextProcessProperty(Property);
 	if (Property == nullptr)
 		State = EState::ExpectEnd;
 	else
@@ -626,7 +638,7 @@ FDcResult FDcReadStateMap::ReadDataEntry(FDcPropertyReader* Parent, FFieldClass*
 	}
 }
 
-void FDcReadStateMap::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateMap::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatMap(OutSegments, SegType, MapName, MapHelper.KeyProp, MapHelper.ValueProp, Index,
 		State == EState::ExpectKey || State == EState::ExpectValue);
@@ -814,7 +826,7 @@ FDcResult FDcReadStateArray::ReadDataEntry(FDcPropertyReader* Parent, FFieldClas
 	return DcOk();
 }
 
-void FDcReadStateArray::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateArray::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	auto& ArrayAccess = (DcSerDeCommon::FScriptArrayHelperAccess&)ArrayHelper;
 	DcPropertyHighlight::FormatArray(OutSegments, SegType, ArrayName, ArrayAccess.InnerProperty, Index,
@@ -989,7 +1001,7 @@ FDcResult FDcReadStateSet::ReadDataEntry(FDcPropertyReader* Parent, FFieldClass*
 	return DcOk();
 }
 
-void FDcReadStateSet::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateSet::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatSet(OutSegments, SegType, SetName, SetHelper.ElementProp, Index,
 		State == EState::ExpectItem);
@@ -1245,7 +1257,7 @@ FDcResult FDcReadStateOptional::ReadOptionalEnd(FDcPropertyReader* Parent)
 	}
 }
 
-void FDcReadStateOptional::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateOptional::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatOptional(OutSegments, SegType, OptionalProperty->GetFName(), OptionalProperty->GetValueProperty());
 }
@@ -1392,7 +1404,7 @@ FDcResult FDcReadStateScalar::ReadArrayEnd(FDcPropertyReader* Parent)
 }
 
 
-void FDcReadStateScalar::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcReadStateScalar::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatScalar(OutSegments, SegType, ScalarField, Index, State == EState::ExpectArrayItem);
 }
@@ -2,6 +2,7 @@
 
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Property/DcPropertyTypes.h"
 #include "DataConfig/Property/DcPropertyStatesCommon.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "Misc/EngineVersionComparison.h"
@@ -33,7 +34,7 @@ struct FDcBaseReadState
 	virtual FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty);
 	virtual FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr);
 
-	virtual void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) = 0;
+	virtual void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) = 0;
 
 	template<typename T>
 	T* As();
@@ -59,7 +60,7 @@ struct FDcReadStateNone : public FDcBaseReadState
 
 	EDcPropertyReadType GetType() override;
 	FDcResult PeekRead(FDcPropertyReader* Parent, EDcDataEntry* OutPtr) override;
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcReadStateClass : public FDcBaseReadState
@@ -71,6 +72,9 @@ struct FDcReadStateClass : public FDcBaseReadState
 	UClass* Class;
 	FProperty* Property;
 
+	const FDcPropertyTable* Table;
+	int32 PropertyIx;
+
 	enum class EState : uint16
 	{
 		ExpectRoot,
@@ -97,6 +101,8 @@ struct FDcReadStateClass : public FDcBaseReadState
 		ClassObject = InClassObject;
 		Class = InClass;
 		Property = nullptr;
+		Table = nullptr;
+		PropertyIx = 0;
 		State = EState::ExpectRoot;
 		Type = InType;
 	}
@@ -105,7 +111,7 @@ struct FDcReadStateClass : public FDcBaseReadState
 	FDcResult PeekRead(FDcPropertyReader* Parent, EDcDataEntry* OutPtr) override;
 	FDcResult ReadName(FDcPropertyReader* Parent, FName* OutNamePtr) override;
 	FDcResult ReadDataEntry(FDcPropertyReader* Parent, FFieldClass* ExpectedPropertyClass, FDcPropertyDatum& OutDatum) override;
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 	FDcResult SkipRead(FDcPropertyReader* Parent) override;
 	FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty) override;
 	FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr) override;
@@ -126,6 +132,9 @@ struct FDcReadStateStruct : public FDcBaseReadState
 	UScriptStruct* StructClass;
 	FProperty* Property;
 
+	const FDcPropertyTable* Table;
+	int32 PropertyIx;
+
 	enum class EState
 	{
 		ExpectRoot,
@@ -143,6 +152,8 @@ struct FDcReadStateStruct : public FDcBaseReadState
 		StructPtr = InStructPtr;
 		StructClass = InStructClass;
 		Property = nullptr;
+		Table = nullptr;
+		PropertyIx = 0;
 		State = EState::ExpectRoot;
 	}
 
@@ -150,7 +161,7 @@ struct FDcReadStateStruct : public FDcBaseReadState
 	FDcResult PeekRead(FDcPropertyReader* Parent, EDcDataEntry* OutPtr) override;
 	FDcResult ReadName(FDcPropertyReader* Parent, FName* OutNamePtr) override;
 	FDcResult ReadDataEntry(FDcPropertyReader* Parent, FFieldClass* ExpectedPropertyClass, FDcPropertyDatum& OutDatum) override;
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 	FDcResult SkipRead(FDcPropertyReader* Parent) override;
 	FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty) override;
 	FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr) override;
@@ -200,7 +211,7 @@ struct FDcReadStateMap : public FDcBaseReadState
 	FDcResult PeekRead(FDcPropertyReader* Parent, EDcDataEntry* OutPtr) override;
 	FDcResult ReadName(FDcPropertyReader* Parent, FName* OutNamePtr) override;
 	FDcResult ReadDataEntry(FDcPropertyReader* Parent, FFieldClass* ExpectedPropertyClass, FDcPropertyDatum& OutDatum) override;
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 	FDcResult SkipRead(FDcPropertyReader* Parent) override;
 	FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty) override;
 	FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr) override;
@@ -245,7 +256,7 @@ struct FDcReadStateArray : public FDcBaseReadState
 	FDcResult PeekRead(FDcPropertyReader* Parent, EDcDataEntry* OutPtr) override;
 	FDcResult ReadName(FDcPropertyReader* Parent, FName* OutNamePtr) override;
 	FDcResult ReadDataEntry(FDcPropertyReader* Parent, FFieldClass* ExpectedPropertyClass, FDcPropertyDatum& OutDatum) override;
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 	FDcResult SkipRead(FDcPropertyReader* Parent) override;
 	FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty) override;
 	FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr) override;
@@ -296,7 +307,7 @@ struct FDcReadStateSet : public FDcBaseReadState
 	FDcResult PeekReadProperty(FDcPropertyReader* Parent, FFieldVariant* OutProperty) override;
 	FDcResult PeekReadDataPtr(FDcPropertyReader* Parent, void** OutDataPtr) override;
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 
 	FDcResult ReadSetRoot(FDcPropertyReader* Parent);
 	FDcResult ReadSetEnd(FDcPropertyReader* Parent);
@@ -357,7 +368,7 @@ struct FDcReadStateScalar : public FDcBaseReadState
 	FDcResult ReadArrayRoot(FDcPropertyReader* Parent);
 	FDcResult ReadArrayEnd(FDcPropertyReader* Parent);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 #if !UE_VERSION_OLDER_THAN(5, 4, 0)
@@ -398,7 +409,7 @@ struct FDcReadStateOptional : public FDcBaseReadState
 	FDcResult ReadNone(FDcPropertyReader* Parent);
 	FDcResult ReadOptionalEnd(FDcPropertyReader* Parent);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 static_assert(DcTypeUtils::TIsTriviallyDestructible<FDcReadStateOptional>::Value, "need trivial destructible");
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
@@ -762,11 +762,77 @@ FDcResult FDcPropertyReader::ReadBlob(FDcBlobViewData* OutPtr)
 	}
 }
 
+FDcResult FDcPropertyReader::PeekContainerSize(int32* OutPtr)
+{
+	FDcBaseReadState& TopState = GetTopState(this);
+	if (FDcReadStateArray* ArrayState = TopState.As<FDcReadStateArray>())
+	{
+		if (ArrayState->State == FDcReadStateArray::EState::ExpectItem)
+			return ReadOutOk(OutPtr, ArrayState->ArrayHelper.Num() - ArrayState->Index);
+		else if (ArrayState->State == FDcReadStateArray::EState::ExpectEnd)
+			return ReadOutOk(OutPtr, 0);
+	}
+	else if (FDcReadStateSet* SetState = TopState.As<FDcReadStateSet>())
+	{
+		if (SetState->State == FDcReadStateSet::EState::ExpectItem)
+			return ReadOutOk(OutPtr, SetState->SetHelper.Num() - SetState->Index);
+		else if (SetState->State == FDcReadStateSet::EState::ExpectEnd)
+			return ReadOutOk(OutPtr, 0);
+	}
+	else if (FDcReadStateMap* MapState = TopState.As<FDcReadStateMap>())
+	{
+		if (MapState->State == FDcReadStateMap::EState::ExpectKey)
+			return ReadOutOk(OutPtr, MapState->MapHelper.Num() - MapState->Index);
+		else if (MapState->State == FDcReadStateMap::EState::ExpectEnd)
+			return ReadOutOk(OutPtr, 0);
+	}
+	else if (FDcReadStateScalar* ScalarState = TopState.As<FDcReadStateScalar>())
+	{
+		if (ScalarState->State == FDcReadStateScalar::EState::ExpectArrayItem)
+			return ReadOutOk(OutPtr, ScalarState->ScalarField->ArrayDim - ScalarState->Index);
+		else if (ScalarState->State == FDcReadStateScalar::EState::ExpectArrayEnd)
+			return ReadOutOk(OutPtr, 0);
+	}
+
+	return ReadOutOk(OutPtr, INDEX_NONE);
+}
+
 FDcResult FDcPropertyReader::SkipRead()
 {
 	return GetTopState(this).SkipRead(this);
 }
 
+static bool IsAtSkippableValue(FDcPropertyReader* Self)
+{
+	FDcBaseReadState& TopState = GetTopState(Self);
+	if (FDcReadStateClass* ClassState = TopState.As<FDcReadStateClass>())
+		return ClassState->State == FDcReadStateClass::EState::ExpectValue;
+	else if (FDcReadStateStruct* StructState = TopState.As<FDcReadStateStruct>())
+		return StructState->State == FDcReadStateStruct::EState::ExpectValue;
+	else if (FDcReadStateMap* MapState = TopState.As<FDcReadStateMap>())
+		return MapState->State == FDcReadStateMap::EState::ExpectKey
+			|| MapState->State == FDcReadStateMap::EState::ExpectValue;
+	else if (FDcReadStateArray* ArrayState = TopState.As<FDcReadStateArray>())
+		return ArrayState->State == FDcReadStateArray::EState::ExpectItem;
+	else if (FDcReadStateSet* SetState = TopState.As<FDcReadStateSet>())
+		return SetState->State == FDcReadStateSet::EState::ExpectItem;
+	else if (FDcReadStateScalar* ScalarState = TopState.As<FDcReadStateScalar>())
+		return ScalarState->State == FDcReadStateScalar::EState::ExpectScalar
+			|| ScalarState->State == FDcReadStateScalar::EState::ExpectArrayItem;
+	else
+		return false;
+}
+
+FDcResult FDcPropertyReader::SkipValue()
+{
+	//	skip the whole property without pushing its states,
+	//	otherwise it's a root or end that goes through the normal reads
+	if (IsAtSkippableValue(this))
+		return SkipRead();
+
+	return FDcReader::SkipValue();
+}
+
 FDcResult FDcPropertyReader::PeekReadProperty(FFieldVariant* OutProperty)
 {
 	return GetTopState(this).PeekReadProperty(this, OutProperty);
@@ -864,7 +930,10 @@ FDcResult FDcPropertyReader::ReadNone()
 FDcDiagnosticHighlight FDcPropertyReader::FormatHighlight()
 {
 	FDcDiagnosticHighlight OutHighlight(this, ClassId().ToString());
-	TArray<FString> Segments;
+	if (DcEnv().DiagMode == EDcDiagMode::Silent)
+		return OutHighlight;
+
+	TArray<DcPropertyHighlight::FSegment> Segments;
 
 	bool bLastIsContainer = false;
 	int Num = States.Num();
@@ -887,10 +956,7 @@ FDcDiagnosticHighlight FDcPropertyReader::FormatHighlight()
 			|| StateType == EDcPropertyReadType::MapProperty;
 	}
 
-	FString Path = Segments.Num() == 0
-		? TEXT("<none>")
-		: FString::Join(Segments, TEXT("."));
-	OutHighlight.Formatted = FString::Printf(TEXT("Reading property: %s"), *Path);
+	DcPropertyHighlight::SetHighlightPath(OutHighlight, TEXT("Reading property"), MoveTemp(Segments));
 	return OutHighlight;
 }
 
@@ -1,40 +1,45 @@
 #include "DataConfig/Property/DcPropertyStatesCommon.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Diagnostic/DcDiagnostic.h"
+#include "DataConfig/DcEnv.h"
 
 FName DC_TRANSIENT_ARRAY = FName(TEXT("DcTransientArray"));
 FName DC_TRANSIENT_SET = FName(TEXT("DcTransientSet"));
 FName DC_TRANSIENT_MAP = FName(TEXT("DcTransientMap"));
 
-void DcPropertyHighlight::FormatNone(TArray<FString>& OutSegments, EFormatSeg SegType)
+namespace DcPropertyStatesCommonDetails
 {
-	OutSegments.Add(TEXT("<none>"));
-}
 
-void DcPropertyHighlight::FormatScalar(TArray<FString>& OutSegments, EFormatSeg SegType, FProperty* Property, int Index, bool bIsItem)
+using namespace DcPropertyHighlight;
+
+static void FormatScalar(TArray<FString>& OutSegments, const FSegment& Seg)
 {
-	FString Seg = FString::Printf(TEXT("(%s%s)%s"),
+	FProperty* Property = Seg.Property;
+	FString Str = FString::Printf(TEXT("(%s%s)%s"),
 		*DcPropertyUtils::GetFormatPropertyTypeName(Property),
 		Property->ArrayDim > 1 ? *FString::Printf(TEXT("[%d]"), Property->ArrayDim) : TEXT(""),
 		*Property->GetName());
 
-	if (bIsItem)
-		Seg.Append(FString::Printf(TEXT("[%d]"), Index));
+	if (Seg.bIsItem)
+		Str.Append(FString::Printf(TEXT("[%d]"), Seg.Index));
 
-	OutSegments.Add(MoveTemp(Seg));
+	OutSegments.Add(MoveTemp(Str));
 }
 
-void DcPropertyHighlight::FormatClass(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& ObjectName, UClass* Class, FProperty* Property)
+template<typename TStruct>
+static void FormatStructLike(TArray<FString>& OutSegments, const FSegment& Seg)
 {
-	if (SegType != EFormatSeg::ParentIsContainer)
+	if (Seg.SegType != EFormatSeg::ParentIsContainer)
 	{
 		OutSegments.Add(FString::Printf(TEXT("(%s)%s"),
-			*DcPropertyUtils::GetFormatPropertyTypeName(Class),
-			*DcPropertyUtils::SafeNameToString(ObjectName)
+			*DcPropertyUtils::GetFormatPropertyTypeName((TStruct*)Seg.Struct),
+			*DcPropertyUtils::SafeNameToString(Seg.Name)
 		));
 	}
 
+	FProperty* Property = Seg.Property;
 	if (Property != nullptr
-		&& (SegType == EFormatSeg::Last || DcPropertyUtils::IsScalarProperty(Property)))
+		&& (Seg.SegType == EFormatSeg::Last || DcPropertyUtils::IsScalarProperty(Property)))
 	{
 		OutSegments.Add(FString::Printf(TEXT("(%s)%s"),
 			*DcPropertyUtils::GetFormatPropertyTypeName(Property),
@@ -42,73 +47,173 @@ void DcPropertyHighlight::FormatClass(TArray<FString>& OutSegments, EFormatSeg S
 	}
 }
 
-void DcPropertyHighlight::FormatStruct(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& StructName, UScriptStruct* StructClass, FProperty* Property)
+static void FormatContainer(TArray<FString>& OutSegments, const FSegment& Seg, FString&& TypeName)
 {
-	if (SegType != EFormatSeg::ParentIsContainer)
+	FString Str = FString::Printf(TEXT("(%s)%s"),
+		*TypeName,
+		*Seg.Name.ToString()
+	);
+
+	if (Seg.bIsItem)
+		Str.Append(FString::Printf(TEXT("[%d]"), Seg.Index));
+
+	OutSegments.Add(MoveTemp(Str));
+}
+
+static void FormatSegment(TArray<FString>& OutSegments, const FSegment& Seg)
+{
+	switch (Seg.Kind)
 	{
-		OutSegments.Add(FString::Printf(TEXT("(%s)%s"),
-			*DcPropertyUtils::GetFormatPropertyTypeName(StructClass),
-			*DcPropertyUtils::SafeNameToString(StructName)
-		));
+		case ESegKind::None:
+			OutSegments.Add(TEXT("<none>"));
+			break;
+		case ESegKind::Scalar:
+			FormatScalar(OutSegments, Seg);
+			break;
+		case ESegKind::Class:
+			FormatStructLike<UClass>(OutSegments, Seg);
+			break;
+		case ESegKind::Struct:
+			FormatStructLike<UScriptStruct>(OutSegments, Seg);
+			break;
+		case ESegKind::Map:
+			FormatContainer(OutSegments, Seg, DcPropertyUtils::FormatMapTypeName(Seg.Property, Seg.Property2));
+			break;
+		case ESegKind::Array:
+			FormatContainer(OutSegments, Seg, DcPropertyUtils::FormatArrayTypeName(Seg.Property));
+			break;
+		case ESegKind::Set:
+			FormatContainer(OutSegments, Seg, DcPropertyUtils::FormatSetTypeName(Seg.Property));
+			break;
+		case ESegKind::Optional:
+			FormatContainer(OutSegments, Seg, DcPropertyUtils::FormatOptionalTypeName(Seg.Property));
+			break;
+		default:
+			checkNoEntry();
 	}
+}
 
-	if (Property != nullptr
-		&& (SegType == EFormatSeg::Last || DcPropertyUtils::IsScalarProperty(Property)))
+//	fallback when types are gone before a deferred flush
+static void FormatSegmentNameOnly(TArray<FString>& OutSegments, const FSegment& Seg)
+{
+	if (Seg.Kind == ESegKind::None)
 	{
-		OutSegments.Add(FString::Printf(TEXT("(%s)%s"),
-			*DcPropertyUtils::GetFormatPropertyTypeName(Property),
-			*Property->GetName()));
+		OutSegments.Add(TEXT("<none>"));
+	}
+	else if (Seg.Kind == ESegKind::Class || Seg.Kind == ESegKind::Struct)
+	{
+		if (Seg.SegType != EFormatSeg::ParentIsContainer)
+			OutSegments.Add(DcPropertyUtils::SafeNameToString(Seg.Name));
+		if (Seg.SegType == EFormatSeg::Last && !Seg.PropertyName.IsNone())
+			OutSegments.Add(Seg.PropertyName.ToString());
+	}
+	else
+	{
+		FString Str = Seg.Name.ToString();
+		if (Seg.bIsItem)
+			Str.Append(FString::Printf(TEXT("[%d]"), Seg.Index));
+		OutSegments.Add(MoveTemp(Str));
 	}
 }
 
-void DcPropertyHighlight::FormatMap(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& MapName, FProperty* KeyProperty, FProperty* ValueProperty, int Index, bool bIsKeyOrValue)
+static FString JoinPath(const TCHAR* Prefix, TArray<FString>& Strs)
 {
-	FString Seg = FString::Printf(TEXT("(%s)%s"),
-		*DcPropertyUtils::FormatMapTypeName(KeyProperty, ValueProperty),
-		*MapName.ToString()
-	);
+	return FString::Printf(TEXT("%s: %s"), Prefix, Strs.Num() == 0
+		? TEXT("<none>")
+		: *FString::Join(Strs, TEXT(".")));
+}
+
+static TWeakObjectPtr<UStruct> GetOwnerStruct(FProperty* Property)
+{
+	return Property ? Property->GetOwnerStruct() : nullptr;
+}
 
-	if (bIsKeyOrValue)
-		Seg.Append(FString::Printf(TEXT("[%d]"), Index));
+} // namespace DcPropertyStatesCommonDetails
 
-	OutSegments.Add(MoveTemp(Seg));
+void DcPropertyHighlight::FormatNone(TArray<FSegment>& OutSegments, EFormatSeg SegType)
+{
+	OutSegments.Add({ESegKind::None, SegType});
 }
 
-void DcPropertyHighlight::FormatArray(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& ArrayName, FProperty* InnerProperty, int Index, bool bIsItem)
+void DcPropertyHighlight::FormatScalar(TArray<FSegment>& OutSegments, EFormatSeg SegType, FProperty* Property, int Index, bool bIsItem)
 {
-	check(InnerProperty);
-	FString Seg = FString::Printf(TEXT("(%s)%s"),
-		*DcPropertyUtils::FormatArrayTypeName(InnerProperty),
-		*ArrayName.ToString()
-	);
+	OutSegments.Add({ESegKind::Scalar, SegType, Property->GetFName(), NAME_None, nullptr, Property, nullptr, Index, bIsItem});
+}
 
-	if (bIsItem)
-		Seg.Append(FString::Printf(TEXT("[%d]"), Index));
+void DcPropertyHighlight::FormatClass(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& ObjectName, UClass* Class, FProperty* Property)
+{
+	OutSegments.Add({ESegKind::Class, SegType, ObjectName, Property ? Property->GetFName() : NAME_None, Class, Property, nullptr, 0, false});
+}
 
-	OutSegments.Add(MoveTemp(Seg));
+void DcPropertyHighlight::FormatStruct(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& StructName, UScriptStruct* StructClass, FProperty* Property)
+{
+	OutSegments.Add({ESegKind::Struct, SegType, StructName, Property ? Property->GetFName() : NAME_None, StructClass, Property, nullptr, 0, false});
 }
 
-void DcPropertyHighlight::FormatSet(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& SetName, FProperty* ElementProperty, int Index, bool bIsItem)
+void DcPropertyHighlight::FormatMap(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& MapName, FProperty* KeyProperty, FProperty* ValueProperty, int Index, bool bIsKeyOrValue)
 {
-	check(ElementProperty);
-	FString Seg = FString::Printf(TEXT("(%s)%s"),
-		*DcPropertyUtils::FormatSetTypeName(ElementProperty),
-		*SetName.ToString()
-	);
+	OutSegments.Add({ESegKind::Map, SegType, MapName, NAME_None, nullptr, KeyProperty, ValueProperty, Index, bIsKeyOrValue});
+}
 
-	if (bIsItem)
-		Seg.Append(FString::Printf(TEXT("[%d]"), Index));
+void DcPropertyHighlight::FormatArray(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& ArrayName, FProperty* InnerProperty, int Index, bool bIsItem)
+{
+	check(InnerProperty);
+	OutSegments.Add({ESegKind::Array, SegType, ArrayName, NAME_None, nullptr, InnerProperty, nullptr, Index, bIsItem});
+}
 
-	OutSegments.Add(MoveTemp(Seg));
+void DcPropertyHighlight::FormatSet(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& SetName, FProperty* ElementProperty, int Index, bool bIsItem)
+{
+	check(ElementProperty);
+	OutSegments.Add({ESegKind::Set, SegType, SetName, NAME_None, nullptr, ElementProperty, nullptr, Index, bIsItem});
 }
 
-void DcPropertyHighlight::FormatOptional(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& OptionalName, FProperty* ValueProperty)
+void DcPropertyHighlight::FormatOptional(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& OptionalName, FProperty* ValueProperty)
 {
 	check(ValueProperty);
-	FString Seg = FString::Printf(TEXT("(%s)%s"),
-		*DcPropertyUtils::FormatOptionalTypeName(ValueProperty),
-		*OptionalName.ToString()
-	);
+	OutSegments.Add({ESegKind::Optional, SegType, OptionalName, NAME_None, nullptr, ValueProperty, nullptr, 0, false});
+}
+
+void DcPropertyHighlight::SetHighlightPath(FDcDiagnosticHighlight& OutHighlight, const TCHAR* Prefix, TArray<FSegment>&& Segments)
+{
+	using namespace DcPropertyStatesCommonDetails;
+
+	if (DcEnv().DiagMode != EDcDiagMode::Deferred)
+	{
+		TArray<FString> Strs;
+		for (const FSegment& Seg : Segments)
+			FormatSegment(Strs, Seg);
 
-	OutSegments.Add(MoveTemp(Seg));
+		OutHighlight.Formatted = JoinPath(Prefix, Strs);
+		return;
+	}
+
+	//	types and properties can be unloaded before flush, hold their owners weakly. properties
+	//	without an owning struct, like ones from `FDcPropertyBuilder`, are never formatted in full
+	TArray<TWeakObjectPtr<UStruct>> Owners;
+	Owners.Reserve(Segments.Num() * 3);
+	for (const FSegment& Seg : Segments)
+	{
+		Owners.Add(Seg.Struct);
+		Owners.Add(GetOwnerStruct(Seg.Property));
+		Owners.Add(GetOwnerStruct(Seg.Property2));
+	}
+
+	OutHighlight.DeferredFormat = [Prefix, Segments = MoveTemp(Segments), Owners = MoveTemp(Owners)](FDcDiagnosticHighlight& Self)
+	{
+		TArray<FString> Strs;
+		for (int Ix = 0; Ix < Segments.Num(); Ix++)
+		{
+			const FSegment& Seg = Segments[Ix];
+			bool bLoaded = (Seg.Struct == nullptr || Owners[Ix * 3].IsValid())
+				&& (Seg.Property == nullptr || Owners[Ix * 3 + 1].IsValid())
+				&& (Seg.Property2 == nullptr || Owners[Ix * 3 + 2].IsValid());
+
+			if (bLoaded)
+				FormatSegment(Strs, Seg);
+			else
+				FormatSegmentNameOnly(Strs, Seg);
+		}
+
+		Self.Formatted = JoinPath(Prefix, Strs);
+	};
 }
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 
+struct FDcDiagnosticHighlight;
+
 //	hard depth cap when read/writing properties for heuristic overflow detection
 static const int DC_HEURISTIC_MAX_PROPERTIES_DEPTH = 256;
 
@@ -27,14 +29,45 @@ namespace DcPropertyHighlight
 		Last,
 	};
 
-	void FormatNone(TArray<FString>& OutSegments, EFormatSeg SegType);
-	void FormatScalar(TArray<FString>& OutSegments, EFormatSeg SegType, FProperty* Property, int Index, bool bIsItem);
-	void FormatClass(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& ObjectName, UClass* Class, FProperty* Property);
-	void FormatStruct(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& StructName, UScriptStruct* StructClass, FProperty* Property);
-	void FormatMap(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& MapName, FProperty* KeyProperty, FProperty* ValueProperty, int Index, bool bIsKeyOrValue);
-	void FormatArray(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& ArrayName, FProperty* InnerProperty, int Index, bool bIsItem);
-	void FormatSet(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& SetName, FProperty* ElementProperty, int Index, bool bIsItem);
-	void FormatOptional(TArray<FString>& OutSegments, EFormatSeg SegType, const FName& OptionalName, FProperty* ValueProperty);
+	enum class ESegKind : uint8
+	{
+		None,
+		Scalar,
+		Class,
+		Struct,
+		Map,
+		Array,
+		Set,
+		Optional,
+	};
+
+	//	path segment of a read/write state, only pointers and names so it's cheap to take
+	//	and strings are built in `SetHighlightPath`
+	struct FSegment
+	{
+		ESegKind Kind;
+		EFormatSeg SegType;
+		FName Name;
+		FName PropertyName;
+		UStruct* Struct;
+		FProperty* Property;
+		FProperty* Property2;
+		int Index;
+		bool bIsItem;
+	};
+
+	void FormatNone(TArray<FSegment>& OutSegments, EFormatSeg SegType);
+	void FormatScalar(TArray<FSegment>& OutSegments, EFormatSeg SegType, FProperty* Property, int Index, bool bIsItem);
+	void FormatClass(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& ObjectName, UClass* Class, FProperty* Property);
+	void FormatStruct(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& StructName, UScriptStruct* StructClass, FProperty* Property);
+	void FormatMap(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& MapName, FProperty* KeyProperty, FProperty* ValueProperty, int Index, bool bIsKeyOrValue);
+	void FormatArray(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& ArrayName, FProperty* InnerProperty, int Index, bool bIsItem);
+	void FormatSet(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& SetName, FProperty* ElementProperty, int Index, bool bIsItem);
+	void FormatOptional(TArray<FSegment>& OutSegments, EFormatSeg SegType, const FName& OptionalName, FProperty* ValueProperty);
+
+	//	set `Formatted` to prefix and joined path. deferred diagnostics format on flush, segments
+	//	with types unloaded by then are formatted by names only
+	void SetHighlightPath(FDcDiagnosticHighlight& OutHighlight, const TCHAR* Prefix, TArray<FSegment>&& Segments);
 
 } // namespace DcPropertyHighlight
 
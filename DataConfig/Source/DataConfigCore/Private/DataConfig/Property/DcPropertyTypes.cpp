@@ -3,6 +3,14 @@
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/DcEnv.h"
 #include "UObject/PropertyAccessUtil.h"
+#include "Misc/ScopeRWLock.h"
+
+struct FDcPropertyTableCache
+{
+	FRWLock Lock;
+	//	stale tables are freed once no config holds them in `LocalTables`
+	TMap<UStruct*, FDcPropertyTableRef> Tables;
+};
 
 namespace DcPropertyTypesDetails
 {
@@ -17,14 +25,107 @@ static bool _DefaultProcessPropertyPredicate(FProperty* Property)
 #endif // WITH_EDITORONLY_DATA
 }
 
+//	default configs share the same predicate instance so they also share the table cache
+static const FDcPropertyConfig& _DefaultTableCachedConfig()
+{
+	static FDcPropertyConfig _CACHED = [](){
+		FDcPropertyConfig Ret;
+
+		Ret.ProcessPropertyPredicate = FDcProcessPropertyPredicateDelegate::CreateStatic(_DefaultProcessPropertyPredicate);
+		Ret.EnableTableCache();
+
+		return Ret;
+	}();
+
+	return _CACHED;
+}
+
+static TSharedRef<FDcPropertyTable, ESPMode::ThreadSafe> BuildTable(FDcPropertyConfig& Config, UStruct* Struct)
+{
+	TSharedRef<FDcPropertyTable, ESPMode::ThreadSafe> Table = MakeShared<FDcPropertyTable, ESPMode::ThreadSafe>();
+	Table->Struct = Struct;
+	Table->PropertyLink = Struct->PropertyLink;
+	Table->PropertiesSize = Struct->GetPropertiesSize();
+
+	for (FProperty* Property = Config.FirstProcessProperty(Struct->PropertyLink);
+		Property != nullptr;
+		Property = Config.NextProcessProperty(Property))
+	{
+		Table->Entries.Add({Property->GetFName(), Property});
+	}
+
+	int32 IndexSize = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(Table->Entries.Num() * 2, 4));
+	Table->Index.SetNumZeroed(IndexSize);
+
+	uint32 Mask = (uint32)IndexSize - 1;
+	for (int32 Ix = 0; Ix < Table->Entries.Num(); Ix++)
+	{
+		uint32 Slot = GetTypeHash(Table->Entries[Ix].Name) & Mask;
+		while (Table->Index[Slot] != 0)
+			Slot = (Slot + 1) & Mask;
+
+		Table->Index[Slot] = Ix + 1;
+	}
+
+	return Table;
+}
+
+static FDcPropertyTableRef FindSharedTable(FDcPropertyConfig& Config, UStruct* Struct)
+{
+	FDcPropertyTableCache& Cache = *Config.TableCache;
+	{
+		FReadScopeLock ReadLock(Cache.Lock);
+		if (FDcPropertyTableRef* TablePtr = Cache.Tables.Find(Struct))
+		{
+			if (!(*TablePtr)->IsStale(Struct))
+				return *TablePtr;
+		}
+	}
+
+	FDcPropertyTableRef NewTable = BuildTable(Config, Struct);
+
+	FWriteScopeLock WriteLock(Cache.Lock);
+	FDcPropertyTableRef& Slot = Cache.Tables.FindOrAdd(Struct);
+
+	//	another thread might have just built it
+	if (!Slot.IsValid() || Slot->IsStale(Struct))
+		Slot = MoveTemp(NewTable);
+
+	return Slot;
+}
+
 } // namespace DcPropertyTypesDetails
 
+int32 FDcPropertyTable::FindIndex(const FName& Name, int32 HintIx) const
+{
+	if (Entries.IsValidIndex(HintIx) && Entries[HintIx].Name == Name)
+		return HintIx;
+
+	uint32 Mask = (uint32)Index.Num() - 1;
+	for (uint32 Slot = GetTypeHash(Name) & Mask; ; Slot = (Slot + 1) & Mask)
+	{
+		int32 EntryIx = Index[Slot];
+		if (EntryIx == 0)
+			return INDEX_NONE;
+
+		if (Entries[EntryIx - 1].Name == Name)
+			return EntryIx - 1;
+	}
+}
+
+bool FDcPropertyTable::IsStale(UStruct* InStruct) const
+{
+	//	relinked or reinstanced structs get new properties
+	return Struct.Get() != InStruct
+		|| PropertyLink != InStruct->PropertyLink
+		|| PropertiesSize != InStruct->GetPropertiesSize();
+}
+
 FDcPropertyConfig FDcPropertyConfig::MakeDefault()
 {
 	static FDcPropertyConfig _DEFAULT = [](){
-		FDcPropertyConfig Ret;
+		FDcPropertyConfig Ret = DcPropertyTypesDetails::_DefaultTableCachedConfig();
 
-		Ret.ProcessPropertyPredicate = FDcProcessPropertyPredicateDelegate::CreateStatic(DcPropertyTypesDetails::_DefaultProcessPropertyPredicate);
 		Ret.ExpandObjectPredicate = FDcExpandObjectPredicateDelegate::CreateStatic(DcPropertyUtils::IsSubObjectProperty);
 
 		return Ret;
@@ -37,9 +138,8 @@ FDcPropertyConfig FDcPropertyConfig::MakeNoExpandObject()
 {
 	static FDcPropertyConfig _NO_EXPAND = []()
 	{
-		FDcPropertyConfig Ret;
+		FDcPropertyConfig Ret = DcPropertyTypesDetails::_DefaultTableCachedConfig();
 
-		Ret.ProcessPropertyPredicate = FDcProcessPropertyPredicateDelegate::CreateStatic(DcPropertyTypesDetails::_DefaultProcessPropertyPredicate);
 		Ret.ExpandObjectPredicate = FDcExpandObjectPredicateDelegate::CreateLambda([](FObjectProperty*){ return false; });
 
 		return Ret;
@@ -122,3 +222,54 @@ FProperty* FDcPropertyConfig::FindProcessPropertyByName(UStruct* Struct, const F
 		: nullptr;
 }
 
+
+void FDcPropertyConfig::EnableTableCache()
+{
+	TableCache = MakeShared<FDcPropertyTableCache, ESPMode::ThreadSafe>();
+	TableCachePredicate = ProcessPropertyPredicate.GetHandle();
+
+	for (TPair<UStruct*, FDcPropertyTableRef>& Pair : LocalTables)
+		LocalStaleTables.Add(MoveTemp(Pair.Value));
+	LocalTables.Reset();
+}
+
+const FDcPropertyTable* FDcPropertyConfig::FindTable(UStruct* Struct)
+{
+	if (!TableCache.IsValid()
+		|| Struct == nullptr
+		|| ProcessPropertyPredicate.GetHandle() != TableCachePredicate)
+		return nullptr;
+
+	if (FDcPropertyTableRef* LocalPtr = LocalTables.Find(Struct))
+	{
+		if (!(*LocalPtr)->IsStale(Struct))
+			return LocalPtr->Get();
+
+		//	states of this config's reader or writer might still point to it
+		LocalStaleTables.Add(MoveTemp(*LocalPtr));
+	}
+
+	FDcPropertyTableRef Table = DcPropertyTypesDetails::FindSharedTable(*this, Struct);
+	LocalTables.Add(Struct, Table);
+	return Table.Get();
+}
+
+FProperty* FDcPropertyConfig::NextProcessPropertyByName(const FDcPropertyTable* Table, UStruct* Struct, FProperty* InProperty, const FName& Name, int32& InOutIx)
+{
+	if (Table == nullptr)
+		return NextProcessPropertyByName(Struct, InProperty, Name);
+
+	int32 Ix = Table->FindIndex(Name, InOutIx + 1);
+	if (Ix != INDEX_NONE)
+	{
+		InOutIx = Ix;
+		return Table->Entries[Ix].Property;
+	}
+
+	//	slow path for redirected and user defined struct names
+	FProperty* Property = FindProcessPropertyByName(Struct, Name);
+	if (Property)
+		InOutIx = Table->FindIndex(Property->GetFName());
+
+	return Property;
+}
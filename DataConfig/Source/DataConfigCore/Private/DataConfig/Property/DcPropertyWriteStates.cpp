@@ -68,7 +68,7 @@ FDcResult FDcWriteStateNone::PeekWrite(FDcPropertyWriter* Parent, EDcDataEntry N
 	return ReadOutOk(bOutOk, Next == EDcDataEntry::Ended);
 }
 
-void FDcWriteStateNone::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateNone::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatNone(OutSegments, SegType);
 }
@@ -117,7 +117,7 @@ FDcResult FDcWriteStateStruct::WriteName(FDcPropertyWriter* Parent, const FName&
 {
 	if (State == EState::ExpectKeyOrEnd)
 	{
-		Property = Parent->Config.NextProcessPropertyByName(StructClass, Property, Value);
+		Property = Parent->Config.NextProcessPropertyByName(Table, StructClass, Property, Value, PropertyIx);
 		if (Property == nullptr)
 			return DC_FAIL(DcDReadWrite, CantFindPropertyByName)
 				<< Value << Parent->FormatHighlight();
@@ -187,6 +187,7 @@ FDcResult FDcWriteStateStruct::WriteStructRootAccess(FDcPropertyWriter* Parent,
 	if (State == EState::ExpectRoot)
 	{
 		State = EState::ExpectKeyOrEnd;
+		Table = Parent->Config.FindTable(StructClass);
 		if (Access.Flag & FDcStructAccess::WriteCheckName)
 		{
 			return DcExpect(Access.Name == StructClass->GetFName(), [&] {
@@ -234,7 +235,7 @@ FDcResult FDcWriteStateStruct::WriteStructEndAccess(FDcPropertyWriter* Parent, F
 	}
 }
 
-void FDcWriteStateStruct::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateStruct::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatStruct(OutSegments, SegType, StructName, StructClass, Property);
 }
@@ -292,7 +293,7 @@ FDcResult FDcWriteStateClass::WriteName(FDcPropertyWriter* Parent, const FName&
 {
 	if (State == EState::ExpectExpandKeyOrEnd)
 	{
-		Datum.Property =  Parent->Config.NextProcessPropertyByName(Class, Datum.CastField<FProperty>(), Value);
+		Datum.Property = Parent->Config.NextProcessPropertyByName(Table, Class, Datum.CastField<FProperty>(), Value, PropertyIx);
 		Datum.DataPtr = nullptr;
 
 		if (Datum.Property == nullptr)
@@ -405,6 +406,7 @@ FDcResult FDcWriteStateClass::WriteClassRootAccess(FDcPropertyWriter* Parent, FD
 				Datum.Reset();
 			}
 
+			Table = Parent->Config.FindTable(Class);
 			State = EState::ExpectExpandKeyOrEnd;
 		}
 		else
@@ -486,7 +488,7 @@ FDcResult FDcWriteStateClass::WriteObjectReference(FDcPropertyWriter* Parent, co
 	}
 }
 
-void FDcWriteStateClass::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateClass::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatClass(
 		OutSegments,
@@ -660,7 +662,14 @@ FDcResult FDcWriteStateMap::WriteMapEnd(FDcPropertyWriter* Parent)
 	}
 }
 
-void FDcWriteStateMap::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateMap::ReserveItems(int32 Num)
+{
+	//	only reserve on a fresh container, otherwise it's a stale hint
+	if (State == EState::ExpectKeyOrEnd && Index == 0 && Num > 0)
+		MapHelper.EmptyValues(Num);
+}
+
+void FDcWriteStateMap::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatMap(OutSegments, SegType, MapName, MapHelper.KeyProp, MapHelper.ValueProp, Index,
 		State == EState::ExpectKeyOrEnd || State == EState::ExpectValue);
@@ -791,7 +800,13 @@ FDcResult FDcWriteStateArray::WriteArrayEnd(FDcPropertyWriter* Parent)
 	}
 }
 
-void FDcWriteStateArray::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateArray::ReserveItems(int32 Num)
+{
+	if (State == EState::ExpectItemOrEnd && Index == 0 && Num > 0)
+		ArrayHelper.EmptyValues(Num);
+}
+
+void FDcWriteStateArray::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	auto& ArrayAccess = (DcSerDeCommon::FScriptArrayHelperAccess&)ArrayHelper;
 	DcPropertyHighlight::FormatArray(OutSegments, SegType, ArrayName, ArrayAccess.InnerProperty, Index,
@@ -927,7 +942,13 @@ FDcResult FDcWriteStateSet::WriteSetEnd(FDcPropertyWriter* Parent)
 	}
 }
 
-void FDcWriteStateSet::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateSet::ReserveItems(int32 Num)
+{
+	if (State == EState::ExpectItemOrEnd && Index == 0 && Num > 0)
+		SetHelper.EmptyElements(Num);
+}
+
+void FDcWriteStateSet::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatSet(OutSegments, SegType, SetName, SetHelper.ElementProp, Index,
 		State == EState::ExpectItemOrEnd);
@@ -1065,7 +1086,7 @@ FDcResult FDcWriteStateOptional::WriteOptionalEnd(FDcPropertyWriter* Parent)
 	}
 }
 
-void FDcWriteStateOptional::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateOptional::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatOptional(OutSegments, SegType, OptionalProperty->GetFName(), OptionalProperty->GetValueProperty());
 }
@@ -1196,7 +1217,7 @@ FDcResult FDcWriteStateScalar::WriteArrayEnd(FDcPropertyWriter* Parent)
 	}
 }
 
-void FDcWriteStateScalar::FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
+void FDcWriteStateScalar::FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType)
 {
 	DcPropertyHighlight::FormatScalar(OutSegments, SegType, ScalarField, Index, State == EState::ExpectArrayItem);
 }
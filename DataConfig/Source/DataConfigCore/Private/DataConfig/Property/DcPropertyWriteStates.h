@@ -4,6 +4,7 @@
 #include "DataConfig/Property/DcPropertyStatesCommon.h"
 #include "DataConfig/Property/DcPropertyDatum.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Property/DcPropertyTypes.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "UObject/UnrealType.h"
 #include "Misc/EngineVersionComparison.h"
@@ -33,7 +34,7 @@ struct FDcBaseWriteState
 	virtual FDcResult SkipWrite(FDcPropertyWriter* Parent);
 	virtual FDcResult PeekWriteProperty(FDcPropertyWriter* Parent, FFieldVariant* OutProperty);
 
-	virtual void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) = 0;
+	virtual void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) = 0;
 
 	template<typename T>
 	T* As();
@@ -62,7 +63,7 @@ struct FDcWriteStateNone : public FDcBaseWriteState
 	EDcPropertyWriteType GetType() override;
 	FDcResult PeekWrite(FDcPropertyWriter* Parent, EDcDataEntry Next, bool* bOutOk) override;
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcWriteStateStruct : public FDcBaseWriteState
@@ -74,6 +75,9 @@ struct FDcWriteStateStruct : public FDcBaseWriteState
 	UScriptStruct* StructClass;
 	FProperty* Property;
 
+	const FDcPropertyTable* Table;
+	int32 PropertyIx;
+
 	enum class EState
 	{
 		ExpectRoot,
@@ -89,6 +93,8 @@ struct FDcWriteStateStruct : public FDcBaseWriteState
 		StructPtr = InStructPtr;
 		StructClass = InStructClass;
 		Property = nullptr;
+		Table = nullptr;
+		PropertyIx = INDEX_NONE;
 		State = EState::ExpectRoot;
 	}
 
@@ -102,7 +108,7 @@ struct FDcWriteStateStruct : public FDcBaseWriteState
 	FDcResult WriteStructRootAccess(FDcPropertyWriter* Parent, FDcStructAccess& Access);
 	FDcResult WriteStructEndAccess(FDcPropertyWriter* Parent, FDcStructAccess& Access);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcWriteStateClass : public FDcBaseWriteState
@@ -135,6 +141,9 @@ struct FDcWriteStateClass : public FDcBaseWriteState
 	FName ObjectName;
 	FDcPropertyDatum Datum;
 
+	const FDcPropertyTable* Table = nullptr;
+	int32 PropertyIx = INDEX_NONE;
+
 	FDcWriteStateClass(UObject* InClassObject, UClass* InClass)
 	{
 		ObjectName = InClassObject->GetFName();
@@ -173,7 +182,7 @@ struct FDcWriteStateClass : public FDcBaseWriteState
 	FDcResult WriteClassEndAccess(FDcPropertyWriter* Parent, FDcClassAccess& Access);
 	FDcResult WriteObjectReference(FDcPropertyWriter* Parent, const UObject* Value);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcWriteStateMap : public FDcBaseWriteState
@@ -218,8 +227,9 @@ struct FDcWriteStateMap : public FDcBaseWriteState
 
 	FDcResult WriteMapRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteMapEnd(FDcPropertyWriter* Parent);
+	void ReserveItems(int32 Num);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcWriteStateArray : public FDcBaseWriteState
@@ -262,8 +272,9 @@ struct FDcWriteStateArray : public FDcBaseWriteState
 
 	FDcResult WriteArrayRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteArrayEnd(FDcPropertyWriter* Parent);
+	void ReserveItems(int32 Num);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 struct FDcWriteStateSet : public FDcBaseWriteState
@@ -307,8 +318,9 @@ struct FDcWriteStateSet : public FDcBaseWriteState
 
 	FDcResult WriteSetRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteSetEnd(FDcPropertyWriter* Parent);
+	void ReserveItems(int32 Num);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 #if !UE_VERSION_OLDER_THAN(5, 4, 0)
@@ -346,7 +358,7 @@ struct FDcWriteStateOptional : public FDcBaseWriteState
 	FDcResult WriteNone(FDcPropertyWriter* Parent);
 	FDcResult WriteOptionalEnd(FDcPropertyWriter* Parent);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 static_assert(DcTypeUtils::TIsTriviallyDestructible<FDcWriteStateOptional>::Value, "need trivial destructible");
 #endif // !UE_VERSION_OLDER_THAN(5, 4, 0)
@@ -405,7 +417,7 @@ struct FDcWriteStateScalar : public FDcBaseWriteState
 	FDcResult WriteArrayRoot(FDcPropertyWriter* Parent);
 	FDcResult WriteArrayEnd(FDcPropertyWriter* Parent);
 
-	void FormatHighlightSegment(TArray<FString>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
+	void FormatHighlightSegment(TArray<DcPropertyHighlight::FSegment>& OutSegments, DcPropertyHighlight::EFormatSeg SegType) override;
 };
 
 template<typename TProperty, typename TScalar>
@@ -778,6 +778,17 @@ FDcResult FDcPropertyWriter::WriteBlob(const FDcBlobViewData& Value)
 	}
 }
 
+void FDcPropertyWriter::SetContainerSizeHint(int32 Num)
+{
+	FDcBaseWriteState& TopState = GetTopState(this);
+	if (FDcWriteStateArray* ArrayState = TopState.As<FDcWriteStateArray>())
+		ArrayState->ReserveItems(Num);
+	else if (FDcWriteStateSet* SetState = TopState.As<FDcWriteStateSet>())
+		SetState->ReserveItems(Num);
+	else if (FDcWriteStateMap* MapState = TopState.As<FDcWriteStateMap>())
+		MapState->ReserveItems(Num);
+}
+
 FDcResult FDcPropertyWriter::SkipWrite()
 {
 	return GetTopState(this).SkipWrite(this);
@@ -796,7 +807,10 @@ FDcResult FDcPropertyWriter::WriteDataEntry(FFieldClass* ExpectedPropertyClass,
 FDcDiagnosticHighlight FDcPropertyWriter::FormatHighlight()
 {
 	FDcDiagnosticHighlight OutHighlight(this, ClassId().ToString());
-	TArray<FString> Segments;
+	if (DcEnv().DiagMode == EDcDiagMode::Silent)
+		return OutHighlight;
+
+	TArray<DcPropertyHighlight::FSegment> Segments;
 
 	bool bLastIsContainer = false;
 	int Num = States.Num();
@@ -819,10 +833,7 @@ FDcDiagnosticHighlight FDcPropertyWriter::FormatHighlight()
 			|| StateType == EDcPropertyWriteType::MapProperty;
 	}
 
-	FString Path = Segments.Num() == 0
-		? TEXT("<none>")
-		: FString::Join(Segments, TEXT("."));
-	OutHighlight.Formatted = FString::Printf(TEXT("Writing property: %s"), *Path);
+	DcPropertyHighlight::SetHighlightPath(OutHighlight, TEXT("Writing property"), MoveTemp(Segments));
 	return OutHighlight;
 }
 
@@ -117,6 +117,20 @@ FDcResult FDcPutbackReader::ReadString(FString* OutPtr)
 	return DcPutbackReaderDetails::CachedRead<FString>(this, &FDcReader::ReadString, OutPtr);
 }
 
+FDcResult FDcPutbackReader::ReadStringView(FDcStringViewData* OutPtr)
+{
+	if (Cached.Num() > 0)
+	{
+		FString Value;
+		DC_TRY(DcPutbackReaderDetails::TryUseCachedValue<FString>(this, &Value));
+		return ReadOutOk(OutPtr, FDcStringViewData::FromOwned(MoveTemp(Value)));
+	}
+	else
+	{
+		return Reader->ReadStringView(OutPtr);
+	}
+}
+
 FDcResult FDcPutbackReader::ReadText(FText* OutPtr)
 {
 	return DcPutbackReaderDetails::CachedRead<FText>(this, &FDcReader::ReadText, OutPtr);
@@ -297,6 +311,24 @@ FDcResult FDcPutbackReader::ReadBlob(FDcBlobViewData* OutPtr)
 	return DcPutbackReaderDetails::CanNotCachedRead(this, EDcDataEntry::Blob, &FDcReader::ReadBlob, OutPtr);
 }
 
+FDcResult FDcPutbackReader::PeekContainerSize(int32* OutPtr)
+{
+	//	cached items would be miscounted by inner reader
+	if (Cached.Num())
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	return Reader->PeekContainerSize(OutPtr);
+}
+
+FDcResult FDcPutbackReader::SkipValue()
+{
+	//	cached items need to go through the normal reads
+	if (Cached.Num())
+		return FDcReader::SkipValue();
+
+	return Reader->SkipValue();
+}
+
 FDcResult FDcPutbackReader::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
 {
 	if (Cached.Num())
@@ -1,6 +1,7 @@
 #include "DataConfig/Reader/DcReader.h"
 #include "DataConfig/DcEnv.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
 
 FDcReader::~FDcReader() {}
 
@@ -11,6 +12,59 @@ FDcResult FDcReader::ReadBool(bool*) { return DC_FAIL(DcDCommon, NotImplemented)
 FDcResult FDcReader::ReadName(FName*) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadString(FString*) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadText(FText*) { return DC_FAIL(DcDCommon, NotImplemented); }
+
+FDcResult FDcReader::ReadStringView(FDcStringViewData* OutPtr)
+{
+	//	readers without a source buffer to borrow from fallback to an owned string
+	if (OutPtr == nullptr)
+		return ReadString(nullptr);
+
+	*OutPtr = FDcStringViewData{};
+	return ReadString(&OutPtr->Owned);
+}
+
+FDcResult FDcReader::PeekContainerSize(int32* OutPtr)
+{
+	return ReadOutOk(OutPtr, INDEX_NONE);
+}
+
+FDcResult FDcReader::SkipValue()
+{
+	int32 Depth = 0;
+	do
+	{
+		EDcDataEntry Next;
+		DC_TRY(PeekRead(&Next));
+
+		switch (Next)
+		{
+			case EDcDataEntry::StructRoot:
+			case EDcDataEntry::ClassRoot:
+			case EDcDataEntry::MapRoot:
+			case EDcDataEntry::ArrayRoot:
+			case EDcDataEntry::SetRoot:
+			case EDcDataEntry::OptionalRoot:
+				Depth++;
+				break;
+			case EDcDataEntry::StructEnd:
+			case EDcDataEntry::ClassEnd:
+			case EDcDataEntry::MapEnd:
+			case EDcDataEntry::ArrayEnd:
+			case EDcDataEntry::SetEnd:
+			case EDcDataEntry::OptionalEnd:
+				Depth--;
+				break;
+			default:
+				break;
+		}
+
+		DC_TRY(DcSerDeUtils::DispatchNoopRead(Next, this));
+	}
+	while (Depth > 0);
+
+	return DcOk();
+}
+
 FDcResult FDcReader::ReadEnum(FDcEnumData*) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadStructRootAccess(FDcStructAccess& Access) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcReader::ReadStructEndAccess(FDcStructAccess& Access) { return DC_FAIL(DcDCommon, NotImplemented); }
@@ -0,0 +1,593 @@
+#include "DataConfig/Reader/DcTapeReader.h"
+#include "DataConfig/Json/DcJsonNumber.h"
+#include "DataConfig/Misc/DcUtf8.h"
+#include "DataConfig/Misc/DcTypeUtils.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
+#include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "Templates/IsFloatingPoint.h"
+
+namespace DcTapeReaderDetails
+{
+
+using FToken = FDcTape::FToken;
+
+static void AddChars(FDcTape& Tape, FToken& Token, const FDcStringViewData& View)
+{
+	int32 Begin = Tape.Chars.Num();
+	switch (View.Type)
+	{
+		case FDcStringViewData::EType::Tchar:
+			Tape.Chars.Append(View.GetTcharPtr(), View.Num);
+			break;
+		case FDcStringViewData::EType::Ascii:
+			for (int32 Ix = 0; Ix < View.Num; Ix++)
+				Tape.Chars.Add((TCHAR)View.GetAsciiPtr()[Ix]);
+			break;
+		case FDcStringViewData::EType::Utf8:
+			Tape.Chars.Reserve(Begin + View.CharNum + 1);
+			DcUtf8::ForEachChar((const uint8*)View.GetUtf8Ptr(), View.Num, [&Tape](TCHAR Ch)
+			{
+				Tape.Chars.Add(Ch);
+				return true;
+			});
+			break;
+		default:
+			Tape.Chars.Append(*View.Owned, View.Owned.Len());
+			break;
+	}
+
+	Token.Span.Begin = Begin;
+	Token.Span.Num = Tape.Chars.Num() - Begin;
+	//	terminated so number literals can go through `Atod`
+	Tape.Chars.Add(TCHAR('\0'));
+}
+
+static FORCEINLINE void AddChars(FDcTape& Tape, FToken& Token, const FString& Str)
+{
+	AddChars(Tape, Token, FDcStringViewData::FromTchar(*Str, Str.Len()));
+}
+
+static FORCEINLINE bool IsIgnoredKey(const FDcTapeReader* Self, int32 Ix)
+{
+	//	only open maps have entries so this stays as short as the nesting
+	for (const FDcTapeReader::FIgnoredKey& Ignored : Self->IgnoredKeys)
+	{
+		if (Ignored.Key == Ix)
+			return true;
+	}
+	return false;
+}
+
+static FORCEINLINE bool EnclosesPosition(const FDcTapeReader* Self, int32 MapIx, int32 Position)
+{
+	//	map end token is still inside, `End` is one past it
+	return MapIx < Position && Position < Self->Tape->Tokens[MapIx].End;
+}
+
+static FORCEINLINE void SkipIgnored(FDcTapeReader* Self)
+{
+	const TArray<FToken>& Tokens = Self->Tape->Tokens;
+	while (Self->Cur < Tokens.Num() && IsIgnoredKey(Self, Self->Cur))
+	{
+		//	key then its value
+		Self->Cur = Tokens[Tokens[Self->Cur].End].End;
+	}
+}
+
+static FORCEINLINE FDcResult PeekToken(FDcTapeReader* Self, const FToken*& OutToken)
+{
+	SkipIgnored(Self);
+	if (Self->Cur >= Self->Tape->Tokens.Num())
+		return DC_FAIL(DcDReadWrite, AlreadyEnded);
+
+	OutToken = &Self->Tape->Tokens[Self->Cur];
+	return DcOk();
+}
+
+static FORCEINLINE FDcResult ReadToken(FDcTapeReader* Self, EDcDataEntry Expect)
+{
+	const FToken* Token;
+	DC_TRY(PeekToken(Self, Token));
+	if (Token->Type != Expect)
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch) << Expect << Token->Type;
+
+	Self->Cur++;
+	return DcOk();
+}
+
+static int32 GetOpenContainer(const FDcTapeReader* Self)
+{
+	const TArray<FToken>& Tokens = Self->Tape->Tokens;
+	if (Self->Cur >= Tokens.Num())
+		return INDEX_NONE;
+
+	//	end tokens point to the root they close, others to the enclosing root
+	return Tokens[Self->Cur].Parent;
+}
+
+template<typename TNumeric>
+static FDcResult ParseLiteral(const FDcTape& Tape, const FToken& Token, TNumeric* OutPtr)
+{
+	const TCHAR* Ptr = Tape.GetChars(Token);
+	int32 Num = Token.Span.Num;
+
+	if (TIsFloatingPoint<TNumeric>::Value)
+	{
+		double Value;
+		if (!DcJsonNumber::TryParseDouble(Ptr, Num, Value))
+			Value = FCString::Atod(Ptr);
+
+		ReadOut(OutPtr, (TNumeric)Value);
+		return DcOk();
+	}
+	else
+	{
+		//	same as JSON reader, fractional part is ignored, exponent and out of range values are rejected
+		bool bNegative = Num > 0 && Ptr[0] == TCHAR('-');
+		int32 SignOffset = bNegative ? 1 : 0;
+		int32 IntNum = SignOffset;
+		while (IntNum < Num && Ptr[IntNum] != TCHAR('.'))
+			IntNum++;
+
+		uint64 Magnitude;
+		TNumeric Value;
+		if (!DcJsonNumber::ParseIntegerMagnitude(Ptr + SignOffset, IntNum - SignOffset, Magnitude)
+			|| !DcJsonNumber::MagnitudeToInteger(Magnitude, bNegative, Value))
+			return DC_FAIL(DcDReadWrite, TapeNumberOutOfRange)
+				<< DcTypeUtils::TDcDataEntryType<TNumeric>::Value << FString(Tape.GetStringView(Token));
+
+		ReadOut(OutPtr, Value);
+		return DcOk();
+	}
+}
+
+template<typename TNumeric>
+static FORCEINLINE TNumeric StoredValue(const FToken& Token)
+{
+	if (TIsFloatingPoint<TNumeric>::Value)
+		return (TNumeric)Token.Double;
+	else if (TIsSigned<TNumeric>::Value)
+		return (TNumeric)Token.Signed64;
+	else
+		return (TNumeric)Token.Unsigned64;
+}
+
+template<typename TNumeric>
+static FDcResult ReadNumeric(FDcTapeReader* Self, TNumeric* OutPtr)
+{
+	constexpr EDcDataEntry Expect = DcTypeUtils::TDcDataEntryType<TNumeric>::Value;
+
+	const FToken* Token;
+	DC_TRY(PeekToken(Self, Token));
+	if (Token->bNumberLiteral)
+	{
+		DC_TRY(ParseLiteral(*Self->Tape, *Token, OutPtr));
+	}
+	else if (Token->Type == Expect)
+	{
+		ReadOut(OutPtr, StoredValue<TNumeric>(*Token));
+	}
+	else
+	{
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch) << Expect << Token->Type;
+	}
+
+	Self->Cur++;
+	return DcOk();
+}
+
+template<typename TNumeric, typename TStore>
+static FORCEINLINE FDcResult BuildNumeric(FDcResult (FDcReader::*Method)(TNumeric*), FDcReader* Reader, TStore& OutStore)
+{
+	TNumeric Value;
+	DC_TRY((Reader->*Method)(&Value));
+	OutStore = (TStore)Value;
+	return DcOk();
+}
+
+} // namespace DcTapeReaderDetails
+
+void FDcTape::Reset()
+{
+	Tokens.Reset();
+	Chars.Reset();
+	Bytes.Reset();
+}
+
+FDcResult FDcTape::Build(FDcReader* Reader)
+{
+	using namespace DcTapeReaderDetails;
+
+	Reset();
+	TArray<int32, TInlineAllocator<16>> Open;
+	while (true)
+	{
+		EDcDataEntry Next;
+		DC_TRY(Reader->PeekRead(&Next));
+		if (Next == EDcDataEntry::Ended)
+			break;
+
+		//	no tokens are added till next iteration so the reference stays valid
+		int32 Ix = Tokens.AddUninitialized();
+		FToken& Token = Tokens[Ix];
+		Token.Type = Next;
+		Token.bNumberLiteral = false;
+		Token.End = Ix + 1;
+		Token.Parent = Open.Num() ? Open.Last() : INDEX_NONE;
+		Token.Unsigned64 = 0;
+
+		switch (Next)
+		{
+			case EDcDataEntry::MapEnd:
+			case EDcDataEntry::ArrayEnd:
+			case EDcDataEntry::SetEnd:
+			case EDcDataEntry::OptionalEnd:
+				break;
+			default:
+				if (Token.Parent != INDEX_NONE)
+					Tokens[Token.Parent].ChildNum++;
+				break;
+		}
+
+		if (DcTypeUtils::IsNumericDataEntry(Next))
+		{
+			//	keep text numbers as is so they're parsed as the type that's asked for
+			bool bLiteral;
+			DC_TRY(Reader->Coercion(EDcDataEntry::String, &bLiteral));
+			if (bLiteral)
+			{
+				FDcStringViewData View;
+				DC_TRY(Reader->ReadStringView(&View));
+				AddChars(*this, Token, View);
+				Token.bNumberLiteral = true;
+				continue;
+			}
+		}
+
+		switch (Next)
+		{
+			case EDcDataEntry::None: DC_TRY(Reader->ReadNone()); break;
+			case EDcDataEntry::Bool: DC_TRY(Reader->ReadBool(&Token.Bool)); break;
+			case EDcDataEntry::Name:
+			{
+				FName Value;
+				DC_TRY(Reader->ReadName(&Value));
+				AddChars(*this, Token, Value.ToString());
+				break;
+			}
+			case EDcDataEntry::String:
+			{
+				FDcStringViewData View;
+				DC_TRY(Reader->ReadStringView(&View));
+				AddChars(*this, Token, View);
+				break;
+			}
+			case EDcDataEntry::Text:
+			{
+				FText Value;
+				DC_TRY(Reader->ReadText(&Value));
+				AddChars(*this, Token, Value.ToString());
+				break;
+			}
+			case EDcDataEntry::Float: DC_TRY(BuildNumeric(&FDcReader::ReadFloat, Reader, Token.Double)); break;
+			case EDcDataEntry::Double: DC_TRY(BuildNumeric(&FDcReader::ReadDouble, Reader, Token.Double)); break;
+			case EDcDataEntry::Int8: DC_TRY(BuildNumeric(&FDcReader::ReadInt8, Reader, Token.Signed64)); break;
+			case EDcDataEntry::Int16: DC_TRY(BuildNumeric(&FDcReader::ReadInt16, Reader, Token.Signed64)); break;
+			case EDcDataEntry::Int32: DC_TRY(BuildNumeric(&FDcReader::ReadInt32, Reader, Token.Signed64)); break;
+			case EDcDataEntry::Int64: DC_TRY(BuildNumeric(&FDcReader::ReadInt64, Reader, Token.Signed64)); break;
+			case EDcDataEntry::UInt8: DC_TRY(BuildNumeric(&FDcReader::ReadUInt8, Reader, Token.Unsigned64)); break;
+			case EDcDataEntry::UInt16: DC_TRY(BuildNumeric(&FDcReader::ReadUInt16, Reader, Token.Unsigned64)); break;
+			case EDcDataEntry::UInt32: DC_TRY(BuildNumeric(&FDcReader::ReadUInt32, Reader, Token.Unsigned64)); break;
+			case EDcDataEntry::UInt64: DC_TRY(BuildNumeric(&FDcReader::ReadUInt64, Reader, Token.Unsigned64)); break;
+			case EDcDataEntry::Blob:
+			{
+				FDcBlobViewData Blob;
+				DC_TRY(Reader->ReadBlob(&Blob));
+				Token.Span.Begin = Bytes.Num();
+				Token.Span.Num = Blob.Num;
+				Bytes.Append(Blob.DataPtr, Blob.Num);
+				break;
+			}
+			case EDcDataEntry::MapRoot: DC_TRY(Reader->ReadMapRoot()); Open.Add(Ix); break;
+			case EDcDataEntry::ArrayRoot: DC_TRY(Reader->ReadArrayRoot()); Open.Add(Ix); break;
+			case EDcDataEntry::SetRoot: DC_TRY(Reader->ReadSetRoot()); Open.Add(Ix); break;
+			case EDcDataEntry::OptionalRoot: DC_TRY(Reader->ReadOptionalRoot()); Open.Add(Ix); break;
+			case EDcDataEntry::MapEnd:
+			case EDcDataEntry::ArrayEnd:
+			case EDcDataEntry::SetEnd:
+			case EDcDataEntry::OptionalEnd:
+			{
+				if (Open.Num() == 0)
+					return DC_FAIL(DcDReadWrite, InvalidStateNoExpect) << Next;
+
+				if (Next == EDcDataEntry::MapEnd) DC_TRY(Reader->ReadMapEnd());
+				else if (Next == EDcDataEntry::ArrayEnd) DC_TRY(Reader->ReadArrayEnd());
+				else if (Next == EDcDataEntry::SetEnd) DC_TRY(Reader->ReadSetEnd());
+				else DC_TRY(Reader->ReadOptionalEnd());
+
+				FToken& Root = Tokens[Open.Pop()];
+				Root.End = Ix + 1;
+				if (Root.Type == EDcDataEntry::MapRoot)
+					Root.ChildNum /= 2;
+				break;
+			}
+			default:
+				return DC_FAIL(DcDReadWrite, TapeUnsupportedDataEntry) << Next;
+		}
+	}
+
+	if (Open.Num() != 0)
+		return DC_FAIL(DcDReadWrite, InvalidStateNoExpect) << EDcDataEntry::Ended;
+
+	return DcOk();
+}
+
+FDcTapeReader::FDcTapeReader(const FDcTape* InTape)
+	: Tape(InTape)
+{}
+
+FDcResult FDcTapeReader::Coercion(EDcDataEntry ToEntry, bool* OutPtr)
+{
+	DcTapeReaderDetails::SkipIgnored(this);
+	if (Cur >= Tape->Tokens.Num())
+		return ReadOutOk(OutPtr, false);
+
+	const FDcTape::FToken& Token = Tape->Tokens[Cur];
+	if (Token.bNumberLiteral)
+	{
+		return ReadOutOk(OutPtr, DcTypeUtils::IsNumericDataEntry(ToEntry)
+			|| ToEntry == EDcDataEntry::String);
+	}
+	else if (Token.Type == EDcDataEntry::String)
+	{
+		return ReadOutOk(OutPtr, ToEntry == EDcDataEntry::Name
+			|| ToEntry == EDcDataEntry::Text);
+	}
+
+	return ReadOutOk(OutPtr, false);
+}
+
+FDcResult FDcTapeReader::PeekRead(EDcDataEntry* OutPtr)
+{
+	DcTapeReaderDetails::SkipIgnored(this);
+	if (Cur >= Tape->Tokens.Num())
+		return ReadOutOk(OutPtr, EDcDataEntry::Ended);
+
+	return ReadOutOk(OutPtr, Tape->Tokens[Cur].Type);
+}
+
+FDcResult FDcTapeReader::ReadNone()
+{
+	return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::None);
+}
+
+FDcResult FDcTapeReader::ReadBool(bool* OutPtr)
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->Type != EDcDataEntry::Bool)
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch) << EDcDataEntry::Bool << Token->Type;
+
+	ReadOut(OutPtr, Token->Bool);
+	Cur++;
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::ReadName(FName* OutPtr)
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->bNumberLiteral
+		|| (Token->Type != EDcDataEntry::Name && Token->Type != EDcDataEntry::String))
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch2)
+			<< EDcDataEntry::Name << EDcDataEntry::String << Token->Type;
+
+	if (Token->Span.Num >= NAME_SIZE)
+		return DC_FAIL(DcDReadWrite, FNameOverSize);
+
+	ReadOut(OutPtr, FName(Token->Span.Num, Tape->GetChars(*Token)));
+	Cur++;
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::ReadString(FString* OutPtr)
+{
+	FDcStringViewData View;
+	DC_TRY(ReadStringView(&View));
+	ReadOut(OutPtr, MoveTemp(View).ToString());
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::ReadStringView(FDcStringViewData* OutPtr)
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->Type != EDcDataEntry::String && !Token->bNumberLiteral)
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch) << EDcDataEntry::String << Token->Type;
+
+	ReadOut(OutPtr, FDcStringViewData::FromTchar(Tape->GetChars(*Token), Token->Span.Num));
+	Cur++;
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::ReadText(FText* OutPtr)
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->bNumberLiteral
+		|| (Token->Type != EDcDataEntry::Text && Token->Type != EDcDataEntry::String))
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch2)
+			<< EDcDataEntry::Text << EDcDataEntry::String << Token->Type;
+
+	ReadOut(OutPtr, FText::FromString(FString(Tape->GetStringView(*Token))));
+	Cur++;
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::ReadMapRoot() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::MapRoot); }
+FDcResult FDcTapeReader::ReadMapEnd()
+{
+	DC_TRY(DcTapeReaderDetails::ReadToken(this, EDcDataEntry::MapEnd));
+
+	int32 MapIx = Tape->Tokens[Cur - 1].Parent;
+	while (IgnoredKeys.Num() && IgnoredKeys.Last().Map == MapIx)
+		IgnoredKeys.Pop();
+
+	return DcOk();
+}
+FDcResult FDcTapeReader::ReadArrayRoot() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::ArrayRoot); }
+FDcResult FDcTapeReader::ReadArrayEnd() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::ArrayEnd); }
+FDcResult FDcTapeReader::ReadSetRoot() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::SetRoot); }
+FDcResult FDcTapeReader::ReadSetEnd() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::SetEnd); }
+FDcResult FDcTapeReader::ReadOptionalRoot() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::OptionalRoot); }
+FDcResult FDcTapeReader::ReadOptionalEnd() { return DcTapeReaderDetails::ReadToken(this, EDcDataEntry::OptionalEnd); }
+
+FDcResult FDcTapeReader::ReadInt8(int8* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadInt16(int16* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadInt32(int32* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadInt64(int64* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+
+FDcResult FDcTapeReader::ReadUInt8(uint8* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadUInt16(uint16* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadUInt32(uint32* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadUInt64(uint64* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+
+FDcResult FDcTapeReader::ReadFloat(float* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+FDcResult FDcTapeReader::ReadDouble(double* OutPtr) { return DcTapeReaderDetails::ReadNumeric(this, OutPtr); }
+
+FDcResult FDcTapeReader::ReadBlob(FDcBlobViewData* OutPtr)
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->Type != EDcDataEntry::Blob)
+		return DC_FAIL(DcDReadWrite, DataTypeMismatch) << EDcDataEntry::Blob << Token->Type;
+
+	ReadOut(OutPtr, FDcBlobViewData{
+		const_cast<uint8*>(Tape->Bytes.GetData()) + Token->Span.Begin,
+		Token->Span.Num
+	});
+	Cur++;
+	return DcOk();
+}
+
+FDcResult FDcTapeReader::PeekContainerSize(int32* OutPtr)
+{
+	using namespace DcTapeReaderDetails;
+
+	int32 RootIx = GetOpenContainer(this);
+	if (RootIx == INDEX_NONE)
+		return ReadOutOk(OutPtr, INDEX_NONE);
+
+	const FToken& Root = Tape->Tokens[RootIx];
+	if (Cur == RootIx + 1 && IgnoredKeys.Num() == 0)
+		return ReadOutOk(OutPtr, Root.ChildNum);
+
+	int32 Num = 0;
+	int32 EndIx = Root.End - 1;
+	for (int32 Ix = Cur; Ix < EndIx; Ix = Tape->Tokens[Ix].End)
+	{
+		if (IsIgnoredKey(this, Ix))
+			Ix = Tape->Tokens[Ix].End;
+		else
+			Num++;
+	}
+
+	if (Root.Type == EDcDataEntry::MapRoot)
+		Num /= 2;
+
+	return ReadOutOk(OutPtr, Num);
+}
+
+FDcResult FDcTapeReader::SkipValue()
+{
+	const FDcTape::FToken* Token;
+	DC_TRY(DcTapeReaderDetails::PeekToken(this, Token));
+	if (Token->Parent != INDEX_NONE && Tape->Tokens[Token->Parent].End == Cur + 1)
+		return DC_FAIL(DcDReadWrite, InvalidStateNoExpect) << Token->Type;
+
+	Cur = Token->End;
+	return DcOk();
+}
+
+void FDcTapeReader::Rewind(int32 Position)
+{
+	check(Position >= 0 && Position <= Tape->Tokens.Num());
+	Cur = Position;
+
+	while (IgnoredKeys.Num() && !DcTapeReaderDetails::EnclosesPosition(this, IgnoredKeys.Last().Map, Position))
+		IgnoredKeys.Pop();
+}
+
+int32 FDcTapeReader::FindMapKey(FStringView Key) const
+{
+	int32 RootIx = DcTapeReaderDetails::GetOpenContainer(this);
+	if (RootIx == INDEX_NONE)
+		return INDEX_NONE;
+
+	const TArray<FDcTape::FToken>& Tokens = Tape->Tokens;
+	if (Tokens[RootIx].Type != EDcDataEntry::MapRoot)
+		return INDEX_NONE;
+
+	int32 EndIx = Tokens[RootIx].End - 1;
+	for (int32 Ix = RootIx + 1; Ix < EndIx; Ix = Tokens[Tokens[Ix].End].End)
+	{
+		const FDcTape::FToken& KeyToken = Tokens[Ix];
+		if ((KeyToken.Type == EDcDataEntry::String || KeyToken.Type == EDcDataEntry::Name)
+			&& !KeyToken.bNumberLiteral
+			&& !DcTapeReaderDetails::IsIgnoredKey(this, Ix)
+			&& Tape->GetStringView(KeyToken).Equals(Key, ESearchCase::CaseSensitive))
+			return Ix;
+	}
+
+	return INDEX_NONE;
+}
+
+void FDcTapeReader::IgnoreMapEntry(int32 KeyPosition)
+{
+	const FDcTape::FToken& KeyToken = Tape->Tokens[KeyPosition];
+	check(KeyToken.Parent != INDEX_NONE && Tape->Tokens[KeyToken.Parent].Type == EDcDataEntry::MapRoot);
+	check(IgnoredKeys.Num() == 0 || IgnoredKeys.Last().Map <= KeyToken.Parent);
+	if (!DcTapeReaderDetails::IsIgnoredKey(this, KeyPosition))
+		IgnoredKeys.Add({KeyToken.Parent, KeyPosition});
+}
+
+FDcResult FDcTapeReader::ReadMapStringByKey(FStringView Key, FString* OutPtr, bool* OutFound)
+{
+	int32 KeyIx = FindMapKey(Key);
+	if (KeyIx == INDEX_NONE)
+		return ReadOutOk(OutFound, false);
+
+	{
+		TDcStoreThenReset<int32> RestoreCur(Cur, Tape->Tokens[KeyIx].End);
+		DC_TRY(ReadString(OutPtr));
+	}
+
+	IgnoreMapEntry(KeyIx);
+	return ReadOutOk(OutFound, true);
+}
+
+FDcResult FDcTapeReader::ReadMapStringByKey(FStringView Key, FDcStringViewData* OutPtr, bool* OutFound)
+{
+	int32 KeyIx = FindMapKey(Key);
+	if (KeyIx == INDEX_NONE)
+		return ReadOutOk(OutFound, false);
+
+	{
+		TDcStoreThenReset<int32> RestoreCur(Cur, Tape->Tokens[KeyIx].End);
+		DC_TRY(ReadStringView(OutPtr));
+	}
+
+	IgnoreMapEntry(KeyIx);
+	return ReadOutOk(OutFound, true);
+}
+
+void FDcTapeReader::FormatDiagnostic(FDcDiagnostic& Diag)
+{
+	FDcDiagnosticHighlight Highlight(this, ClassId().ToString());
+	Highlight.Formatted = FString::Printf(TEXT("(Tape: %d / %d)"), Cur, Tape->Tokens.Num());
+	Diag << MoveTemp(Highlight);
+}
+
+FName FDcTapeReader::ClassId() { return FName(TEXT("DcTapeReader")); }
+FName FDcTapeReader::GetId() { return ClassId(); }
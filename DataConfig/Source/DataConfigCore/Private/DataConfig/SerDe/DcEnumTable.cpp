@@ -0,0 +1,212 @@
+#include "DataConfig/SerDe/DcEnumTable.h"
+#include "DataConfig/Misc/DcUtf8.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Class.h"
+
+namespace DcEnumTableDetails
+{
+
+using FTableRef = TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe>;
+
+static FRWLock TablesLock;
+static TMap<UEnum*, FTableRef> Tables;
+
+static bool IsBitFlags(UEnum* Enum)
+{
+#if WITH_EDITORONLY_DATA
+
+	#if WITH_METADATA
+	return Enum->HasMetaData(TEXT("Bitflags"));
+	#else
+	//	Program target is missing `UEnum::HasMetaData`
+	return ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
+	#endif
+
+#else // WITH_EDITORONLY_DATA
+	return false;
+#endif // WITH_EDITORONLY_DATA
+}
+
+static bool EqualsIgnoreCase(const FDcStringViewData& Lhs, const FString& Rhs)
+{
+	if (Lhs.Len() != Rhs.Len())
+		return false;
+
+	if (Lhs.Type == FDcStringViewData::EType::Utf8)
+	{
+		int32 Ix = 0;
+		return DcUtf8::ForEachChar((const uint8*)Lhs.GetUtf8Ptr(), Lhs.Num, [&Rhs, &Ix](TCHAR Ch)
+		{
+			return FChar::ToLower(Ch) == FChar::ToLower(Rhs[Ix++]);
+		});
+	}
+
+	for (int32 Ix = 0; Ix < Rhs.Len(); Ix++)
+	{
+		if (FChar::ToLower(Lhs.GetChar(Ix)) != FChar::ToLower(Rhs[Ix]))
+			return false;
+	}
+	return true;
+}
+
+static FTableRef Build(UEnum* Enum)
+{
+	TSharedRef<FDcEnumTable, ESPMode::ThreadSafe> Table = MakeShared<FDcEnumTable, ESPMode::ThreadSafe>();
+	Table->Enum = Enum;
+	Table->NumEnums = Enum->NumEnums();
+	Table->bIsBitFlags = IsBitFlags(Enum);
+
+	const int32 Num = Table->NumEnums;
+	Table->Names.Reserve(Num);
+	Table->Values.Reserve(Num);
+	for (int32 Ix = 0; Ix < Num; Ix++)
+	{
+		Table->Names.Add(Enum->GetNameStringByIndex(Ix));
+		Table->Values.Add(Enum->GetValueByIndex(Ix));
+
+		if (FPlatformMath::CountBits(Table->Values[Ix]) != 0)
+			Table->FlagIndices.Add(Ix);
+
+		auto _AddNameKey = [&Table, Ix](FString&& Str)
+		{
+			uint32 Hash = FDcEnumTable::HashName(FDcStringViewData::FromTchar(*Str, Str.Len()));
+			Table->NameKeyHashes.Add(Hash, Table->NameKeys.Num());
+			Table->NameKeys.Add({MoveTemp(Str), Ix});
+		};
+
+		FString FullName = Enum->GetNameByIndex(Ix).ToString();
+		if (FullName != Table->Names[Ix])
+			_AddNameKey(MoveTemp(FullName));
+		_AddNameKey(CopyTemp(Table->Names[Ix]));
+	}
+
+	if (Num > 0)
+	{
+		int64 Min = Table->Values[0];
+		int64 Max = Table->Values[0];
+		for (int64 Value : Table->Values)
+		{
+			Min = FMath::Min(Min, Value);
+			Max = FMath::Max(Max, Value);
+		}
+
+		uint64 Range = (uint64)Max - (uint64)Min + 1;
+		if (Range != 0 && Range <= (uint64)Num * 2 + 16)
+		{
+			Table->DenseMin = Min;
+			Table->DenseIndices.Init(INDEX_NONE, (int32)Range);
+			for (int32 Ix = 0; Ix < Num; Ix++)
+			{
+				int32& Slot = Table->DenseIndices[(int32)((uint64)Table->Values[Ix] - (uint64)Min)];
+				if (Slot == INDEX_NONE)
+					Slot = Ix;
+			}
+		}
+		else
+		{
+			for (int32 Ix = 0; Ix < Num; Ix++)
+				Table->SortedIndices.Add({Table->Values[Ix], Ix});
+
+			//	stable keeps the first index for duplicated values in front
+			Algo::StableSortBy(Table->SortedIndices, [](const TPair<int64, int32>& Pair) { return Pair.Key; });
+		}
+	}
+
+	return Table;
+}
+
+} // namespace DcEnumTableDetails
+
+uint32 FDcEnumTable::HashName(const FDcStringViewData& Name)
+{
+	//	FNV-1a
+	uint32 Hash = 2166136261u;
+	auto _Step = [&Hash](TCHAR Ch)
+	{
+		Hash = (Hash ^ (uint32)FChar::ToLower(Ch)) * 16777619u;
+		return true;
+	};
+
+	if (Name.Type == FDcStringViewData::EType::Utf8)
+	{
+		DcUtf8::ForEachChar((const uint8*)Name.GetUtf8Ptr(), Name.Num, _Step);
+	}
+	else
+	{
+		int32 Len = Name.Len();
+		for (int32 Ix = 0; Ix < Len; Ix++)
+			_Step(Name.GetChar(Ix));
+	}
+
+	return Hash;
+}
+
+bool FDcEnumTable::FindValueByName(const FDcStringViewData& Name, int64& OutValue) const
+{
+	for (auto It = NameKeyHashes.CreateConstKeyIterator(HashName(Name)); It; ++It)
+	{
+		const FNameKey& Key = NameKeys[It.Value()];
+		if (DcEnumTableDetails::EqualsIgnoreCase(Name, Key.Str))
+		{
+			OutValue = Values[Key.Index];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 FDcEnumTable::FindIndexByValue(int64 Value) const
+{
+	if (DenseIndices.Num())
+	{
+		uint64 Offset = (uint64)Value - (uint64)DenseMin;
+		return Offset < (uint64)DenseIndices.Num()
+			? DenseIndices[(int32)Offset]
+			: INDEX_NONE;
+	}
+
+	int32 Ix = Algo::LowerBoundBy(SortedIndices, Value, [](const TPair<int64, int32>& Pair) { return Pair.Key; });
+	return Ix < SortedIndices.Num() && SortedIndices[Ix].Key == Value
+		? SortedIndices[Ix].Value
+		: INDEX_NONE;
+}
+
+TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> FDcEnumTable::Get(UEnum* Enum)
+{
+	using namespace DcEnumTableDetails;
+	check(Enum);
+
+	{
+		FReadScopeLock ReadLock(TablesLock);
+		if (const FTableRef* TablePtr = Tables.Find(Enum))
+		{
+			const FDcEnumTable& Table = TablePtr->Get();
+			//	rebuild when the enum got collected or modified
+			if (Table.Enum.Get() == Enum && Table.NumEnums == Enum->NumEnums())
+				return *TablePtr;
+		}
+	}
+
+	FTableRef Table = Build(Enum);
+	FWriteScopeLock WriteLock(TablesLock);
+	Tables.Add(Enum, Table);
+	return Table;
+}
+
+void FDcEnumTable::Invalidate(UEnum* Enum)
+{
+	using namespace DcEnumTableDetails;
+	FWriteScopeLock WriteLock(TablesLock);
+	Tables.Remove(Enum);
+}
+
+void FDcEnumTable::ResetCache()
+{
+	using namespace DcEnumTableDetails;
+	FWriteScopeLock WriteLock(TablesLock);
+	Tables.Empty();
+}
+
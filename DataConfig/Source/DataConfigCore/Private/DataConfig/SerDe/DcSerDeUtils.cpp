@@ -24,6 +24,20 @@ FDcResult ExpectMetaKey(const FString& Actual, const TCHAR* Expect)
 			<< Expect << Actual;
 }
 
+bool IsMeta(const FDcStringViewData& Str)
+{
+	return !Str.IsEmpty()
+		&& Str.GetChar(0) == TEXT('$');
+}
+
+FDcResult ExpectMetaKey(const FDcStringViewData& Actual, const TCHAR* Expect)
+{
+	return Actual.Equals(Expect)
+		? DcOk()
+		: DC_FAIL(DcDSerDe, MetaKeyMismatch)
+			<< Expect << Actual.ToString();
+}
+
 
 FDcResult DispatchPipeVisit(EDcDataEntry Next, FDcReader* Reader, FDcWriter* Writer)
 {
@@ -255,6 +269,10 @@ FDcResult DispatchNoopRead(EDcDataEntry Next, FDcReader* Reader)
 			return Reader->ReadSetRoot();
 		case EDcDataEntry::SetEnd:
 			return Reader->ReadSetEnd();
+		case EDcDataEntry::OptionalRoot:
+			return Reader->ReadOptionalRoot();
+		case EDcDataEntry::OptionalEnd:
+			return Reader->ReadOptionalEnd();
 		case EDcDataEntry::ObjectReference:
 			return Reader->ReadObjectReference(nullptr);
 		case EDcDataEntry::ClassReference:
@@ -288,120 +306,7 @@ FDcResult DispatchNoopRead(EDcDataEntry Next, FDcReader* Reader)
 
 FDcResult ReadNoopConsumeValue(FDcReader* Reader)
 {
-	EDcDataEntry Next;
-	DC_TRY(Reader->PeekRead(&Next));
-
-	switch(Next)
-	{
-		case EDcDataEntry::ArrayRoot:
-		{
-			int ArrayCount = 1;
-			DC_TRY(Reader->ReadArrayRoot());
-			while (true)
-			{
-				EDcDataEntry Cur;
-				DC_TRY(Reader->PeekRead(&Cur));
-
-				if (Cur == EDcDataEntry::ArrayEnd)
-					--ArrayCount;
-				else if (Cur == EDcDataEntry::ArrayRoot)
-					++ArrayCount;
-
-				DC_TRY(DispatchNoopRead(Cur, Reader));
-				if (ArrayCount == 0)
-					return DcOk();
-			}
-			break;
-		}
-		case EDcDataEntry::MapRoot:
-		{
-			int MapCount = 1;
-			DC_TRY(Reader->ReadMapRoot());
-			while (true)
-			{
-				EDcDataEntry Cur;
-				DC_TRY(Reader->PeekRead(&Cur));
-
-				if (Cur == EDcDataEntry::MapEnd)
-					--MapCount;
-				else if (Cur == EDcDataEntry::MapRoot)
-					++MapCount;
-
-				DC_TRY(DispatchNoopRead(Cur, Reader));
-				if (MapCount == 0)
-					return DcOk();
-			}
-			break;
-		}
-		case EDcDataEntry::SetRoot:
-		{
-			int SetCount = 1;
-			DC_TRY(Reader->ReadSetRoot());
-			while (true)
-			{
-				EDcDataEntry Cur;
-				DC_TRY(Reader->PeekRead(&Cur));
-
-				if (Cur == EDcDataEntry::SetEnd)
-					--SetCount;
-				else if (Cur == EDcDataEntry::SetRoot)
-					++SetCount;
-
-				DC_TRY(DispatchNoopRead(Cur, Reader));
-				if (SetCount == 0)
-					return DcOk();
-			}
-			break;
-		}
-		case EDcDataEntry::ClassRoot:
-		{
-			int ClassCount = 1;
-			DC_TRY(Reader->ReadClassRoot());
-			while (true)
-			{
-				EDcDataEntry Cur;
-				DC_TRY(Reader->PeekRead(&Cur));
-
-				if (Cur == EDcDataEntry::ClassEnd)
-					--ClassCount;
-				else if (Cur == EDcDataEntry::ClassRoot)
-					++ClassCount;
-
-				DC_TRY(DispatchNoopRead(Cur, Reader));
-				if (ClassCount == 0)
-					return DcOk();
-			}
-			break;
-		}
-		case EDcDataEntry::StructRoot:
-		{
-			int StructCount = 1;
-			DC_TRY(Reader->ReadStructRoot());
-			while (true)
-			{
-				EDcDataEntry Cur;
-				DC_TRY(Reader->PeekRead(&Cur));
-
-				if (Cur == EDcDataEntry::StructEnd)
-					--StructCount;
-				else if (Cur == EDcDataEntry::StructRoot)
-					++StructCount;
-
-				DC_TRY(DispatchNoopRead(Cur, Reader));
-				if (StructCount == 0)
-					return DcOk();
-			}
-			break;
-		}
-		default:
-		{
-			DC_TRY(DispatchNoopRead(Next, Reader));
-			break;
-		}
-	}
-
-	return DcOk();
+	return Reader->SkipValue();
 }
 
-
 }	// namespace DcSerDeUtils
@@ -10,7 +10,7 @@
 namespace DcSerializerDetails
 {
 
-static FORCEINLINE FDcResult ExecuteSerializeHandler(FDcSerializeContext& Ctx, FDcSerializeDelegate& Handler)
+static FORCEINLINE FDcResult ExecuteSerializeHandler(FDcSerializeContext& Ctx, const FDcSerializeDelegate& Handler)
 {
 	if (!Handler.IsBound())
 		return DC_FAIL(DcDCommon, StaleDelegate);
@@ -18,23 +18,24 @@ static FORCEINLINE FDcResult ExecuteSerializeHandler(FDcSerializeContext& Ctx, F
 	return Handler.Execute(Ctx);
 }
 
-static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
+//	handler containers of either the instance or its frozen snapshot
+struct FHandlers
 {
-	//	try predicated serializers first, if not handled then try direct handlers
-	for (auto& PredEntry : Self->PredicatedSerializers)
-	{
-		if (!PredEntry.Predicate.IsBound())
-			return DC_FAIL(DcDCommon, StaleDelegate);
+	const TArray<FDcSerializer::FPredicatedHandlerEntry>& PredicatedSerializers;
+	const TMap<UClass*, FDcSerializeDelegate>& UClassSerializerMap;
+	const TMap<FFieldClass*, FDcSerializeDelegate>& FieldClassSerializerMap;
+	const TMap<UStruct*, FDcSerializeDelegate>& StructSerializerMap;
+};
 
-		if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
-			return ExecuteSerializeHandler(Ctx, PredEntry.Handler);
-	}
+using FResolutionCache = TMap<FDcSerializer::FResolutionKey, FDcSerializer::FResolutionEntry>;
 
+static FDcResult ResolveDirectHandler(const FHandlers& Handlers, FDcSerializeContext& Ctx, const FDcSerializeDelegate*& OutHandlerPtr)
+{
 	FFieldVariant& Property = Ctx.TopProperty();
-	FDcSerializeDelegate* HandlerPtr = nullptr;
+	const FDcSerializeDelegate* HandlerPtr = nullptr;
 
 	if (UStruct* Struct = DcPropertyUtils::TryGetStruct(Property))
-		HandlerPtr = Self->StructSerializerMap.Find(Struct);
+		HandlerPtr = Handlers.StructSerializerMap.Find(Struct);
 
 	if (!HandlerPtr)
 	{
@@ -43,7 +44,7 @@ static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
 			UObject* Object = CastChecked<UObject>(Property.ToUObjectUnsafe());
 			check(IsValid(Object));
 			UClass* Class = Object->GetClass();
-			HandlerPtr = Self->UClassSerializerMap.Find(Class);
+			HandlerPtr = Handlers.UClassSerializerMap.Find(Class);
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << Class->GetFName();
@@ -53,34 +54,199 @@ static FDcResult SerializeBody(FDcSerializer* Self, FDcSerializeContext& Ctx)
 			FField* Field = Property.ToFieldUnsafe();
 			check(Field->IsValidLowLevel());
 			FFieldClass* FieldClass = Field->GetClass();
-			HandlerPtr = Self->FieldClassSerializerMap.Find(FieldClass);
+			HandlerPtr = Handlers.FieldClassSerializerMap.Find(FieldClass);
 			if (HandlerPtr == nullptr)
 				return DC_FAIL(DcDSerDe, NoMatchingHandler)
 					<< Ctx.TopProperty().GetFName() << FieldClass->GetFName();
 		}
 	}
 
+	OutHandlerPtr = HandlerPtr;
+	return DcOk();
+}
+
+static FDcResult SerializeBody(const FHandlers& Handlers, FDcSerializeContext& Ctx)
+{
+	//	try predicated serializers first, if not handled then try direct handlers
+	for (auto& PredEntry : Handlers.PredicatedSerializers)
+	{
+		if (!PredEntry.Predicate.IsBound())
+			return DC_FAIL(DcDCommon, StaleDelegate);
+
+		if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
+			return ExecuteSerializeHandler(Ctx, PredEntry.Handler);
+	}
+
+	const FDcSerializeDelegate* HandlerPtr = nullptr;
+	DC_TRY(ResolveDirectHandler(Handlers, Ctx, HandlerPtr));
+
 	return ExecuteSerializeHandler(Ctx, *HandlerPtr);
 }
 
-static void AmendDiagnostic(FDcDiagnostic& Diag, FDcSerializeContext& Ctx)
+static FORCEINLINE bool IsPure(const FDcSerializer::FPredicatedHandlerEntry& PredEntry)
 {
-	if (Diag.Highlights.IndexOfByPredicate([&Ctx](auto& Highlight){
-		return Highlight.Owner == Ctx.Serializer;}) != INDEX_NONE)
-		return;
+	return PredEntry.Flag == EDcSerializePredicateFlag::Pure;
+}
 
-	FDcDiagnosticHighlight Highlight(Ctx.Serializer, TEXT("DcSerializer"));
+static void CheckResolutionCacheStale(FDcSerializer* Self)
+{
+	int32 Nums[4] = {
+		Self->PredicatedSerializers.Num(),
+		Self->UClassSerializerMap.Num(),
+		Self->FieldClassSerializerMap.Num(),
+		Self->StructSerializerMap.Num(),
+	};
+
+	if (FMemory::Memcmp(Nums, Self->ResolutionHandlerNums, sizeof(Nums)) != 0)
+	{
+		Self->ResolutionCache.Reset();
+		FMemory::Memcpy(Self->ResolutionHandlerNums, Nums, sizeof(Nums));
+	}
+}
+
+//	frozen instances are shared so each thread memoizes on its own. Slots are tagged by generation,
+//	which is unique per `Freeze` and `ResetResolutionCache`, thus entries of a destroyed instance
+//	never match. Returned cache is only valid until the next call on this thread.
+static FResolutionCache& GetThreadResolutionCache(FDcSerializer* Self)
+{
+	struct FSlot
+	{
+		int32 Generation;
+		FResolutionCache Cache;
+	};
+
+	constexpr int32 MaxSlots = 4;
+	static thread_local TArray<FSlot, TInlineAllocator<MaxSlots>> Slots;
+
+	int32 Generation = Self->ResolutionGeneration.GetValue();
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Generation == Generation)
+			return Slot.Cache;
+	}
+
+	if (Slots.Num() == MaxSlots)
+		Slots.RemoveAt(0);
+
+	FSlot& Slot = Slots.AddDefaulted_GetRef();
+	Slot.Generation = Generation;
+	return Slot.Cache;
+}
+
+static FDcResult SerializeBodyCached(const FHandlers& Handlers, FResolutionCache& Cache, FDcSerializer::FResolutionStats* Stats, FDcSerializeContext& Ctx)
+{
+	FFieldVariant& Property = Ctx.TopProperty();
+	FDcSerializer::FResolutionKey Key{
+		Property.IsUObject() ? (void*)Property.ToUObjectUnsafe() : (void*)Property.ToFieldUnsafe(),
+		Ctx.Reader->IsReadingScalarArrayItem()
+	};
+
+	const TArray<FDcSerializer::FPredicatedHandlerEntry>& Entries = Handlers.PredicatedSerializers;
+	if (const FDcSerializer::FResolutionEntry* CachedPtr = Cache.Find(Key))
+	{
+		//	copy out as `Cache` can be touched by nested serialization
+		FDcSerializer::FResolutionEntry Cached = *CachedPtr;
+		if (Stats)
+			Stats->Hits++;
+
+		//	impure predicates ordered before the cached decision still need to run
+		int32 EndIx = Cached.PredicateIx == INDEX_NONE ? Entries.Num() : Cached.PredicateIx;
+		for (int32 Ix = 0; Ix < EndIx; Ix++)
+		{
+			auto& PredEntry = Entries[Ix];
+			if (IsPure(PredEntry))
+				continue;
+
+			if (!PredEntry.Predicate.IsBound())
+				return DC_FAIL(DcDCommon, StaleDelegate);
+
+			if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
+				return ExecuteSerializeHandler(Ctx, PredEntry.Handler);
+		}
+
+		return Cached.PredicateIx == INDEX_NONE
+			? ExecuteSerializeHandler(Ctx, *Cached.DirectHandler)
+			: ExecuteSerializeHandler(Ctx, Entries[Cached.PredicateIx].Handler);
+	}
+
+	if (Stats)
+		Stats->Misses++;
+	for (int32 Ix = 0; Ix < Entries.Num(); Ix++)
+	{
+		auto& PredEntry = Entries[Ix];
+		if (!PredEntry.Predicate.IsBound())
+			return DC_FAIL(DcDCommon, StaleDelegate);
+
+		if (PredEntry.Predicate.Execute(Ctx) == EDcSerializePredicateResult::Process)
+		{
+			//	decisions of impure predicates aren't cached as pure ones after it are unknown
+			if (IsPure(PredEntry))
+				Cache.Add(Key, {Ix, nullptr});
+
+			return ExecuteSerializeHandler(Ctx, PredEntry.Handler);
+		}
+	}
+
+	const FDcSerializeDelegate* HandlerPtr = nullptr;
+	DC_TRY(ResolveDirectHandler(Handlers, Ctx, HandlerPtr));
+	Cache.Add(Key, {INDEX_NONE, HandlerPtr});
+
+	return ExecuteSerializeHandler(Ctx, *HandlerPtr);
+}
+
+static FORCEINLINE FDcResult Resolve(FDcSerializer* Self, FDcSerializeContext& Ctx)
+{
+	if (Self->IsFrozen())
+	{
+		const FDcSerializer::FFrozenHandlers& Frozen = *Self->Frozen;
+		checkf(Self->PredicatedSerializers.Num() == 0
+			&& Self->UClassSerializerMap.Num() == 0
+			&& Self->FieldClassSerializerMap.Num() == 0
+			&& Self->StructSerializerMap.Num() == 0
+			&& Self->bUseResolutionCache == Frozen.bUseResolutionCache,
+			TEXT("Frozen serializer modified"));
+
+		FHandlers Handlers{
+			Frozen.PredicatedSerializers,
+			Frozen.UClassSerializerMap,
+			Frozen.FieldClassSerializerMap,
+			Frozen.StructSerializerMap,
+		};
+
+		return Frozen.bUseResolutionCache
+			? SerializeBodyCached(Handlers, GetThreadResolutionCache(Self), nullptr, Ctx)
+			: SerializeBody(Handlers, Ctx);
+	}
+
+	FHandlers Handlers{
+		Self->PredicatedSerializers,
+		Self->UClassSerializerMap,
+		Self->FieldClassSerializerMap,
+		Self->StructSerializerMap,
+	};
+
+	if (Self->bUseResolutionCache)
+	{
+		CheckResolutionCacheStale(Self);
+		return SerializeBodyCached(Handlers, Self->ResolutionCache, &Self->ResolutionStats, Ctx);
+	}
+
+	return SerializeBody(Handlers, Ctx);
+}
+
+static FString FormatContextStack(TArrayView<const FName> PropertyNames)
+{
 	TStringBuilder<1024> Sb;
 	Sb.Append(TEXT("\n### Properties"));
 	{
-		int Num = Ctx.Properties.Num();
+		int Num = PropertyNames.Num();
 		if (Num)
 		{
 			Sb.Appendf(TEXT(" (%d) :"), Num);
-			for (FFieldVariant& Field : Ctx.Properties)
+			for (const FName& Name : PropertyNames)
 			{
 				Sb.Append(TEXT("\n  - "));
-				Sb.Append(Field.GetName());
+				Sb.Append(Name.ToString());
 			}
 		}
 		else
@@ -89,7 +255,34 @@ static void AmendDiagnostic(FDcDiagnostic& Diag, FDcSerializeContext& Ctx)
 		}
 	}
 
-	Highlight.Formatted = Sb.ToString();
+	return Sb.ToString();
+}
+
+static void AmendDiagnostic(FDcDiagnostic& Diag, FDcSerializeContext& Ctx)
+{
+	if (Diag.Highlights.IndexOfByPredicate([&Ctx](auto& Highlight){
+		return Highlight.Owner == Ctx.Serializer;}) != INDEX_NONE)
+		return;
+
+	FDcDiagnosticHighlight Highlight(Ctx.Serializer, TEXT("DcSerializer"));
+
+	TArray<FName> PropertyNames;
+	PropertyNames.Reserve(Ctx.Properties.Num());
+	for (FFieldVariant& Field : Ctx.Properties)
+		PropertyNames.Add(Field.GetFName());
+
+	if (DcEnv().DiagMode == EDcDiagMode::Deferred)
+	{
+		Highlight.DeferredFormat = [PropertyNames = MoveTemp(PropertyNames)](FDcDiagnosticHighlight& Self)
+		{
+			Self.Formatted = FormatContextStack(PropertyNames);
+		};
+	}
+	else
+	{
+		Highlight.Formatted = FormatContextStack(PropertyNames);
+	}
+
 	Diag << MoveTemp(Highlight);
 }
 
@@ -101,6 +294,9 @@ FDcResult FDcSerializer::Serialize(FDcSerializeContext& Ctx)
 	auto _AmendDiag = [](FDcSerializeContext& Ctx)
 	{
 		FDcDiagnostic& Diag = DcEnv().GetLastDiag();
+		if (Diag.bMuted)
+			return;
+
 		DcDiagnosticUtils::AmendDiagnostic(Diag, Ctx.Reader, Ctx.Writer);
 		DcSerializerDetails::AmendDiagnostic(Diag, Ctx);
 	};
@@ -119,14 +315,14 @@ FDcResult FDcSerializer::Serialize(FDcSerializeContext& Ctx)
 			Ctx.State = ECtxState::SerializeEnded;
 		};
 
-		FDcResult Result = DcSerializerDetails::SerializeBody(this, Ctx);
+		FDcResult Result = DcSerializerDetails::Resolve(this, Ctx);
 		if (!Result.Ok()) _AmendDiag(Ctx);
 
 		return Result;
 	}
 	else if (Ctx.State == ECtxState::SerializeInProgress)
 	{
-		FDcResult Result = DcSerializerDetails::SerializeBody(this, Ctx);
+		FDcResult Result = DcSerializerDetails::Resolve(this, Ctx);
 		if (!Result.Ok()) _AmendDiag(Ctx);
 
 		return Result;
@@ -139,24 +335,67 @@ FDcResult FDcSerializer::Serialize(FDcSerializeContext& Ctx)
 
 void FDcSerializer::AddDirectHandler(UClass* PropertyClass, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(PropertyClass && !UClassSerializerMap.Contains(PropertyClass));
 	UClassSerializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
 void FDcSerializer::AddDirectHandler(FFieldClass* PropertyClass, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(PropertyClass && !FieldClassSerializerMap.Contains(PropertyClass));
 	FieldClassSerializerMap.Add(PropertyClass, MoveTemp(Delegate));
 }
 
-void FDcSerializer::AddPredicatedHandler(FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name)
+void FDcSerializer::AddPredicatedHandler(FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name, EDcSerializePredicateFlag Flag)
 {
-	PredicatedSerializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name});
+	check(!bFrozen);
+	ResetResolutionCache();
+	PredicatedSerializers.Add(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name, Flag});
 }
 
 void FDcSerializer::AddStructHandler(UStruct* Struct, FDcSerializeDelegate&& Delegate)
 {
+	check(!bFrozen);
+	ResetResolutionCache();
 	check(Struct && !StructSerializerMap.Contains(Struct));
 	StructSerializerMap.Add(Struct, MoveTemp(Delegate));
 }
 
+void FDcSerializer::InsertPredicatedHandler(int32 Index, FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name, EDcSerializePredicateFlag Flag)
+{
+	check(!bFrozen);
+	ResetResolutionCache();
+	PredicatedSerializers.Insert(FPredicatedHandlerEntry{MoveTemp(Predicate), MoveTemp(Delegate), Name, Flag}, Index);
+}
+
+void FDcSerializer::ResetResolutionCache()
+{
+	static FThreadSafeCounter NextGeneration;
+
+	ResolutionCache.Reset();
+	ResolutionGeneration.Set(NextGeneration.Increment());
+}
+
+void FDcSerializer::Freeze()
+{
+	check(!bFrozen);
+
+	FFrozenHandlers* Handlers = new FFrozenHandlers();
+	Handlers->PredicatedSerializers = MoveTemp(PredicatedSerializers);
+	Handlers->UClassSerializerMap = MoveTemp(UClassSerializerMap);
+	Handlers->FieldClassSerializerMap = MoveTemp(FieldClassSerializerMap);
+	Handlers->StructSerializerMap = MoveTemp(StructSerializerMap);
+	Handlers->bUseResolutionCache = bUseResolutionCache;
+
+	PredicatedSerializers.Empty();
+	UClassSerializerMap.Empty();
+	FieldClassSerializerMap.Empty();
+	StructSerializerMap.Empty();
+
+	Frozen.Reset(Handlers);
+	ResetResolutionCache();
+	bFrozen = true;
+}
@@ -24,13 +24,15 @@ void DcSetupJsonSerializeHandlers(FDcSerializer& Serializer, EDcJsonSerializeTyp
 		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(PredicateIsScalarArrayProperty),
 			FDcSerializeDelegate::CreateStatic(HandlerArraySerialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcSerializePredicateFlag::Pure
 		);
 
 		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(PredicateIsEnumProperty),
 			FDcSerializeDelegate::CreateStatic(HandlerEnumToStringSerialize),
-			FName(TEXT("Enum"))
+			FName(TEXT("Enum")),
+			EDcSerializePredicateFlag::Pure
 		);
 
 		Serializer.AddPredicatedHandler(
@@ -100,7 +102,8 @@ void DcSetupPropertyPipeSerializeHandlers(FDcSerializer& Serializer)
 		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(DcCommonHandlers::PredicateIsScalarArrayProperty),
 			FDcSerializeDelegate::CreateStatic(DcCommonHandlers::HandlerArraySerialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcSerializePredicateFlag::Pure
 		);
 	}
 
@@ -138,7 +141,8 @@ void DcSetupMsgPackSerializeHandlers(FDcSerializer& Serializer, EDcMsgPackSerial
 		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(PredicateIsScalarArrayProperty),
 			FDcSerializeDelegate::CreateStatic(HandlerArraySerialize),
-			FName(TEXT("Array"))
+			FName(TEXT("Array")),
+			EDcSerializePredicateFlag::Pure
 		);
 	}
 
@@ -167,7 +171,8 @@ void DcSetupMsgPackSerializeHandlers(FDcSerializer& Serializer, EDcMsgPackSerial
 	Serializer.AddPredicatedHandler(
 		FDcSerializePredicate::CreateStatic(DcMsgPackHandlers::PredicateIsBlobProperty),
 		FDcSerializeDelegate::CreateStatic(DcMsgPackHandlers::HandlerBlobSerialize),
-		FName(TEXT("Blob"))
+		FName(TEXT("Blob")),
+		EDcSerializePredicateFlag::Pure
 	);
 
 	if (Type == EDcMsgPackSerializeType::Default
@@ -182,7 +187,8 @@ void DcSetupMsgPackSerializeHandlers(FDcSerializer& Serializer, EDcMsgPackSerial
 		Serializer.AddPredicatedHandler(
 			FDcSerializePredicate::CreateStatic(PredicateIsEnumProperty),
 			FDcSerializeDelegate::CreateStatic(HandlerEnumToStringSerialize),
-			FName(TEXT("Enum"))
+			FName(TEXT("Enum")),
+			EDcSerializePredicateFlag::Pure
 		);
 
 		Serializer.AddDirectHandler(FNameProperty::StaticClass(), FDcSerializeDelegate::CreateStatic(HandlerPipeNameSerialize));
@@ -333,3 +339,49 @@ void DcSetupCoreTypesSerializeHandlers(FDcSerializer& Serializer)
 #endif // ENGINE_MAJOR_VERSION == 5
 
 }
+
+namespace DcSerializerSetupDetails
+{
+
+template<typename TSetup>
+static TUniquePtr<FDcSerializer> MakeFrozen(TSetup&& Setup)
+{
+	TUniquePtr<FDcSerializer> Ret = MakeUnique<FDcSerializer>();
+	Setup(*Ret);
+	Ret->Freeze();
+	return Ret;
+}
+
+} // namespace DcSerializerSetupDetails
+
+FDcSerializer& DcGetDefaultJsonSerializer(EDcJsonSerializeType Type)
+{
+	using namespace DcSerializerSetupDetails;
+	static TUniquePtr<FDcSerializer> _DEFAULTS[] = {
+		MakeFrozen([](FDcSerializer& Serializer){ DcSetupJsonSerializeHandlers(Serializer, EDcJsonSerializeType::Default); }),
+		MakeFrozen([](FDcSerializer& Serializer){ DcSetupJsonSerializeHandlers(Serializer, EDcJsonSerializeType::StringSoftLazy); }),
+	};
+
+	return *_DEFAULTS[(int)Type];
+}
+
+FDcSerializer& DcGetDefaultPropertyPipeSerializer()
+{
+	using namespace DcSerializerSetupDetails;
+	static TUniquePtr<FDcSerializer> _DEFAULT = MakeFrozen([](FDcSerializer& Serializer){ DcSetupPropertyPipeSerializeHandlers(Serializer); });
+
+	return *_DEFAULT;
+}
+
+FDcSerializer& DcGetDefaultMsgPackSerializer(EDcMsgPackSerializeType Type)
+{
+	using namespace DcSerializerSetupDetails;
+	static TUniquePtr<FDcSerializer> _DEFAULTS[] = {
+		MakeFrozen([](FDcSerializer& Serializer){ DcSetupMsgPackSerializeHandlers(Serializer, EDcMsgPackSerializeType::Default); }),
+		MakeFrozen([](FDcSerializer& Serializer){ DcSetupMsgPackSerializeHandlers(Serializer, EDcMsgPackSerializeType::StringSoftLazy); }),
+		MakeFrozen([](FDcSerializer& Serializer){ DcSetupMsgPackSerializeHandlers(Serializer, EDcMsgPackSerializeType::InMemory); }),
+	};
+
+	return *_DEFAULTS[(int)Type];
+}
+
@@ -3,6 +3,7 @@
 #include "DataConfig/Property/DcPropertyReader.h"
 #include "DataConfig/SerDe/DcSerDeCommon.inl"
 #include "DataConfig/SerDe/DcSerDeUtils.inl"
+#include "DataConfig/SerDe/DcEnumTable.h"
 #include "DataConfig/Serialize/DcSerializer.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
 
@@ -88,46 +89,28 @@ FDcResult HandlerEnumToStringSerialize(FDcSerializeContext& Ctx)
 		return Ctx.Writer->WriteUInt64(Value.Unsigned64);
 	}
 
-	bool bIsBitFlags;
+	TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Table = FDcEnumTable::Get(Enum);
 
-#if WITH_EDITORONLY_DATA
-
-	#if WITH_METADATA
-	bIsBitFlags = Enum->HasMetaData(TEXT("Bitflags"));
-	#else
-	//	Program target is missing `UEnum::HasMetaData`
-	bIsBitFlags = ((UField*)Enum)->HasMetaData(TEXT("Bitflags"));
-	#endif
-
-#else // WITH_EDITORONLY_DATA
-	bIsBitFlags = false;
-#endif // WITH_EDITORONLY_DATA
-
-	if (!bIsBitFlags)
+	if (!Table->bIsBitFlags)
 	{
-		int ValueIndex = Enum->GetIndexByValue(Value.Signed64);
+		int ValueIndex = Table->FindIndexByValue(Value.Signed64);
 		if (ValueIndex == INDEX_NONE)
 			return DC_FAIL(DcDReadWrite, EnumValueInvalid)
 				<< Enum->GetName() << Value.Signed64;
 
-		DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByValue(Value.Signed64)));
+		DC_TRY(Ctx.Writer->WriteString(Table->Names[ValueIndex]));
 	}
 	else
 	{
 		DC_TRY(Ctx.Writer->WriteArrayRoot());
 
-		int Len = Enum->NumEnums();
 		uint64 Data = Value.Unsigned64;
-		for (int Ix = 0; Ix < Len; Ix++)
+		for (int32 Ix : Table->FlagIndices)
 		{
-			int64 Cur = Enum->GetValueByIndex(Ix);
-			int CurPopCount = FPlatformMath::CountBits(Cur);
-			if (CurPopCount == 0)
-				continue;
-
-			if (FPlatformMath::CountBits(Data & Cur) == CurPopCount)
+			uint64 Cur = (uint64)Table->Values[Ix];
+			if ((Data & Cur) == Cur)
 			{
-				DC_TRY(Ctx.Writer->WriteString(Enum->GetNameStringByIndex(Ix)));
+				DC_TRY(Ctx.Writer->WriteString(Table->Names[Ix]));
 				Data ^= Cur;
 			}
 		}
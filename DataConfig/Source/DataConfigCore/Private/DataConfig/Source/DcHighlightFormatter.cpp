@@ -195,5 +195,36 @@ TDcSourceRef<CharType> THightlightFormatter<CharType>::FindLine(const TDcSourceR
 	return SourceRef{ Buf, CurHead, CurTail - CurHead };
 }
 
+template<class CharType>
+TDcSourceRef<CharType> THightlightFormatter<CharType>::FindContextWindow(const TDcSourceRef<CharType>& SpanRef)
+{
+	check(SpanRef.IsValid());
+
+	SourceRef Head = FindLine(SpanRef);
+	SourceRef Tail = Head;
+	for (int Ix = 0; Ix < _LINE_CONTEXT; Ix++)
+	{
+		SourceRef LineBefore = Head;
+		LineBefore.Begin = LineBefore.Begin - 2;    // -1 is \n
+		LineBefore.Num = 1;
+		if (!LineBefore.IsValid())
+			break;
+		Head = FindLine(LineBefore);
+	}
+
+	for (int Ix = 0; Ix < _LINE_CONTEXT; Ix++)
+	{
+		SourceRef LineAfter = Tail;
+		LineAfter.Begin = LineAfter.Begin + LineAfter.Num;
+		LineAfter.Num = 1;
+		if (!LineAfter.IsValid())
+			break;
+		Tail = FindLine(LineAfter);
+	}
+
+	int32 End = FMath::Max(Tail.Begin + Tail.Num, SpanRef.Begin + SpanRef.Num);
+	return SourceRef{ SpanRef.Buffer, Head.Begin, End - Head.Begin };
+}
+
 template struct DATACONFIGCORE_API THightlightFormatter<ANSICHAR>;
 template struct DATACONFIGCORE_API THightlightFormatter<WIDECHAR>;
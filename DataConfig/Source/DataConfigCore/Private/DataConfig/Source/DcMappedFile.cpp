@@ -0,0 +1,46 @@
+#include "DataConfig/Source/DcMappedFile.h"
+#include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/DcEnv.h"
+#include "HAL/PlatformFileManager.h"
+
+FDcMappedFile::~FDcMappedFile()
+{
+	Close();
+}
+
+FDcResult FDcMappedFile::Open(const TCHAR* Path)
+{
+	Close();
+
+	Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(Path));
+	if (!Handle.IsValid())
+		return DC_FAIL(DcDCommon, FileMapFailed) << Path;
+
+	int64 Size = Handle->GetFileSize();
+	if (Size > MAX_int32)
+	{
+		Close();
+		return DC_FAIL(DcDCommon, FileTooLarge) << Path << Size;
+	}
+
+	//	empty files can't be mapped, leave it as an empty view
+	if (Size == 0)
+		return DcOk();
+
+	Region.Reset(Handle->MapRegion());
+	if (!Region.IsValid())
+	{
+		Close();
+		return DC_FAIL(DcDCommon, FileMapFailed) << Path;
+	}
+
+	return DcOk();
+}
+
+void FDcMappedFile::Close()
+{
+	//	region needs to go before the handle
+	Region.Reset();
+	Handle.Reset();
+}
+
@@ -0,0 +1,65 @@
+#include "DataConfig/Source/DcSinkStream.h"
+#include "HAL/FileManager.h"
+
+bool FDcArchiveSinkStream::Write(const uint8* Src, int64 Num)
+{
+	if (Ar == nullptr || Ar->IsError())
+		return false;
+
+	Ar->Serialize(const_cast<uint8*>(Src), Num);
+	return !Ar->IsError();
+}
+
+bool FDcArchiveSinkStream::Patch(int64 Distance, const uint8* Src, int64 Num)
+{
+	if (Ar == nullptr || !bCanPatch || Ar->IsError())
+		return false;
+
+	int64 EndPos = Ar->Tell();
+	if (EndPos < 0 || Num > Distance || Distance > EndPos)
+		return false;
+
+	Ar->Seek(EndPos - Distance);
+	if (Ar->Tell() != EndPos - Distance)
+		return false;
+
+	Ar->Serialize(const_cast<uint8*>(Src), Num);
+	Ar->Seek(EndPos);
+	return !Ar->IsError() && Ar->Tell() == EndPos;
+}
+
+FDcFileSinkStream::FDcFileSinkStream(const TCHAR* Path)
+	: FDcArchiveSinkStream(nullptr, true)
+{
+	FileAr.Reset(IFileManager::Get().CreateFileWriter(Path));
+	Ar = FileAr.Get();
+}
+
+bool FDcFileSinkStream::Close()
+{
+	if (!FileAr.IsValid())
+		return false;
+
+	bool bOk = FileAr->Close();
+	FileAr.Reset();
+	Ar = nullptr;
+	return bOk;
+}
+
+bool FDcArraySinkStream::Write(const uint8* Src, int64 Num)
+{
+	if (Bytes.Num() + Num > MAX_int32)
+		return false;
+
+	Bytes.Append(Src, (int32)Num);
+	return true;
+}
+
+bool FDcArraySinkStream::Patch(int64 Distance, const uint8* Src, int64 Num)
+{
+	if (Num > Distance || Distance > Bytes.Num())
+		return false;
+
+	FMemory::Memcpy(Bytes.GetData() + Bytes.Num() - Distance, Src, Num);
+	return true;
+}
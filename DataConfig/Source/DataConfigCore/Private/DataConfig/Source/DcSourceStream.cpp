@@ -0,0 +1,23 @@
+#include "DataConfig/Source/DcSourceStream.h"
+#include "HAL/FileManager.h"
+
+int64 FDcArchiveSourceStream::Read(uint8* Dst, int64 Num)
+{
+	if (Ar == nullptr || Ar->IsError())
+		return 0;
+
+	int64 ReadNum = FMath::Min(Num, Ar->TotalSize() - Ar->Tell());
+	if (ReadNum <= 0)
+		return 0;
+
+	Ar->Serialize(Dst, ReadNum);
+	return Ar->IsError() ? 0 : ReadNum;
+}
+
+FDcFileSourceStream::FDcFileSourceStream(const TCHAR* Path)
+	: FDcArchiveSourceStream(nullptr)
+{
+	FileAr.Reset(IFileManager::Get().CreateFileReader(Path));
+	Ar = FileAr.Get();
+}
+
@@ -243,6 +243,11 @@ FDcResult FDcPutbackWriter::WriteBlob(const FDcBlobViewData& Value)
 	return DcPutbackWriterDetails::CachedWrite<EDcDataEntry::Blob>(this, &FDcWriter::WriteBlob, Value);
 }
 
+void FDcPutbackWriter::SetContainerSizeHint(int32 Num)
+{
+	Writer->SetContainerSizeHint(Num);
+}
+
 void FDcPutbackWriter::FormatDiagnostic(FDcDiagnostic& Diag)
 {
 	Writer->FormatDiagnostic(Diag);
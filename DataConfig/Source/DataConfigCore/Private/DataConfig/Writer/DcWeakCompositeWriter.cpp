@@ -217,6 +217,12 @@ FDcResult FDcWeakCompositeWriter::WriteBlob(const FDcBlobViewData& Value)
 	return CompositeDispatch(this, &FDcWriter::WriteBlob, Value);
 }
 
+void FDcWeakCompositeWriter::SetContainerSizeHint(int32 Num)
+{
+	for (FDcWriter* Writer : Writers)
+		Writer->SetContainerSizeHint(Num);
+}
+
 void FDcWeakCompositeWriter::FormatDiagnostic(FDcDiagnostic& Diag)
 {
 	for (FDcWriter* Writer : Writers)
@@ -47,6 +47,8 @@ FDcResult FDcWriter::WriteFloat(const float&) { return DC_FAIL(DcDCommon, NotImp
 FDcResult FDcWriter::WriteDouble(const double&) { return DC_FAIL(DcDCommon, NotImplemented); }
 FDcResult FDcWriter::WriteBlob(const FDcBlobViewData&) { return DC_FAIL(DcDCommon, NotImplemented); }
 
+void FDcWriter::SetContainerSizeHint(int32) { /*pass*/ }
+
 void FDcWriter::FormatDiagnostic(FDcDiagnostic& Diag) { /*pass*/ }
 
 FName FDcWriter::ClassId() { return FName(TEXT("BaseDcWriter")); }
@@ -6,9 +6,21 @@
 struct FDcReader;
 struct FDcWriter;
 
+///	How failures are recorded in an env
+enum class EDcDiagMode : uint8
+{
+	///	format highlights as failures happen
+	Full,
+	///	keep error code, args and source location, format highlights from snapshots on flush
+	Deferred,
+	///	record nothing, only code of the last failure is kept for `GetLastDiag()`
+	Silent,
+};
+
 struct DATACONFIGCORE_API FDcEnv
 {
 	TArray<FDcDiagnostic> Diagnostics;
+	FDcDiagnostic SilentDiag{FDcErrorCode{0, 0}, true};
 
 	TSharedPtr<IDcDiagnosticConsumer> DiagConsumer;
 
@@ -16,6 +28,8 @@ struct DATACONFIGCORE_API FDcEnv
 	TArray<FDcWriter*> WriterStack;
 
 	bool bExpectFail = false;	// mute debug break
+	bool bForwardToSharedConsumer = false;	// flush into the shared consumer when there's no `DiagConsumer`
+	EDcDiagMode DiagMode = EDcDiagMode::Full;
 
 	FDcDiagnostic& Diag(FDcErrorCode InErr);
 
@@ -23,6 +37,9 @@ struct DATACONFIGCORE_API FDcEnv
 
 	FORCEINLINE FDcDiagnostic& GetLastDiag()
 	{
+		if (DiagMode == EDcDiagMode::Silent)
+			return SilentDiag;
+
 		checkf(Diagnostics.Num(), TEXT("<empty diagnostics>"));
 		return Diagnostics.Last();
 	}
@@ -30,12 +47,23 @@ struct DATACONFIGCORE_API FDcEnv
 	~FDcEnv();
 };
 
+///	Env stack is thread local. Threads other than the one calling `DcStartUp` get a root env on first use,
+///	which should be done before `DcShutDown`. These root envs forward to the shared diag consumer.
 DATACONFIGCORE_API FDcEnv& DcEnv();
 DATACONFIGCORE_API FDcEnv& DcParentEnv();
 DATACONFIGCORE_API FDcEnv& DcPushEnv();
 DATACONFIGCORE_API void DcPopEnv();
 
-extern TArray<FDcEnv> gDcEnvs;
+///	Flush and release the calling thread's env stack. `DcShutDown` only releases envs on its own thread,
+///	worker threads should call this when they're done, otherwise their envs flush on thread exit which can
+///	be after `DcShutDown`. A later `DcEnv()` call on the same thread gets a new root env.
+DATACONFIGCORE_API void DcFlushThreadEnv();
+
+///	Envs without a `DiagConsumer` and with `bForwardToSharedConsumer` flush into this consumer, calls into it
+///	are serialized by a lock. Use this to collect diagnostics from worker threads. Set and reset it on the
+///	game thread only.
+DATACONFIGCORE_API void DcSetSharedDiagConsumer(TSharedPtr<IDcDiagnosticConsumer> InConsumer);
+DATACONFIGCORE_API TSharedPtr<IDcDiagnosticConsumer> DcGetSharedDiagConsumer();
 
 template<typename T, TArray<T*> FDcEnv::*MemberPtr>
 struct TScopedEnvMemberPtr
@@ -63,10 +91,54 @@ struct DATACONFIGCORE_API FDcScopedEnv
 	FORCEINLINE FDcScopedEnv() { DcPushEnv(); }
 	FORCEINLINE ~FDcScopedEnv() { DcPopEnv(); }
 	FORCEINLINE FDcEnv& Get() { return DcEnv(); }
-	FORCEINLINE FDcEnv& Parent() { return gDcEnvs[gDcEnvs.Num() - 2]; }
+	FORCEINLINE FDcEnv& Parent() { return DcParentEnv(); }
+};
+
+///	Set `DiagMode` of current env for a scope. `Silent` also mutes debug break as failures are expected.
+struct FDcScopedDiagMode
+{
+	FORCEINLINE FDcScopedDiagMode(EDcDiagMode InMode)
+	{
+		FDcEnv& Env = DcEnv();
+		PrevMode = Env.DiagMode;
+		bPrevExpectFail = Env.bExpectFail;
+		Env.DiagMode = InMode;
+		Env.bExpectFail |= InMode == EDcDiagMode::Silent;
+	}
+
+	FORCEINLINE ~FDcScopedDiagMode()
+	{
+		FDcEnv& Env = DcEnv();
+		Env.DiagMode = PrevMode;
+		Env.bExpectFail = bPrevExpectFail;
+	}
+
+	EDcDiagMode PrevMode;
+	bool bPrevExpectFail;
+};
+
+///	For "try A, else B" probes where failing is cheap and nothing is recorded
+struct FDcScopedSilentProbe : public FDcScopedDiagMode
+{
+	FORCEINLINE FDcScopedSilentProbe() : FDcScopedDiagMode(EDcDiagMode::Silent) {}
 };
 
-#define DC_FAIL(DiagNamespace, DiagID) (DcFail(FDcErrorCode{DiagNamespace::Category, DiagNamespace::DiagID}))
+///	Not parenthesized on purpose: `<<` binds tighter than `?:` so in `Silent` mode the whole
+///	`DC_FAIL(...) << Args` chain is skipped and arg expressions aren't evaluated.
+#define DC_FAIL(DiagNamespace, DiagID) \
+	DcIsSilentDiag() \
+		? DcFailSilent(FDcErrorCode{DiagNamespace::Category, DiagNamespace::DiagID}) \
+		: DcFail(FDcErrorCode{DiagNamespace::Category, DiagNamespace::DiagID})
+
+FORCEINLINE bool DcIsSilentDiag()
+{
+	return DcEnv().DiagMode == EDcDiagMode::Silent;
+}
+
+FORCEINLINE FDcDiagnostic& DcFailSilent(FDcErrorCode InErr)
+{
+	return DcEnv().Diag(InErr);
+}
 
 FORCEINLINE FDcDiagnostic& DcFail(FDcErrorCode InErr)
 {
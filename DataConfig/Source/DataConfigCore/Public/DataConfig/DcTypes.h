@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StringView.h"
 #include "DataConfig/DcMacros.h"
 #include "DcTypes.generated.h"
 
@@ -219,6 +220,104 @@ struct DATACONFIGCORE_API FDcBlobViewData
 	}
 };
 
+///	String read by `FDcReader::ReadStringView`.
+///	Borrows reader source buffer when no unescaping is needed, including validated
+///	UTF8 bytes which are only decoded to `TCHAR` on `ToString` and friends,
+///	otherwise holds the converted string in `Owned`.
+///	Borrowed views are valid until the reader source buffer is released.
+struct DATACONFIGCORE_API FDcStringViewData
+{
+	enum class EType : uint8
+	{
+		Owned,		//	string is in `Owned`
+		Tchar,		//	borrowed `TCHAR` chars
+		Ascii,		//	borrowed `ANSICHAR` chars, ascii only
+		Utf8,		//	borrowed validated UTF8 bytes, `Num` is byte count
+	};
+
+	EType Type = EType::Owned;
+	const void* DataPtr = nullptr;
+	int32 Num = 0;
+	int32 CharNum = 0;	//	decoded `TCHAR` count, only used by `Utf8`
+	FString Owned;
+
+	static FORCEINLINE FDcStringViewData FromTchar(const TCHAR* Ptr, int32 InNum)
+	{
+		FDcStringViewData Ret;
+		Ret.Type = EType::Tchar;
+		Ret.DataPtr = Ptr;
+		Ret.Num = InNum;
+		return Ret;
+	}
+
+	static FORCEINLINE FDcStringViewData FromAscii(const ANSICHAR* Ptr, int32 InNum)
+	{
+		FDcStringViewData Ret;
+		Ret.Type = EType::Ascii;
+		Ret.DataPtr = Ptr;
+		Ret.Num = InNum;
+		return Ret;
+	}
+
+	static FORCEINLINE FDcStringViewData FromUtf8(const ANSICHAR* Ptr, int32 InNum, int32 InCharNum)
+	{
+		FDcStringViewData Ret;
+		Ret.Type = EType::Utf8;
+		Ret.DataPtr = Ptr;
+		Ret.Num = InNum;
+		Ret.CharNum = InCharNum;
+		return Ret;
+	}
+
+	static FORCEINLINE FDcStringViewData FromOwned(FString&& InStr)
+	{
+		FDcStringViewData Ret;
+		Ret.Owned = MoveTemp(InStr);
+		return Ret;
+	}
+
+	FORCEINLINE bool IsBorrowed() const { return Type != EType::Owned; }
+	FORCEINLINE int32 Len() const
+	{
+		switch (Type)
+		{
+			case EType::Owned: return Owned.Len();
+			case EType::Utf8: return CharNum;
+			default: return Num;
+		}
+	}
+	FORCEINLINE bool IsEmpty() const { return Len() == 0; }
+
+	FORCEINLINE const TCHAR* GetTcharPtr() const { check(Type == EType::Tchar); return (const TCHAR*)DataPtr; }
+	FORCEINLINE const ANSICHAR* GetAsciiPtr() const { check(Type == EType::Ascii); return (const ANSICHAR*)DataPtr; }
+	FORCEINLINE const ANSICHAR* GetUtf8Ptr() const { check(Type == EType::Utf8); return (const ANSICHAR*)DataPtr; }
+	FORCEINLINE bool IsUtf8Bytes() const { return Type == EType::Ascii || Type == EType::Utf8; }
+
+	FORCEINLINE TCHAR GetChar(int32 Ix) const
+	{
+		check(Ix >= 0 && Ix < Len());
+		switch (Type)
+		{
+			case EType::Tchar: return GetTcharPtr()[Ix];
+			case EType::Ascii: return (TCHAR)GetAsciiPtr()[Ix];
+			case EType::Utf8: return GetUtf8Char(Ix);
+			default: return Owned[Ix];
+		}
+	}
+
+	///	`Utf8` needs to decode from the start, prefer `AppendTo` or `ToString` over indexing
+	TCHAR GetUtf8Char(int32 Ix) const;
+
+	FString ToString() const &;
+	FString ToString() &&;
+	FName ToName() const;
+	void AppendTo(FStringBuilderBase& Sb) const;
+
+	///	case sensitive compare
+	bool Equals(FStringView Other) const;
+	bool Equals(const FDcStringViewData& Other) const;
+};
+
 template<int32 N>
 struct FDcFixedBytes
 {
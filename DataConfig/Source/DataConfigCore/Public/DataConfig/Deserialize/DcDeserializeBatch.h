@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/Property/DcPropertyDatum.h"
+#include "DataConfig/Diagnostic/DcDiagnostic.h"
+#include "DataConfig/DcEnv.h"
+
+struct FDcDeserializer;
+struct FDcDeserializeProjection;
+
+enum class EDcBatchLoadFormat : uint8
+{
+	Json,		//	UTF-8 encoded, BOM is skipped
+	MsgPack,
+};
+
+///	A single document to load. When `FilePath` is set the file is mapped on the worker,
+///	otherwise `Buffer` is borrowed and must outlive the batch.
+struct DATACONFIGCORE_API FDcBatchLoadJob
+{
+	EDcBatchLoadFormat Format = EDcBatchLoadFormat::Json;
+
+	FString FilePath;
+	TArrayView<const uint8> Buffer;
+
+	FDcPropertyDatum Target;
+};
+
+struct DATACONFIGCORE_API FDcBatchLoadResult
+{
+	bool bOk = false;
+	TArray<FDcDiagnostic> Diagnostics;
+};
+
+struct DATACONFIGCORE_API FDcBatchLoadResults
+{
+	TArray<FDcBatchLoadResult> Results;
+	int32 NumFailed = 0;
+
+	FORCEINLINE bool AllOk() const { return NumFailed == 0; }
+};
+
+struct DATACONFIGCORE_API FDcBatchLoadConfig
+{
+	///	Must be frozen as they're shared by all workers. Default to `DcGetDefaultJsonDeserializer()`
+	///	and `DcGetDefaultMsgPackDeserializer()`.
+	FDcDeserializer* JsonDeserializer = nullptr;
+	FDcDeserializer* MsgPackDeserializer = nullptr;
+
+	///	optional field mask applied to every job, see `FDcDeserializeContext::Projection`
+	const FDcDeserializeProjection* Projection = nullptr;
+
+	///	how failures are recorded per job, `Deferred` formats highlights only when results are flushed
+	///	and `Silent` only reports `bOk`
+	EDcDiagMode DiagMode = EDcDiagMode::Full;
+
+	///	0 to use all task graph workers and the calling thread
+	int32 NumWorkers = 0;
+};
+
+///	Deserialize many documents in parallel. Each worker uses its own reader, writer and context and each
+///	job runs in its own env, so diagnostics are collected per job instead of being flushed.
+///	Targets must not overlap and handlers must be thread safe, thus UObject targets and
+///	instanced sub objects should stay on the game thread.
+DATACONFIGCORE_API FDcBatchLoadResults DcBatchLoad(TArrayView<const FDcBatchLoadJob> Jobs, const FDcBatchLoadConfig& Config = {});
+
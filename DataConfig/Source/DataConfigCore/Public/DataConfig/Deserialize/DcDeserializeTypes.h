@@ -3,11 +3,111 @@
 #include "CoreMinimal.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Property/DcPropertyDatum.h"
+#include "UObject/SoftObjectPath.h"
 
 struct FDcReader;
 struct FDcPropertyWriter;
 struct FDcDeserializer;
 
+///	Field mask compiled from property paths like `Entries.Id`. Segments are field names of
+///	nested structs and classes while containers are transparent, thus `Entries.Id` selects `Id`
+///	of every item in `Entries`. A path ending at a field selects its whole subtree.
+struct DATACONFIGCORE_API FDcDeserializeProjection
+{
+	struct FNode
+	{
+		TMap<FName, int32> Children;
+		bool bSelectAll = false;
+	};
+
+	///	`Nodes[0]` is the root
+	TArray<FNode> Nodes;
+
+	FDcDeserializeProjection();
+
+	void AddPath(FStringView Path);
+};
+
+///	Resolved object references keyed by property class and reference string. Set one on the context
+///	to resolve repeated references once, or keep it around to share across loads. Lookups hash the
+///	string view as read so hits don't build a `FString`. Objects are held weakly and get resolved
+///	again once collected. Not thread safe.
+struct DATACONFIGCORE_API FDcObjectReferenceCache
+{
+	struct FEntry
+	{
+		FString Str;
+		UClass* Class;
+		TWeakObjectPtr<UObject> Object;
+	};
+
+	TMultiMap<uint32, FEntry> Entries;
+
+	UObject* Find(UClass* Class, const FDcStringViewData& Str) const;
+	void Add(UClass* Class, const FDcStringViewData& Str, UObject* Object);
+	FORCEINLINE void Reset() { Entries.Reset(); }
+
+	FORCEINLINE UObject* Find(UClass* Class, const FString& Str) const { return Find(Class, FDcStringViewData::FromTchar(*Str, Str.Len())); }
+	FORCEINLINE void Add(UClass* Class, const FString& Str, UObject* Object) { Add(Class, FDcStringViewData::FromTchar(*Str, Str.Len()), Object); }
+};
+
+///	`$type` strings resolved to struct or class types, shared by handlers reading polymorphic
+///	payloads. Lookups hash the string view as read so hits don't build a `FString`. Types are held
+///	weakly and ones replaced by reinstancing are treated as misses. Locators sharing a cache are
+///	expected to resolve the same string to the same type. Not thread safe.
+struct DATACONFIGCORE_API FDcTypeResolveCache
+{
+	struct FEntry
+	{
+		FString Str;
+		UClass* Kind;	//	`UScriptStruct` or `UClass`
+		TWeakObjectPtr<UStruct> Type;
+	};
+
+	TMultiMap<uint32, FEntry> Entries;
+
+	UStruct* Find(const FDcStringViewData& Str, UClass* Kind) const;
+	void Add(const FDcStringViewData& Str, UClass* Kind, UStruct* Type);
+	FORCEINLINE void Reset() { Entries.Reset(); }
+
+	template<typename TType>
+	FORCEINLINE TType* Find(const FDcStringViewData& Str) const { return (TType*)Find(Str, TType::StaticClass()); }
+	template<typename TType>
+	FORCEINLINE void Add(const FDcStringViewData& Str, TType* Type) { Add(Str, TType::StaticClass(), Type); }
+
+	///	hash on decoded chars, same across string view types
+	static uint32 HashStr(const FDcStringViewData& Str);
+};
+
+///	Soft references collected as paths during deserialization instead of being loaded in place,
+///	resolve them in one go afterwards with `DcDeserializeUtils::ResolveDeferredReferences`
+///	or `LoadDeferredReferencesAsync`.
+struct DATACONFIGCORE_API FDcDeferredReferences
+{
+	struct FEntry
+	{
+		FSoftObjectPath Path;
+		UClass* ExpectClass;	//	object class, or meta class when `bIsClass`
+		bool bIsClass;
+
+		FORCEINLINE bool operator==(const FEntry& Rhs) const
+		{
+			return Path == Rhs.Path && ExpectClass == Rhs.ExpectClass && bIsClass == Rhs.bIsClass;
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash(const FEntry& Entry)
+		{
+			return HashCombine(GetTypeHash(Entry.Path), GetTypeHash(Entry.ExpectClass));
+		}
+	};
+
+	///	deduplicated
+	TSet<FEntry> Entries;
+
+	FORCEINLINE void Add(const FSoftObjectPath& Path, UClass* ExpectClass, bool bIsClass) { Entries.Add({Path, ExpectClass, bIsClass}); }
+	FORCEINLINE void Reset() { Entries.Reset(); }
+};
+
 struct DATACONFIGCORE_API FDcDeserializeContext
 {
 	enum class EState : uint8
@@ -28,6 +128,19 @@ struct DATACONFIGCORE_API FDcDeserializeContext
 	FDcReader* Reader = nullptr;
 	FDcPropertyWriter* Writer = nullptr;
 
+	///	optional, fields not selected are skipped on the reader side and left untouched
+	const FDcDeserializeProjection* Projection = nullptr;
+	///	current node in `Projection`, `INDEX_NONE` when everything is selected
+	int32 ProjectionNode = INDEX_NONE;
+
+	///	optional, reference strings resolve through it and successful results are added
+	FDcObjectReferenceCache* ObjectReferenceCache = nullptr;
+	///	optional, soft object and class references given as paths are written without loading
+	///	and collected here to be resolved later
+	FDcDeferredReferences* DeferredReferences = nullptr;
+	///	optional, `$type` strings resolve through it
+	FDcTypeResolveCache* TypeResolveCache = nullptr;
+
 	void* UserData = nullptr;
 
 	FORCEINLINE FFieldVariant& TopProperty()
@@ -54,6 +167,14 @@ enum class EDcDeserializePredicateResult
 	Process,
 };
 
+///	`Pure` predicates only depend on the top property and whether it's a scalar array item,
+///	which allows `FDcDeserializer` to memoize their results when resolution cache is enabled.
+enum class EDcDeserializePredicateFlag : uint8
+{
+	None,
+	Pure,
+};
+
 using FDcDeserializePredicateSignature = EDcDeserializePredicateResult(*)(FDcDeserializeContext& Ctx);
 DECLARE_DELEGATE_RetVal_OneParam(EDcDeserializePredicateResult, FDcDeserializePredicate, FDcDeserializeContext&);
 
@@ -9,8 +9,48 @@ namespace DcDeserializeUtils
 
 DATACONFIGCORE_API FDcResult RecursiveDeserialize(FDcDeserializeContext& Ctx);
 
+///	Write `FieldName` then deserialize its value, or skip the value on the reader
+///	when the field isn't selected by `Ctx.Projection`.
+DATACONFIGCORE_API FDcResult RecursiveDeserializeField(FDcDeserializeContext& Ctx, FName FieldName);
+
 DATACONFIGCORE_API EDcDeserializePredicateResult PredicateIsRootProperty(FDcDeserializeContext& Ctx);
 
+///	Read `$type` value right after `ReadMapRoot`, which is expected to be the first key.
+///	`FDcTapeReader` looks it up anywhere in the map and hides it from following reads.
+DATACONFIGCORE_API FDcResult ReadMetaType(FDcReader* Reader, FString* OutPtr);
+DATACONFIGCORE_API FDcResult ReadMetaType(FDcReader* Reader, FDcStringViewData* OutPtr);
+
+///	Resolve `$type` string through `Ctx.TypeResolveCache` when it's set. On misses it goes through
+///	`FuncLocate` and remembers the result.
+template<typename TType, typename TFuncLocate>
+FDcResult TryLocateTypeCached(FDcDeserializeContext& Ctx, const FDcStringViewData& TypeStr, TType*& OutType, TFuncLocate&& FuncLocate)
+{
+	if (Ctx.TypeResolveCache)
+	{
+		if (TType* Cached = Ctx.TypeResolveCache->Find<TType>(TypeStr))
+		{
+			OutType = Cached;
+			return DcOk();
+		}
+	}
+
+	FString Str = TypeStr.ToString();
+	DC_TRY(FuncLocate(Ctx, Str, OutType));
+
+	if (Ctx.TypeResolveCache && OutType)
+		Ctx.TypeResolveCache->Add<TType>(TypeStr, OutType);
+	return DcOk();
+}
+
+///	Load everything collected in `Deferred` synchronously and check them against expected classes.
+///	Loaded objects are added to `Cache` when given.
+DATACONFIGCORE_API FDcResult ResolveDeferredReferences(const FDcDeferredReferences& Deferred, FDcObjectReferenceCache* Cache = nullptr);
+
+///	Async load packages of everything collected in `Deferred`, `OnLoaded` fires on game thread
+///	after all requests complete. Failed packages are reported to `DcEnv()`, otherwise references
+///	are resolved like `ResolveDeferredReferences` and the result is passed to `OnLoaded`.
+DATACONFIGCORE_API void LoadDeferredReferencesAsync(const FDcDeferredReferences& Deferred, TFunction<void(FDcResult)> OnLoaded);
+
 } // namespace DcDeserializeUtils
 
 
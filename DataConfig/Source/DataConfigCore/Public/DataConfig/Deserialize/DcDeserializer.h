@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Templates/Tuple.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Deserialize/DcDeserializeTypes.h"
@@ -11,19 +12,90 @@ struct DATACONFIGCORE_API FDcDeserializer : public FNoncopyable
 
 	void AddDirectHandler(FFieldClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
 	void AddDirectHandler(UClass* PropertyClass, FDcDeserializeDelegate&& Delegate);
-	void AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name = NAME_None);
+	void AddPredicatedHandler(FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name = NAME_None,
+		EDcDeserializePredicateFlag Flag = EDcDeserializePredicateFlag::None);
 	void AddStructHandler(UStruct* Struct, FDcDeserializeDelegate&& Delegate);
+	///	Predicated handlers are tried in order, use this to take precedence over ones already added.
+	void InsertPredicatedHandler(int32 Index, FDcDeserializePredicate&& Predicate, FDcDeserializeDelegate&& Delegate, const FName Name = NAME_None,
+		EDcDeserializePredicateFlag Flag = EDcDeserializePredicateFlag::None);
 
 	struct FPredicatedHandlerEntry
 	{
 		FDcDeserializePredicate Predicate;
 		FDcDeserializeDelegate Handler;
 		FName Name;
+		EDcDeserializePredicateFlag Flag = EDcDeserializePredicateFlag::None;
 	};
 	TArray<FPredicatedHandlerEntry> PredicatedDeserializers;
 
 	TMap<UClass*, FDcDeserializeDelegate> UClassDeserializerMap;
 	TMap<FFieldClass*, FDcDeserializeDelegate> FieldClassDeserializerMap;
 	TMap<UStruct*, FDcDeserializeDelegate> StructDeserializeMap;
+
+	///	Memoize handler resolution per property. Only `Pure` predicates and direct handlers are cached,
+	///	other predicates are still evaluated for every value.
+	bool bUseResolutionCache = false;
+
+	struct FResolutionKey
+	{
+		void* Property;
+		bool bSkipStructHandlers;
+		bool bScalarArrayItem;
+
+		FORCEINLINE friend bool operator==(const FResolutionKey& Lhs, const FResolutionKey& Rhs)
+		{
+			return Lhs.Property == Rhs.Property
+				&& Lhs.bSkipStructHandlers == Rhs.bSkipStructHandlers
+				&& Lhs.bScalarArrayItem == Rhs.bScalarArrayItem;
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash(const FResolutionKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Property), (uint32)Key.bSkipStructHandlers | ((uint32)Key.bScalarArrayItem << 1));
+		}
+	};
+
+	struct FResolutionEntry
+	{
+		int32 PredicateIx;						//	INDEX_NONE for direct handlers
+		const FDcDeserializeDelegate* DirectHandler;
+	};
+
+	struct FResolutionStats
+	{
+		int32 Hits = 0;
+		int32 Misses = 0;
+	};
+
+	TMap<FResolutionKey, FResolutionEntry> ResolutionCache;
+	FResolutionStats ResolutionStats;
+	//	handler counts when cache is built, cache is dropped when these change
+	int32 ResolutionHandlerNums[4] = {};
+
+	///	Called on adding handlers. Call this manually after reinstancing or replacing direct handlers.
+	void ResetResolutionCache();
+
+	///	Move handlers into an immutable snapshot, after which the instance can be shared by concurrent
+	///	`Deserialize` calls without locking. Handler containers above are left empty and must stay so,
+	///	along with `bUseResolutionCache`, which is checked on every `Deserialize`. Frozen instances memoize
+	///	resolution per thread and don't update `ResolutionStats`.
+	void Freeze();
+	FORCEINLINE bool IsFrozen() const { return bFrozen; }
+
+	struct FFrozenHandlers
+	{
+		TArray<FPredicatedHandlerEntry> PredicatedDeserializers;
+
+		TMap<UClass*, FDcDeserializeDelegate> UClassDeserializerMap;
+		TMap<FFieldClass*, FDcDeserializeDelegate> FieldClassDeserializerMap;
+		TMap<UStruct*, FDcDeserializeDelegate> StructDeserializeMap;
+
+		bool bUseResolutionCache;
+	};
+	TUniquePtr<const FFrozenHandlers> Frozen;
+
+	bool bFrozen = false;
+	//	tags per thread resolution caches of frozen instances, unique across instances and resets
+	FThreadSafeCounter ResolutionGeneration;
 };
 
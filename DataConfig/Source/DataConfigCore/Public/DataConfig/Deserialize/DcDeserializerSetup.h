@@ -24,3 +24,10 @@ DATACONFIGCORE_API void DcSetupMsgPackDeserializeHandlers(FDcDeserializer& Deser
 
 DATACONFIGCORE_API void DcSetupCoreTypesDeserializeHandlers(FDcDeserializer& Deserializer);
 
+///	Process wide frozen instances built by setups above on first use, which can be shared between threads.
+DATACONFIGCORE_API FDcDeserializer& DcGetDefaultJsonDeserializer(EDcJsonDeserializeType Type = EDcJsonDeserializeType::Default);
+
+DATACONFIGCORE_API FDcDeserializer& DcGetDefaultPropertyPipeDeserializer();
+
+DATACONFIGCORE_API FDcDeserializer& DcGetDefaultMsgPackDeserializer(EDcMsgPackDeserializeType Type = EDcMsgPackDeserializeType::Default);
+
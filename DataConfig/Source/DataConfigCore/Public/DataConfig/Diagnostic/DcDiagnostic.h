@@ -20,12 +20,35 @@ struct DATACONFIGCORE_API FDcDiagnosticHighlight
 	FString Formatted;
 	TOptional<FDcDiagnosticFileContext> FileContext;
 
+	///	set instead of `Formatted` when diagnostics are deferred, fills it from a snapshot on flush
+	TFunction<void(FDcDiagnosticHighlight&)> DeferredFormat;
+
 	FDcDiagnosticHighlight(void* InOwner, FString InOwnerName)
 		: Owner(InOwner)
 		, OwnerName(InOwnerName)
 	{}
 };
 
+///	Arg kept raw by a deferred diagnostic, converted into `Args[Index]` on flush
+struct DATACONFIGCORE_API FDcDiagnosticDeferredArg
+{
+	enum class EKind : uint8
+	{
+		EscapeString,
+		DataEntryName,
+		FieldFullName,
+	};
+
+	int32 Index;
+	EKind Kind;
+
+	FString Str;
+	EDcDataEntry Entry;
+	FName FieldName;	//	used when the field is gone by flush
+	FFieldVariant Field;
+	TWeakObjectPtr<UObject> FieldOwner;
+};
+
 struct DATACONFIGCORE_API FDcDiagnostic
 {
 	FDcErrorCode Code;
@@ -33,9 +56,29 @@ struct DATACONFIGCORE_API FDcDiagnostic
 
 	TArray<FDcDiagnosticHighlight> Highlights;
 
-	FDcDiagnostic(FDcErrorCode InID) : Code(InID)
+	///	muted diagnostic drops args and highlights, used by silent probes
+	bool bMuted = false;
+	///	set by env in `Deferred` mode, args are converted in `FormatDeferred`
+	bool bDeferred = false;
+
+	TArray<FDcDiagnosticDeferredArg> DeferredArgs;
+
+	FDcDiagnostic(FDcErrorCode InID, bool bInMuted = false)
+		: Code(InID)
+		, bMuted(bInMuted)
 	{}
 
+	FORCEINLINE FDcDiagnosticDeferredArg& AddDeferredArg(FDcDiagnosticDeferredArg::EKind Kind)
+	{
+		FDcDiagnosticDeferredArg& Deferred = DeferredArgs.AddDefaulted_GetRef();
+		Deferred.Index = Args.AddDefaulted();
+		Deferred.Kind = Kind;
+		return Deferred;
+	}
+
+	///	convert deferred args and run pending `DeferredFormat` on highlights
+	void FormatDeferred();
+
 	operator FDcResult() const {
 		return FDcResult{ FDcResult::EStatus::Error };
 	}
@@ -45,6 +88,8 @@ template<typename T>
 typename TEnableIf<!TIsEnumClass< typename TRemoveReference<T>::Type >::Value, FDcDiagnostic&>::Type
 operator<<(FDcDiagnostic& Diag, T&& InValue)
 {
+	if (Diag.bMuted)
+		return Diag;
 	Diag.Args.Emplace(Forward<T>(InValue));
 	return Diag;
 }
@@ -53,12 +98,16 @@ template<typename T>
 typename TEnableIf<TIsEnumClass< typename TRemoveReference<T>::Type >::Value, FDcDiagnostic&>::Type
 operator<<(FDcDiagnostic& Diag, T&& InValue)
 {
+	if (Diag.bMuted)
+		return Diag;
 	Diag.Args.Emplace((int)(InValue));
 	return Diag;
 }
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, ANSICHAR Char)
 {
+	if (Diag.bMuted)
+		return Diag;
 	if (FCharAnsi::IsPrint(Char))
 	{
 		Diag.Args.Emplace(FString::Chr((TCHAR)Char));
@@ -75,6 +124,8 @@ FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, ANSICHAR Char)
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, WIDECHAR Char)
 {
+	if (Diag.bMuted)
+		return Diag;
 	if (FCharWide::IsPrint(Char))
 	{
 		Diag.Args.Emplace(FString::Chr(Char));
@@ -95,6 +146,13 @@ FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, WIDECHAR Char)
 
 FORCEINLINE_DEBUGGABLE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, EDcDataEntry Entry)
 {
+	if (Diag.bMuted)
+		return Diag;
+	if (Diag.bDeferred)
+	{
+		Diag.AddDeferredArg(FDcDiagnosticDeferredArg::EKind::DataEntryName).Entry = Entry;
+		return Diag;
+	}
 	UEnum* DataEntryEnum = StaticEnum<EDcDataEntry>();
 	check(DataEntryEnum);
 	Diag.Args.Emplace(DataEntryEnum->GetNameByIndex((int32)Entry));
@@ -103,6 +161,8 @@ FORCEINLINE_DEBUGGABLE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, EDcDataEnt
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcDiagnosticHighlight&& DiagSpan)
 {
+	if (Diag.bMuted)
+		return Diag;
 	Diag.Highlights.Emplace(MoveTemp(DiagSpan));
 	return Diag;
 }
@@ -118,24 +178,51 @@ struct FDcDiagnosticStringNoEscape
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcDiagnosticStringNoEscape&& NoEscapeStr)
 {
+	if (Diag.bMuted)
+		return Diag;
 	Diag.Args.Emplace(MoveTemp(NoEscapeStr.Str));
 	return Diag;
 };
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FString&& Str)
 {
+	if (Diag.bMuted)
+		return Diag;
+	if (Diag.bDeferred)
+	{
+		Diag.AddDeferredArg(FDcDiagnosticDeferredArg::EKind::EscapeString).Str = MoveTemp(Str);
+		return Diag;
+	}
 	Diag.Args.Emplace(Str.ReplaceCharWithEscapedChar());
 	return Diag;
 };
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FStringView Sv)
 {
+	if (Diag.bMuted)
+		return Diag;
+	if (Diag.bDeferred)
+	{
+		Diag.AddDeferredArg(FDcDiagnosticDeferredArg::EKind::EscapeString).Str = FString(Sv);
+		return Diag;
+	}
 	Diag.Args.Emplace(FString(Sv).ReplaceCharWithEscapedChar());
 	return Diag;
 };
 
 FORCEINLINE FDcDiagnostic& operator<<(FDcDiagnostic& Diag, const FFieldVariant& Property)
 {
+	if (Diag.bMuted)
+		return Diag;
+	if (Diag.bDeferred)
+	{
+		FDcDiagnosticDeferredArg& Deferred = Diag.AddDeferredArg(FDcDiagnosticDeferredArg::EKind::FieldFullName);
+		Deferred.FieldName = Property.GetFName();
+		Deferred.Field = Property;
+		if (Property.IsValid())
+			Deferred.FieldOwner = Property.IsUObject() ? Property.ToUObjectUnsafe() : Property.ToFieldUnsafe()->GetOwnerUObject();
+		return Diag;
+	}
 	Diag.Args.Emplace(Property.GetFullName());
 	return Diag;
 }
@@ -21,6 +21,10 @@ enum Type : uint16
 	CustomMessage,
 
 	PlaceHoldError,
+
+	//	File
+	FileMapFailed,
+	FileTooLarge,
 };
 
 } // namespace DcDCommon
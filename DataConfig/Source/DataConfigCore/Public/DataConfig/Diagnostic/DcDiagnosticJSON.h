@@ -28,6 +28,7 @@ enum Type : uint16
 	ExpectStateInProgress,
 	ExpectStateUninitializedOrFinished,
 	UnexpectedTrailingToken,
+	InvalidUtf8,
 
 	//	Number
 	NumberInvalidChar,
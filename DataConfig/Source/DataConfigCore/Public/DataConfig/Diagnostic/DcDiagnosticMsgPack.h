@@ -24,6 +24,7 @@ enum Type : uint16
 	SizeOverInt32Max,
 	ArrayRemains,
 	MapRemains,
+	InvalidUtf8,
 
 };
 
@@ -54,6 +54,13 @@ enum Type : uint16
 	//	skip
 	SkipOutOfRange,
 
+	//	tape reader
+	TapeUnsupportedDataEntry,
+	TapeNumberOutOfRange,
+
+	//	sink
+	SinkWriteFailed,
+
 
 };
 
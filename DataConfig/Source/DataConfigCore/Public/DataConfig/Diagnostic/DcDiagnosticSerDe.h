@@ -61,6 +61,9 @@ enum Type : uint16
 	//	Pipe
 	DateTimeParseFail,
 	TimespanParseFail,
+
+	//	References
+	PackageAsyncLoadFailed,
 };
 
 } // namespace DcDSerDe
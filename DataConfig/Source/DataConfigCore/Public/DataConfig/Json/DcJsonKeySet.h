@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/Misc/DcUtf8.h"
+
+///	Per object key set for JSON duplicated key checks.
+///	Stores key hashes along with a cheap key handle instead of copied strings.
+///	Small objects do a linear scan on hashes and an open addressing index is built
+///	when the object grows past `LinearMax` keys.
+template<typename TKey>
+struct TDcJsonKeySet
+{
+	static constexpr int32 LinearMax = 16;
+
+	struct FEntry
+	{
+		uint32 Hash;
+		TKey Key;
+	};
+
+	TArray<FEntry, TInlineAllocator<8>> Entries;
+	TArray<int32> Index;	//	entry index + 1, 0 marks empty slot
+
+	template<typename TEquals>
+	bool Contains(uint32 Hash, TEquals&& Equals) const
+	{
+		if (Index.Num() == 0)
+		{
+			for (const FEntry& Entry : Entries)
+			{
+				if (Entry.Hash == Hash && Equals(Entry.Key))
+					return true;
+			}
+			return false;
+		}
+
+		uint32 Mask = (uint32)Index.Num() - 1;
+		for (uint32 Slot = Hash & Mask; ; Slot = (Slot + 1) & Mask)
+		{
+			int32 EntryIx = Index[Slot];
+			if (EntryIx == 0)
+				return false;
+
+			const FEntry& Entry = Entries[EntryIx - 1];
+			if (Entry.Hash == Hash && Equals(Entry.Key))
+				return true;
+		}
+	}
+
+	void Add(uint32 Hash, TKey&& Key)
+	{
+		int32 EntryIx = Entries.Emplace(FEntry{Hash, MoveTemp(Key)});
+		if (Index.Num() != 0)
+		{
+			if (Entries.Num() * 2 > Index.Num())
+				RebuildIndex(Index.Num() * 2);
+			else
+				InsertIndex(EntryIx);
+		}
+		else if (Entries.Num() > LinearMax)
+		{
+			RebuildIndex(LinearMax * 4);
+		}
+	}
+
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+
+	void Reset()
+	{
+		Entries.Reset();
+		Index.Reset();
+	}
+
+private:
+
+	void InsertIndex(int32 EntryIx)
+	{
+		uint32 Mask = (uint32)Index.Num() - 1;
+		uint32 Slot = Entries[EntryIx].Hash & Mask;
+		while (Index[Slot] != 0)
+			Slot = (Slot + 1) & Mask;
+
+		Index[Slot] = EntryIx + 1;
+	}
+
+	void RebuildIndex(int32 NewSize)
+	{
+		check(FMath::IsPowerOfTwo(NewSize));
+		Index.Reset();
+		Index.SetNumZeroed(NewSize);
+		for (int32 Ix = 0; Ix < Entries.Num(); Ix++)
+			InsertIndex(Ix);
+	}
+};
+
+namespace DcJsonKeySet
+{
+
+FORCEINLINE uint32 CodeUnit(ANSICHAR Ch) { return (uint8)Ch; }
+template<typename CharType>
+FORCEINLINE uint32 CodeUnit(CharType Ch) { return (uint32)Ch; }
+
+///	FNV-1a on char code units so ascii and wide keys with same content hash the same
+template<typename CharType>
+FORCEINLINE uint32 HashChars(const CharType* Ptr, int32 Num)
+{
+	uint32 Hash = 2166136261u;
+	for (int32 Ix = 0; Ix < Num; Ix++)
+	{
+		Hash ^= CodeUnit(Ptr[Ix]);
+		Hash *= 16777619u;
+	}
+
+	//	fold high bits down as the index masks low bits
+	return Hash ^ (Hash >> 16);
+}
+
+///	same hash as `HashChars` on the decoded `TCHAR`s of validated UTF8
+FORCEINLINE uint32 HashUtf8Chars(const ANSICHAR* Ptr, int32 Num)
+{
+	uint32 Hash = 2166136261u;
+	DcUtf8::ForEachChar((const uint8*)Ptr, Num, [&Hash](TCHAR Ch)
+	{
+		Hash ^= CodeUnit(Ch);
+		Hash *= 16777619u;
+		return true;
+	});
+
+	return Hash ^ (Hash >> 16);
+}
+
+} // namespace DcJsonKeySet
+
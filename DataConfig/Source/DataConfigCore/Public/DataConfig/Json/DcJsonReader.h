@@ -5,8 +5,11 @@
 #include "DataConfig/Reader/DcReader.h"
 #include "DataConfig/Source/DcSourceTypes.h"
 #include "DataConfig/Source/DcSourceUtils.h"
+#include "DataConfig/Source/DcSourceStream.h"
+#include "DataConfig/Source/DcMappedFile.h"
 #include "DataConfig/Diagnostic/DcDiagnostic.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
+#include "DataConfig/Json/DcJsonKeySet.h"
 
 template<typename CharType>
 struct TDcJsonReader : public FDcReader, private FNoncopyable
@@ -80,6 +83,10 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 
 	FORCEINLINE FDcResult SetNewString(const CharType* InStrPtr) { return SetNewString(InStrPtr, CString::Strlen(InStrPtr)); }
 
+	///	read from a stream in chunks instead of a whole buffer. `InStream` is borrowed and should outlive the read.
+	///	only a window around the current token is retained, thus string views read are always owned.
+	FDcResult SetNewStream(FDcSourceStream* InStream, int32 InChunkSize = 64 * 1024);
+
 
 	enum class EState : uint8
 	{
@@ -101,6 +108,18 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	int32 Cur = 0;
 	FString DiagFilePath;
 
+	FDcSourceStream* Stream = nullptr;
+	TArray<uint8> StreamBuf;	//	only first `StreamNum` bytes are valid
+	int32 StreamNum = 0;
+	int32 StreamChunkSize = 0;
+	bool bStreamEnded = false;
+
+	///	chars kept before the current token for diagnostic context
+	int32 StreamRetainNum = 1024;
+
+	bool FillStream(int32 MinNum);
+	void CompactStream();
+
 	FDcResult Coercion(EDcDataEntry ToEntry, bool* OutPtr) override;
 	FDcResult PeekRead(EDcDataEntry* OutPtr) override;
 
@@ -108,6 +127,7 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	FDcResult ReadBool(bool* OutPtr) override;
 	FDcResult ReadName(FName* OutPtr) override;
 	FDcResult ReadString(FString* OutPtr) override;
+	FDcResult ReadStringView(FDcStringViewData* OutPtr) override;
 	FDcResult ReadText(FText* OutPtr) override;
 
 	FDcResult ReadMapRoot() override;
@@ -115,6 +135,10 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	FDcResult ReadArrayRoot() override;
 	FDcResult ReadArrayEnd() override;
 
+	FDcResult PeekContainerSize(int32* OutPtr) override;
+	///	scans to the matching bracket for containers without tokenizing the content
+	FDcResult SkipValue() override;
+
 	FDcResult ReadInt8(int8* OutPtr) override;
 	FDcResult ReadInt16(int16* OutPtr) override;
 	FDcResult ReadInt32(int32* OutPtr) override;
@@ -146,6 +170,7 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 
 	FDcResult ReadStringToken();
 	FDcResult ParseStringToken(FString &OutStr);
+	FDcResult ParseStringTokenView(FDcStringViewData& OutView);
 
 	FDcResult ReadNumberToken();
 
@@ -157,9 +182,16 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	};
 
 	TArray<EParseState, TInlineAllocator<8>> States;
-	using FKeys = TArray<FString, TInlineAllocator<8>>;
+	using FKeys = TDcJsonKeySet<FDcStringViewData>;
 	TArray<FKeys, TInlineAllocator<8>> Keys;
 
+	///	set to false to skip duplicated key checks on trusted inputs
+	bool bCheckDuplicatedKey = true;
+
+	///	set to true to count container items ahead on `PeekContainerSize`,
+	///	costs an extra scan over each container but lets writers reserve upfront
+	bool bCountContainerSize = false;
+
 	FORCEINLINE EParseState GetTopState() { return States.Top(); }
 	FORCEINLINE void PushTopState(EParseState InState) { States.Push(InState); }
 	FORCEINLINE void PopTopState(EParseState InState) { check(GetTopState() == InState); States.Pop(); }
@@ -179,10 +211,11 @@ struct TDcJsonReader : public FDcReader, private FNoncopyable
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
 
 	FDcResult CheckNotObjectKey();
-	FDcResult CheckObjectDuplicatedKey(const FString& Key);
+	FDcResult CheckObjectDuplicatedKey(const FDcStringViewData& Key);
 	FDcResult CheckNotAtEnd();
 
-	FString ConvertStringTokenToLiteral(SourceRef Ref);
+	FDcResult ValidateStringUtf8(SourceRef Ref, int32& OutCharNum);
+	FDcResult ConvertStringTokenToLiteral(SourceRef Ref, FString& OutStr);
 
 	static FName ClassId();
 	FName GetId() override;
@@ -199,3 +232,11 @@ struct FDcJsonReader : public TDcJsonReader<TCHAR>
 
 using FDcWideJsonReader = TDcJsonReader<WIDECHAR>;
 using FDcAnsiJsonReader = TDcJsonReader<ANSICHAR>;
+
+///	UTF-8 reader directly over a memory mapped file, the mapping is released with the reader
+struct DATACONFIGCORE_API FDcMappedJsonReader : public FDcAnsiJsonReader
+{
+	FDcMappedFile File;
+
+	FDcResult OpenFile(const TCHAR* Path);
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "DataConfig/DcTypes.h"
+
+///	Block scanner used by `FDcAnsiJsonReader` to skip over string contents and whitespace runs
+enum class EDcJsonScanImpl : uint8
+{
+	Scalar,
+	SSE2,
+	NEON,
+};
+
+namespace DcJsonScan
+{
+
+///	best implementation available on this build and CPU
+DATACONFIGCORE_API EDcJsonScanImpl GetNativeImpl();
+
+///	implementation currently used by readers, defaults to native
+DATACONFIGCORE_API EDcJsonScanImpl GetImpl();
+
+///	override scanner implementation, mostly for testing and benchmarking.
+///	falls back to `Scalar` when the requested one isn't available
+DATACONFIGCORE_API void SetImpl(EDcJsonScanImpl InImpl);
+
+DATACONFIGCORE_API const TCHAR* ImplToString(EDcJsonScanImpl InImpl);
+
+} // namespace DcJsonScan
+
@@ -2,7 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "DataConfig/Source/DcSourceUtils.h"
+#include "DataConfig/Source/DcSinkStream.h"
 #include "DataConfig/Writer/DcWriter.h"
+#include "DataConfig/Json/DcJsonKeySet.h"
 
 struct FDcJsonWriterShared : public FDcWriter, private FNoncopyable
 {
@@ -37,6 +39,8 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 		bool bUsesNewLine;						//  whether uses newline
 		bool bNestedArrayStartsOnNewLine;		//	aka C Braces Style on nested array
 		bool bNestedObjectStartsOnNewLine;		//	aka C Braces Style on nested map
+		bool bFastNumeric;						//	format numbers without printf and ignore numeric format literals,
+												//	floats are written in shortest form that round trips
 	};
 
 	constexpr static CharType _DEFAULT_SPACING_LITERAL[] = { ' ', 0 };
@@ -62,6 +66,7 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 		_DEFAULT_DOUBLE_FORMAT_LITERAL,
 		true,
 		false,
+		false,
 		false
 	};
 
@@ -78,6 +83,7 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 		_DEFAULT_DOUBLE_FORMAT_LITERAL,
 		false,
 		false,
+		false,
 		false
 	};
 
@@ -93,6 +99,7 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 		_INLINE_FLOAT_DOUBLE_FORMAT_LITERAL,
 		false,
 		false,
+		false,
 		false
 	};
 
@@ -117,9 +124,24 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 	};
 
 	TArray<EWriteState, TInlineAllocator<8>> States;
-	using FKeys = TArray<FName, TInlineAllocator<8>>;
+
+	///	written key span in `KeyChars`, escaped and without quotes
+	struct FKeySpan
+	{
+		int32 Begin;
+		int32 Num;
+	};
+
+	using FKeys = TDcJsonKeySet<FKeySpan>;
 	TArray<FKeys, TInlineAllocator<8>> Keys;
 
+	///	keys are copied out of `Sb` as it can be flushed to sink, `KeyCharsMarks` are per object starts
+	TArray<CharType> KeyChars;
+	TArray<int32, TInlineAllocator<8>> KeyCharsMarks;
+
+	///	set to true to fail on duplicated keys within an object, off by default
+	bool bCheckDuplicatedKey = false;
+
 	FORCEINLINE EWriteState GetTopState() { return States.Top(); }
 
 	struct FState
@@ -171,6 +193,16 @@ struct TDcJsonWriter : public FDcJsonWriterShared
 	static FName ClassId();
 	FName GetId() override;
 
+	///	flush `Sb` to `InSink` whenever it grows over `InFlushSize` after a value is written,
+	///	output is UTF8 regardless of `CharType`. `InSink` is borrowed and should outlive the writer.
+	FDcResult SetSink(FDcSinkStream* InSink, int32 InFlushSize = 64 * 1024);
+	///	write out everything left in `Sb`, call this after the last write
+	FDcResult FlushSink();
+
+	FDcSinkStream* Sink = nullptr;
+	int32 SinkFlushSize = 0;
+	TArray<uint8> SinkBuf;		//	UTF8 scratch for wide char writers
+
 	///	Unsafe extension to write arbitrary string at value position
 	FDcResult WriteRawStringValue(const FString& Value);
 	///	Cancel write comma for ndjson like spacing
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+///	UTF8 helpers for reading and writing UTF8 bytes without going through `FString`.
+///	Decoding functions expect input that already passed `Validate`.
+namespace DcUtf8
+{
+
+///	number of ascii bytes at `Ptr` before the first non ascii byte, scanned by blocks when possible
+DATACONFIGCORE_API int32 ScanAsciiRun(const uint8* Ptr, int32 Num);
+
+///	validate UTF8 bytes, rejecting overlong forms, surrogates and code points above U+10FFFF.
+///	on success `OutCharNum` is the number of `TCHAR` it decodes to
+DATACONFIGCORE_API bool Validate(const uint8* Ptr, int32 Num, int32& OutCharNum);
+
+///	decode validated UTF8 into a string with exactly `CharNum` chars
+DATACONFIGCORE_API FString ToString(const uint8* Ptr, int32 Num, int32 CharNum);
+
+///	decode one code point from validated UTF8 and advance `Ptr`
+FORCEINLINE uint32 DecodeCodePoint(const uint8*& Ptr)
+{
+	uint32 Lead = *Ptr++;
+	if (Lead < 0x80)
+		return Lead;
+
+	if (Lead < 0xE0)
+	{
+		uint32 Cp = ((Lead & 0x1F) << 6) | (Ptr[0] & 0x3F);
+		Ptr += 1;
+		return Cp;
+	}
+
+	if (Lead < 0xF0)
+	{
+		uint32 Cp = ((Lead & 0x0F) << 12) | ((Ptr[0] & 0x3F) << 6) | (Ptr[1] & 0x3F);
+		Ptr += 2;
+		return Cp;
+	}
+
+	uint32 Cp = ((Lead & 0x07) << 18) | ((Ptr[0] & 0x3F) << 12) | ((Ptr[1] & 0x3F) << 6) | (Ptr[2] & 0x3F);
+	Ptr += 3;
+	return Cp;
+}
+
+///	invoke `Func(TCHAR)` for each decoded char, splitting into surrogate pairs when `TCHAR` is 16 bit.
+///	stops early and returns false when `Func` returns false
+template<typename TFunc>
+FORCEINLINE bool ForEachChar(const uint8* Ptr, int32 Num, TFunc&& Func)
+{
+	const uint8* End = Ptr + Num;
+	while (Ptr < End)
+	{
+		uint32 Cp = DecodeCodePoint(Ptr);
+		if (sizeof(TCHAR) == 2 && Cp > 0xFFFF)
+		{
+			Cp -= 0x10000;
+			if (!Func((TCHAR)(0xD800 + (Cp >> 10))))
+				return false;
+			if (!Func((TCHAR)(0xDC00 + (Cp & 0x3FF))))
+				return false;
+		}
+		else
+		{
+			if (!Func((TCHAR)Cp))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+///	encode `TCHAR`s as UTF8 through `Emit(ANSICHAR)`, joining surrogate pairs.
+///	unpaired surrogates are written as U+FFFD
+template<typename TEmit>
+FORCEINLINE void EncodeChars(const TCHAR* Ptr, int32 Num, TEmit&& Emit)
+{
+	for (int32 Ix = 0; Ix < Num; Ix++)
+	{
+		uint32 Cp = (uint32)Ptr[Ix];
+		if (Cp < 0x80)
+		{
+			Emit((ANSICHAR)Cp);
+			continue;
+		}
+
+		if (Cp >= 0xD800 && Cp <= 0xDFFF)
+		{
+			if (Cp <= 0xDBFF
+				&& Ix + 1 < Num
+				&& (uint32)Ptr[Ix + 1] >= 0xDC00
+				&& (uint32)Ptr[Ix + 1] <= 0xDFFF)
+			{
+				Cp = 0x10000 + ((Cp - 0xD800) << 10) + ((uint32)Ptr[Ix + 1] - 0xDC00);
+				Ix++;
+			}
+			else
+			{
+				Cp = 0xFFFD;
+			}
+		}
+
+		if (Cp < 0x800)
+		{
+			Emit((ANSICHAR)(0xC0 | (Cp >> 6)));
+			Emit((ANSICHAR)(0x80 | (Cp & 0x3F)));
+		}
+		else if (Cp < 0x10000)
+		{
+			Emit((ANSICHAR)(0xE0 | (Cp >> 12)));
+			Emit((ANSICHAR)(0x80 | ((Cp >> 6) & 0x3F)));
+			Emit((ANSICHAR)(0x80 | (Cp & 0x3F)));
+		}
+		else
+		{
+			Emit((ANSICHAR)(0xF0 | (Cp >> 18)));
+			Emit((ANSICHAR)(0x80 | ((Cp >> 12) & 0x3F)));
+			Emit((ANSICHAR)(0x80 | ((Cp >> 6) & 0x3F)));
+			Emit((ANSICHAR)(0x80 | (Cp & 0x3F)));
+		}
+	}
+}
+
+} // namespace DcUtf8
+
@@ -4,6 +4,7 @@
 #include "DataConfig/DcTypes.h"
 #include "DcMsgPackUtils.h"
 #include "DataConfig/Reader/DcReader.h"
+#include "DataConfig/Source/DcMappedFile.h"
 
 struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopyable
 {
@@ -44,6 +45,7 @@ struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopya
 	FDcResult ReadNone() override;
 	FDcResult ReadBool(bool* OutPtr) override;
 	FDcResult ReadString(FString* OutPtr) override;
+	FDcResult ReadStringView(FDcStringViewData* OutPtr) override;
 	FDcResult ReadName(FName* OutPtr) override;
 	FDcResult ReadText(FText* OutPtr) override;
 
@@ -54,6 +56,10 @@ struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopya
 	FDcResult ReadArrayRoot() override;
 	FDcResult ReadArrayEnd() override;
 
+	FDcResult PeekContainerSize(int32* OutPtr) override;
+	///	jumps over values by length prefixes and item counts without decoding
+	FDcResult SkipValue() override;
+
 	FDcResult ReadInt8(int8* OutPtr) override;
 	FDcResult ReadInt16(int16* OutPtr) override;
 	FDcResult ReadInt32(int32* OutPtr) override;
@@ -84,4 +90,11 @@ struct DATACONFIGCORE_API FDcMsgPackReader : public FDcReader, private FNoncopya
 
 };
 
+///	Reader directly over a memory mapped file, the mapping is released with the reader
+struct DATACONFIGCORE_API FDcMappedMsgPackReader : public FDcMsgPackReader
+{
+	FDcMappedFile File;
+
+	FDcResult OpenFile(const TCHAR* Path);
+};
 
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/MsgPack/DcMsgPackUtils.h"
+#include "DataConfig/Source/DcSinkStream.h"
 #include "DataConfig/Writer/DcWriter.h"
 
 struct DATACONFIGCORE_API FDcMsgPackWriter : public FDcWriter, private FNoncopyable
@@ -23,15 +24,33 @@ struct DATACONFIGCORE_API FDcMsgPackWriter : public FDcWriter, private FNoncopya
 		uint8 LastTypeByte;
 
 		uint32 Size;
-		BufferType Buffer;
+		int64 HeaderIx;		//	container header offset in `Buffer`. negative once flushed to sink
+		int32 PendingIx;	//	index into `PendingHeaders`, `INDEX_NONE` once flushed as a 32bit header
 	};
 
-	TArray<FWriteState, TInlineAllocator<4>> States;
+	TArray<FWriteState, TInlineAllocator<8>> States;
 	FORCEINLINE EWriteState GetTopStateType() { return States.Top().Type; }
 
+	///	Header of a container in `Buffer`, reserved at max width on open and
+	///	encoded on end. `Len` is 0 while the container is open.
+	struct FPendingHeader
+	{
+		int32 HeaderIx;
+		int32 StateIx;
+		uint8 Len;
+		uint8 Bytes[5];		//	`Bytes[0]` is the 32bit type byte while open
+	};
+
+	TArray<FPendingHeader> PendingHeaders;
+
+	///	Single output buffer. Nested containers are written in place and
+	///	their headers are compacted in one pass once a root level value ends.
+	BufferType Buffer;
 	BufferType& GetMainBuffer();
 
 	FDcMsgPackWriter();
+	///	`SizeHint` reserves output buffer bytes upfront
+	explicit FDcMsgPackWriter(int32 SizeHint);
 
 	FDcResult PeekWrite(EDcDataEntry Next, bool* bOutOk) override;
 
@@ -69,6 +88,19 @@ struct DATACONFIGCORE_API FDcMsgPackWriter : public FDcWriter, private FNoncopya
 
 	FDcResult WriteExt(uint8 Type, FDcBlobViewData Blob);
 
+	///	flush `Buffer` to `InSink` whenever it grows over `InFlushSize` after a value is written.
+	///	If the sink can patch, containers still open on flush are written with 32bit headers and
+	///	patched in the sink on end so memory stays bounded. Otherwise open containers stay buffered
+	///	until they end.
+	///	`InSink` is borrowed and should outlive the writer.
+	FDcResult SetSink(FDcSinkStream* InSink, int32 InFlushSize = 64 * 1024);
+	///	write out bytes in `Buffer` that don't need backpatching, call this after the last write
+	FDcResult FlushSink();
+
+	FDcSinkStream* Sink = nullptr;
+	int32 SinkFlushSize = 0;
+	bool bSinkPatchHeaders = false;
+
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
 
 	static FName ClassId();
@@ -84,6 +84,8 @@ struct DATACONFIGCORE_API FDcPropertyReader : public FDcReader, private FNoncopy
 	FDcResult ReadFloat(float* OutPtr) override;
 	FDcResult ReadDouble(double* OutPtr) override;
 	FDcResult ReadBlob(FDcBlobViewData* OutPtr) override;
+	FDcResult PeekContainerSize(int32* OutPtr) override;
+	FDcResult SkipValue() override;
 
 	///	try skip read at current position
 	FDcResult SkipRead();
@@ -2,6 +2,7 @@
 
 #include "DataConfig/DcTypes.h"
 #include "UObject/UnrealType.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 using FDcProcessPropertyPredicateSignature = bool(*)(FProperty* Property);
 DECLARE_DELEGATE_RetVal_OneParam(bool, FDcProcessPropertyPredicateDelegate, FProperty*);
@@ -9,11 +10,48 @@ DECLARE_DELEGATE_RetVal_OneParam(bool, FDcProcessPropertyPredicateDelegate, FPro
 using FDcExpandObjectPredicateSignature = bool(*)(FObjectProperty* ObjectProperty);
 DECLARE_DELEGATE_RetVal_OneParam(bool, FDcExpandObjectPredicateDelegate, FObjectProperty*);
 
+///	Immutable per struct list of properties that passes `FDcPropertyConfig::ShouldProcessProperty`,
+///	in `PropertyLink` order and with a name index for constant time lookups.
+struct DATACONFIGCORE_API FDcPropertyTable
+{
+	struct FEntry
+	{
+		FName Name;
+		FProperty* Property;
+	};
+
+	TArray<FEntry> Entries;
+	TArray<int32> Index;	//	entry index + 1, 0 marks empty slot
+
+	//	snapshot of the struct layout this is built from
+	TWeakObjectPtr<UStruct> Struct;
+	FProperty* PropertyLink = nullptr;
+	int32 PropertiesSize = 0;
+
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+	FORCEINLINE FProperty* GetProperty(int32 Ix) const { return Ix < Entries.Num() ? Entries[Ix].Property : nullptr; }
+
+	///	`HintIx` is checked first as fields usually come in order
+	int32 FindIndex(const FName& Name, int32 HintIx = INDEX_NONE) const;
+	bool IsStale(UStruct* InStruct) const;
+};
+
+struct FDcPropertyTableCache;
+using FDcPropertyTableRef = TSharedPtr<const FDcPropertyTable, ESPMode::ThreadSafe>;
+
 struct DATACONFIGCORE_API FDcPropertyConfig
 {
 	FDcProcessPropertyPredicateDelegate ProcessPropertyPredicate;
 	FDcExpandObjectPredicateDelegate ExpandObjectPredicate;
 
+	TSharedPtr<FDcPropertyTableCache, ESPMode::ThreadSafe> TableCache;
+	FDelegateHandle TableCachePredicate;
+
+	//	tables found through this config, looked up without locking the shared cache. These also keep
+	//	tables alive while the owning reader or writer's states might point to them
+	TMap<UStruct*, FDcPropertyTableRef> LocalTables;
+	TArray<FDcPropertyTableRef> LocalStaleTables;
+
 	static FDcPropertyConfig MakeDefault();
 	static FDcPropertyConfig MakeNoExpandObject();
 
@@ -25,6 +63,15 @@ struct DATACONFIGCORE_API FDcPropertyConfig
 	FProperty* NextProcessPropertyByName(UStruct* Struct, FProperty* InProperty, const FName& Name);
 	FProperty* FindProcessPropertyByName(UStruct* Struct, const FName& Name);
 
+	///	Cache property tables per struct for current `ProcessPropertyPredicate`, which should be a pure function.
+	///	Rebinding the predicate disables the cache until this is called again.
+	void EnableTableCache();
+	///	Returns nullptr when table cache isn't enabled. Tables are rebuilt when struct layout changes on
+	///	hot reload or reinstancing. Returned table lives as long as this config.
+	const FDcPropertyTable* FindTable(UStruct* Struct);
+	///	Lookup through `Table` when it's not null, `InOutIx` tracks last found index in table.
+	FProperty* NextProcessPropertyByName(const FDcPropertyTable* Table, UStruct* Struct, FProperty* InProperty, const FName& Name, int32& InOutIx);
+
 	bool ShouldExpandObject(FObjectProperty* ObjectProperty);
 };
 
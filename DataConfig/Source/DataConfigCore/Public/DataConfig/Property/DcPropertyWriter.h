@@ -81,6 +81,7 @@ struct DATACONFIGCORE_API FDcPropertyWriter : public FDcWriter, private FNoncopy
 	FDcResult WriteFloat(const float& Value) override;
 	FDcResult WriteDouble(const double& Value) override;
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
+	void SetContainerSizeHint(int32 Num) override;
 
 	///	try skip write at current position
 	FDcResult SkipWrite();
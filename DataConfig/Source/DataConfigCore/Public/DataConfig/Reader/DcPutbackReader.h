@@ -15,6 +15,7 @@ struct DATACONFIGCORE_API FDcPutbackReader : public FDcReader
 	FDcResult ReadBool(bool* OutPtr) override;
 	FDcResult ReadName(FName* OutPtr) override;
 	FDcResult ReadString(FString* OutPtr) override;
+	FDcResult ReadStringView(FDcStringViewData* OutPtr) override;
 	FDcResult ReadText(FText* OutPtr) override;
 	FDcResult ReadEnum(FDcEnumData* OutPtr) override;
 
@@ -59,6 +60,8 @@ struct DATACONFIGCORE_API FDcPutbackReader : public FDcReader
 	FDcResult ReadDouble(double* OutPtr) override;
 
 	FDcResult ReadBlob(FDcBlobViewData* OutPtr) override;
+	FDcResult PeekContainerSize(int32* OutPtr) override;
+	FDcResult SkipValue() override;
 
 	template<typename T>
 	void Putback(T&& InValue);
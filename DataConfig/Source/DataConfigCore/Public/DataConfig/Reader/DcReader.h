@@ -20,6 +20,7 @@ struct DATACONFIGCORE_API FDcReader
 	virtual FDcResult ReadBool(bool* OutPtr);
 	virtual FDcResult ReadName(FName* OutPtr);
 	virtual FDcResult ReadString(FString* OutPtr);
+	virtual FDcResult ReadStringView(FDcStringViewData* OutPtr);
 	virtual FDcResult ReadText(FText* OutPtr);
 	virtual FDcResult ReadEnum(FDcEnumData* OutPtr);
 
@@ -97,11 +98,20 @@ struct DATACONFIGCORE_API FDcReader
 
 	virtual FDcResult ReadBlob(FDcBlobViewData* OutPtr);
 
+	///	Remaining item count of the container just entered by `Read{Array,Set,Map}Root`,
+	///	map counts key value pairs. Gives `INDEX_NONE` when it isn't known upfront.
+	virtual FDcResult PeekContainerSize(int32* OutPtr);
+
+	///	Skip next value as a whole, including nested containers. Default implementation
+	///	reads through every entry, readers override it to skip without decoding.
+	virtual FDcResult SkipValue();
+
 	virtual void FormatDiagnostic(FDcDiagnostic& Diag);
 
 	FORCEINLINE friend FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcReader& Self)
 	{
-		Self.FormatDiagnostic(Diag);
+		if (!Diag.bMuted)
+			Self.FormatDiagnostic(Diag);
 		return Diag;
 	}
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "DataConfig/Reader/DcReader.h"
+
+///	Data entries of a whole document parsed once into a flat token array.
+///	Containers know where they end so subtrees can be skipped without decoding,
+///	string payloads are copied into `Chars` so the source can be released after `Build`.
+struct DATACONFIGCORE_API FDcTape
+{
+	struct FToken
+	{
+		EDcDataEntry Type;
+		bool bNumberLiteral;	//	number kept as text, read as any numeric
+		int32 End;				//	next sibling, one past `*End` for containers
+		int32 Parent;			//	enclosing container root, end tokens point to the root they close
+
+		union
+		{
+			bool Bool;
+			int64 Signed64;
+			uint64 Unsigned64;
+			double Double;
+			int32 ChildNum;		//	container roots, map counts key value pairs
+			struct
+			{
+				int32 Begin;
+				int32 Num;
+			} Span;				//	into `Chars` or `Bytes`
+		};
+	};
+
+	TArray<FToken> Tokens;
+	TArray<TCHAR> Chars;
+	TArray<uint8> Bytes;
+
+	///	read everything from `Reader` till it ends
+	FDcResult Build(FDcReader* Reader);
+	void Reset();
+
+	FORCEINLINE const TCHAR* GetChars(const FToken& Token) const { return Chars.GetData() + Token.Span.Begin; }
+	FORCEINLINE FStringView GetStringView(const FToken& Token) const { return FStringView(GetChars(Token), Token.Span.Num); }
+};
+
+///	Reader over a `FDcTape`, which can skip values in O(1), rewind to saved positions
+///	and look up map keys ahead of the read position.
+struct DATACONFIGCORE_API FDcTapeReader : public FDcReader
+{
+	FDcTapeReader(const FDcTape* InTape);
+
+	const FDcTape* Tape;
+	int32 Cur = 0;
+
+	///	key positions hidden from reads along with their values, see `IgnoreMapEntry`.
+	///	Scoped to open maps, outer maps first, popped when their map ends or is rewound out of
+	struct FIgnoredKey
+	{
+		int32 Map;
+		int32 Key;
+	};
+	TArray<FIgnoredKey, TInlineAllocator<4>> IgnoredKeys;
+
+	FDcResult Coercion(EDcDataEntry ToEntry, bool* OutPtr) override;
+	FDcResult PeekRead(EDcDataEntry* OutPtr) override;
+
+	FDcResult ReadNone() override;
+	FDcResult ReadBool(bool* OutPtr) override;
+	FDcResult ReadName(FName* OutPtr) override;
+	FDcResult ReadString(FString* OutPtr) override;
+	FDcResult ReadStringView(FDcStringViewData* OutPtr) override;
+	FDcResult ReadText(FText* OutPtr) override;
+
+	FDcResult ReadMapRoot() override;
+	FDcResult ReadMapEnd() override;
+	FDcResult ReadArrayRoot() override;
+	FDcResult ReadArrayEnd() override;
+	FDcResult ReadSetRoot() override;
+	FDcResult ReadSetEnd() override;
+	FDcResult ReadOptionalRoot() override;
+	FDcResult ReadOptionalEnd() override;
+
+	FDcResult ReadInt8(int8* OutPtr) override;
+	FDcResult ReadInt16(int16* OutPtr) override;
+	FDcResult ReadInt32(int32* OutPtr) override;
+	FDcResult ReadInt64(int64* OutPtr) override;
+
+	FDcResult ReadUInt8(uint8* OutPtr) override;
+	FDcResult ReadUInt16(uint16* OutPtr) override;
+	FDcResult ReadUInt32(uint32* OutPtr) override;
+	FDcResult ReadUInt64(uint64* OutPtr) override;
+
+	FDcResult ReadFloat(float* OutPtr) override;
+	FDcResult ReadDouble(double* OutPtr) override;
+
+	FDcResult ReadBlob(FDcBlobViewData* OutPtr) override;
+	FDcResult PeekContainerSize(int32* OutPtr) override;
+
+	///	jumps over containers in O(1)
+	FDcResult SkipValue() override;
+
+	FORCEINLINE int32 GetPosition() const { return Cur; }
+	///	move back or forth to a position from `GetPosition` or `FindMapKey`,
+	///	ignored keys are kept only for maps enclosing `Position`
+	void Rewind(int32 Position);
+
+	///	position of `Key` in the innermost open map, searching the whole map regardless
+	///	of read position. Gives `INDEX_NONE` when not found or not inside a map
+	int32 FindMapKey(FStringView Key) const;
+	///	hide key value pair at `KeyPosition` from following reads
+	void IgnoreMapEntry(int32 KeyPosition);
+
+	///	read string value of `Key` in the innermost open map then hide the pair,
+	///	read position is left unchanged
+	FDcResult ReadMapStringByKey(FStringView Key, FString* OutPtr, bool* OutFound);
+	FDcResult ReadMapStringByKey(FStringView Key, FDcStringViewData* OutPtr, bool* OutFound);
+
+	void FormatDiagnostic(FDcDiagnostic& Diag) override;
+
+	static FName ClassId();
+	FName GetId() override;
+};
+
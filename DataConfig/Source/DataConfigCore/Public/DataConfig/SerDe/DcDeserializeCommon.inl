@@ -11,7 +11,9 @@
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/Misc/DcTemplateUtils.h"
 #include "UObject/Package.h"
+#include "Misc/PackageName.h"
 #include "Misc/EngineVersionComparison.h"
 
 FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& Ctx, FObjectPropertyBase* ObjectProperty, UObject*& OutObject)
@@ -23,7 +25,23 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 	if (Next == EDcDataEntry::String)
 	{
 		FString Value;
-		DC_TRY(Ctx.Reader->ReadString(&Value));
+		if (Ctx.ObjectReferenceCache)
+		{
+			//	look up the view as read and only build the string on misses
+			FDcStringViewData View;
+			DC_TRY(Ctx.Reader->ReadStringView(&View));
+			if (UObject* Cached = Ctx.ObjectReferenceCache->Find(ObjectProperty->PropertyClass, View))
+			{
+				OutObject = Cached;
+				return DcOk();
+			}
+
+			Value = View.ToString();
+		}
+		else
+		{
+			DC_TRY(Ctx.Reader->ReadString(&Value));
+		}
 
 		if (!Value.StartsWith(TEXT("'"))
 			&& Value.EndsWith(TEXT("'")))
@@ -49,6 +67,8 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 				if (Loaded)
 				{
 					OutObject = Loaded;
+					if (Ctx.ObjectReferenceCache)
+						Ctx.ObjectReferenceCache->Add(ObjectProperty->PropertyClass, Value, OutObject);
 					return DcOk();
 				}
 			}
@@ -59,10 +79,14 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 		}
 		else
 		{
-			return DcSerDeUtils::TryStaticLocateObject(
+			DC_TRY(DcSerDeUtils::TryStaticLocateObject(
 				ObjectProperty->PropertyClass,
 				*Value,
-				OutObject);
+				OutObject));
+
+			if (Ctx.ObjectReferenceCache && OutObject)
+				Ctx.ObjectReferenceCache->Add(ObjectProperty->PropertyClass, Value, OutObject);
+			return DcOk();
 		}
 	}
 	else if (Next == EDcDataEntry::MapRoot)
@@ -75,27 +99,43 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 		//	note that this is ordered and type and path needs to be first 2 items
 
 		DC_TRY(Ctx.Reader->ReadMapRoot());
-		FString MetaKey;
-		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
+		FDcStringViewData MetaKey;
+		DC_TRY(Ctx.Reader->ReadStringView(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$type")));
 
-		FString LoadClassName;
-		DC_TRY(Ctx.Reader->ReadString(&LoadClassName));
+		FDcStringViewData LoadClassName;
+		DC_TRY(Ctx.Reader->ReadStringView(&LoadClassName));
 
-		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
+		DC_TRY(Ctx.Reader->ReadStringView(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$path")));
 
-		FString LoadPath;
-		DC_TRY(Ctx.Reader->ReadString(&LoadPath));
+		FDcStringViewData LoadPath;
+		DC_TRY(Ctx.Reader->ReadStringView(&LoadPath));
 		DC_TRY(Ctx.Reader->ReadMapEnd());
 
 		UClass* LoadClass;
-		DC_TRY(DcSerDeUtils::TryFindFirstObject<UClass>(*LoadClassName, true, LoadClass));
+		DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, LoadClassName, LoadClass,
+			[](FDcDeserializeContext&, const FString& Str, UClass*& OutClass)
+			{
+				return DcSerDeUtils::TryFindFirstObject<UClass>(*Str, true, OutClass);
+			}));
 
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(LoadClass, ObjectProperty->PropertyClass));
 
+		if (Ctx.ObjectReferenceCache)
+		{
+			if (UObject* Cached = Ctx.ObjectReferenceCache->Find(LoadClass, LoadPath))
+			{
+				OutObject = Cached;
+				return DcOk();
+			}
+		}
+
 		UObject* Loaded;
-		DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath, Loaded));
+		DC_TRY(DcSerDeUtils::TryStaticLoadObject(LoadClass, nullptr, *LoadPath.ToString(), Loaded));
+
+		if (Ctx.ObjectReferenceCache)
+			Ctx.ObjectReferenceCache->Add(LoadClass, LoadPath, Loaded);
 
 		OutObject = Loaded;
 		return DcOk();
@@ -116,6 +156,43 @@ FORCEINLINE_DEBUGGABLE FDcResult TryReadObjectReference(FDcDeserializeContext& C
 
 using FDcObjectReaderSignature = FDcResult(*)(FDcDeserializeContext&, FObjectPropertyBase*, UObject*&);
 
+///	With `Ctx.DeferredReferences` set, strings that are object paths are collected into it and
+///	returned in `OutPath` without loading. Anything else goes through `FuncObjectReader`.
+template<FDcObjectReaderSignature FuncObjectReader>
+FORCEINLINE_DEBUGGABLE FDcResult TryReadSoftReference(FDcDeserializeContext& Ctx, FObjectPropertyBase* ObjectProperty, UClass* ExpectClass, bool bIsClass, UObject*& OutObject, FSoftObjectPath& OutPath)
+{
+	OutObject = nullptr;
+	OutPath.Reset();
+	if (Ctx.DeferredReferences == nullptr)
+		return FuncObjectReader(Ctx, ObjectProperty, OutObject);
+
+	EDcDataEntry Next;
+	DC_TRY(Ctx.Reader->PeekRead(&Next));
+	if (Next != EDcDataEntry::String)
+		return FuncObjectReader(Ctx, ObjectProperty, OutObject);
+
+	FString Value;
+	DC_TRY(Ctx.Reader->ReadString(&Value));
+
+	//	"/Game/Path/To/Object" or "Type'/Game/Path/To/Object'"
+	FString PathStr = FPackageName::ExportTextPathToObjectPath(Value);
+	if (PathStr.StartsWith(TEXT("/")))
+	{
+		FSoftObjectPath Path(PathStr);
+		if (Path.IsValid())
+		{
+			Ctx.DeferredReferences->Add(Path, ExpectClass, bIsClass);
+			OutPath = MoveTemp(Path);
+			return DcOk();
+		}
+	}
+
+	FDcPutbackReader PutbackReader(Ctx.Reader);
+	PutbackReader.Putback(MoveTemp(Value));
+	TDcStoreThenReset<FDcReader*> RestoreReader(Ctx.Reader, &PutbackReader);
+	return FuncObjectReader(Ctx, ObjectProperty, OutObject);
+}
+
 template<FDcObjectReaderSignature FuncObjectReader>
 FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeObjectReference(FDcDeserializeContext& Ctx)
 {
@@ -157,7 +234,14 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeSoftObjectReference(FDcDeserialize
 	}
 
 	UObject* Loaded;
-	DC_TRY(FuncObjectReader(Ctx, SoftObjectProperty, Loaded));
+	FSoftObjectPath DeferredPath;
+	DC_TRY(TryReadSoftReference<FuncObjectReader>(Ctx, SoftObjectProperty, SoftObjectProperty->PropertyClass, false, Loaded, DeferredPath));
+
+	if (DeferredPath.IsValid())
+	{
+		DC_TRY(Ctx.Writer->WriteSoftObjectReference(FSoftObjectPtr(DeferredPath)));
+		return DcOk();
+	}
 
 	if (Loaded)
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(Loaded->GetClass(), SoftObjectProperty->PropertyClass));
@@ -251,7 +335,14 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeSoftClassReference(FDcDeserializeC
 	}
 
 	UObject* Loaded;
-	DC_TRY(FuncObjectReader(Ctx, SoftClassProperty, Loaded));
+	FSoftObjectPath DeferredPath;
+	DC_TRY(TryReadSoftReference<FuncObjectReader>(Ctx, SoftClassProperty, SoftClassProperty->MetaClass, true, Loaded, DeferredPath));
+
+	if (DeferredPath.IsValid())
+	{
+		DC_TRY(Ctx.Writer->WriteSoftClassReference(FSoftObjectPtr(DeferredPath)));
+		return DcOk();
+	}
 
 	if (!Loaded)
 	{
@@ -321,27 +412,31 @@ FORCEINLINE_DEBUGGABLE FDcResult DcDeserializeInstancedSubObject(FDcDeserializeC
 
 	UClass* SubClassType = nullptr;
 
-	FString MetaKey;
-	DC_TRY(PutbackReader.ReadString(&MetaKey));
-	if (MetaKey == TEXT("$type"))
+	FDcStringViewData MetaKey;
+	DC_TRY(PutbackReader.ReadStringView(&MetaKey));
+	if (MetaKey.Equals(TEXT("$type")))
 	{
 		//	has `$type`
-		FString TypeStr;
-		DC_TRY(PutbackReader.ReadString(&TypeStr));
+		FDcStringViewData TypeStr;
+		DC_TRY(PutbackReader.ReadStringView(&TypeStr));
 
-		DC_TRY(FuncTypeStrLocator(Ctx, ObjectProperty, TypeStr, SubClassType));
+		DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, TypeStr, SubClassType,
+			[ObjectProperty](FDcDeserializeContext& Ctx, const FString& Str, UClass*& OutClass)
+			{
+				return FuncTypeStrLocator(Ctx, ObjectProperty, Str, OutClass);
+			}));
 
 		if (!SubClassType)
 		{
 			return DC_FAIL(DcDSerDe, UObjectByStrNotFound)
-				<< TEXT("Class") << TypeStr;
+				<< TEXT("Class") << TypeStr.ToString();
 		}
 	}
 	else
 	{
 		//	it has not `$type`, use object property's class
 		SubClassType = ObjectProperty->PropertyClass;
-		PutbackReader.Putback(MetaKey);
+		PutbackReader.Putback(MoveTemp(MetaKey).ToString());
 	}
 
 	check(SubClassType);
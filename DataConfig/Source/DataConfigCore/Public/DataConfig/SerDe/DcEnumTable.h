@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+
+///	Name and value lookups of a `UEnum` built once and shared by enum serializers and deserializers.
+///	Get one through `FDcEnumTable::Get`, which caches tables by enum and is thread safe.
+struct DATACONFIGCORE_API FDcEnumTable
+{
+	TWeakObjectPtr<UEnum> Enum;
+	int32 NumEnums = 0;
+	bool bIsBitFlags = false;
+
+	///	by enum index, names are short form without `Enum::` prefix
+	TArray<FString> Names;
+	TArray<int64> Values;
+
+	///	indices of entries with bits set in enum index order, used to decompose flags
+	TArray<int32> FlagIndices;
+
+	///	`Values` from `DenseMin` index into it when value range is compact, otherwise empty
+	TArray<int32> DenseIndices;
+	int64 DenseMin = 0;
+	///	sorted by value, first index for each value
+	TArray<TPair<int64, int32>> SortedIndices;
+
+	///	short and full names, hashed case insensitive as names are
+	struct FNameKey
+	{
+		FString Str;
+		int32 Index;
+	};
+	TArray<FNameKey> NameKeys;
+	TMultiMap<uint32, int32> NameKeyHashes;
+
+	///	accepts both `Name` and `Enum::Name`, case insensitive like `FName`
+	bool FindValueByName(const FDcStringViewData& Name, int64& OutValue) const;
+	///	first index with `Value`, same as `UEnum::GetIndexByValue`
+	int32 FindIndexByValue(int64 Value) const;
+
+	static TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Get(UEnum* Enum);
+	///	drop cached table after `Enum` is modified at runtime
+	static void Invalidate(UEnum* Enum);
+	static void ResetCache();
+
+	static uint32 HashName(const FDcStringViewData& Name);
+};
+
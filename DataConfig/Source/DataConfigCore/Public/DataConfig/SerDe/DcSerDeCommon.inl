@@ -2,6 +2,7 @@
 
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
+#include "DataConfig/SerDe/DcSerDeUtils.inl"
 
 template<typename TCtx>
 FORCEINLINE_DEBUGGABLE FDcResult DcHandlerPipeScalar(TCtx& Ctx)
@@ -27,6 +28,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeLinearContainer(
 {
 	DC_TRY((Ctx.Reader->*ReadMethodStart)());
 	DC_TRY((Ctx.Writer->*WriteMethodStart)());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
@@ -54,6 +56,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeMap(
 {
 	DC_TRY(Ctx.Reader->ReadMapRoot());
 	DC_TRY(Ctx.Writer->WriteMapRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
@@ -82,6 +85,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStringKeyMap(
 {
 	DC_TRY(Ctx.Reader->ReadMapRoot());
 	DC_TRY(Ctx.Writer->WriteMapRoot());
+	DC_TRY(DcPipe_ContainerSizeHint(Ctx.Reader, Ctx.Writer));
 
 	EDcDataEntry CurPeek;
 	while (true)
@@ -104,10 +108,23 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStringKeyMap(
 	return DcOk();
 }
 
+///	default per field step for struct/class pipes, writes the field name then recurse into the value
+template<typename TCtx,
+	FDcResult (*Recurse)(TCtx&)>
+FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeField(
+	TCtx& Ctx,
+	FName FieldName
+)
+{
+	DC_TRY(Ctx.Writer->WriteName(FieldName));
+	return Recurse(Ctx);
+}
+
 template<typename TCtx,
 	typename TReader,
 	typename TWriter,
-	FDcResult (*Recurse)(TCtx&)>
+	FDcResult (*Recurse)(TCtx&),
+	FDcResult (*RecurseField)(TCtx&, FName) = &DcHandlerPipeField<TCtx, Recurse>>
 FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStruct(
 	TCtx& Ctx
 )
@@ -125,9 +142,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStruct(
 
 		FName FieldName;
 		DC_TRY(Ctx.Reader->ReadName(&FieldName));
-		DC_TRY(Ctx.Writer->WriteName(FieldName));
-
-		DC_TRY(Recurse(Ctx));
+		DC_TRY(RecurseField(Ctx, FieldName));
 	}
 
 	DC_TRY(Ctx.Reader->ReadStructEndAccess(Access));
@@ -139,7 +154,8 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeStruct(
 template<typename TCtx,
 	typename TReader,
 	typename TWriter,
-	FDcResult (*Recurse)(TCtx&)>
+	FDcResult (*Recurse)(TCtx&),
+	FDcResult (*RecurseField)(TCtx&, FName) = &DcHandlerPipeField<TCtx, Recurse>>
 FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeClass(
 	TCtx& Ctx
 )
@@ -165,9 +181,7 @@ FORCEINLINE_DEBUGGABLE static FDcResult DcHandlerPipeClass(
 
 			FName FieldName;
 			DC_TRY(Ctx.Reader->ReadName(&FieldName));
-			DC_TRY(Ctx.Writer->WriteName(FieldName));
-
-			DC_TRY(Recurse(Ctx));
+			DC_TRY(RecurseField(Ctx, FieldName));
 		}
 	}
 
@@ -14,6 +14,9 @@ namespace DcSerDeUtils
 DATACONFIGCORE_API bool IsMeta(const FString& Str);
 DATACONFIGCORE_API FDcResult ExpectMetaKey(const FString& Actual, const TCHAR* Expect);
 
+DATACONFIGCORE_API bool IsMeta(const FDcStringViewData& Str);
+DATACONFIGCORE_API FDcResult ExpectMetaKey(const FDcStringViewData& Actual, const TCHAR* Expect);
+
 DATACONFIGCORE_API FDcResult DispatchPipeVisit(EDcDataEntry Next, FDcReader* Reader, FDcWriter* Writer);
 
 /// FindFirst
@@ -78,6 +81,7 @@ DATACONFIGCORE_API FDcResult ExpectNonAbstract(UClass* Class);
 DATACONFIGCORE_API FString FormatObjectName(UObject* Object);
 
 DATACONFIGCORE_API FDcResult DispatchNoopRead(EDcDataEntry Next, FDcReader* Reader);
+///	forwards to `FDcReader::SkipValue()`
 DATACONFIGCORE_API FDcResult ReadNoopConsumeValue(FDcReader* Reader);
 
 } // namespace DcSerDeUtils
@@ -46,6 +46,14 @@ enum class EDcSerializePredicateResult
 	Process,
 };
 
+///	`Pure` predicates only depend on the top property and whether it's a scalar array item,
+///	which allows `FDcSerializer` to memoize their results when resolution cache is enabled.
+enum class EDcSerializePredicateFlag : uint8
+{
+	None,
+	Pure,
+};
+
 using FDcSerializePredicateSignature = EDcSerializePredicateResult(*)(FDcSerializeContext& Ctx);
 DECLARE_DELEGATE_RetVal_OneParam(EDcSerializePredicateResult, FDcSerializePredicate, FDcSerializeContext&);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Serialize/DcSerializeTypes.h"
 
@@ -10,20 +11,86 @@ struct DATACONFIGCORE_API FDcSerializer : public FNoncopyable
 
 	void AddDirectHandler(FFieldClass* PropertyClass, FDcSerializeDelegate&& Delegate);
 	void AddDirectHandler(UClass* PropertyClass, FDcSerializeDelegate&& Delegate);
-	void AddPredicatedHandler(FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name = NAME_None);
+	void AddPredicatedHandler(FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name = NAME_None,
+		EDcSerializePredicateFlag Flag = EDcSerializePredicateFlag::None);
 	void AddStructHandler(UStruct* Struct, FDcSerializeDelegate&& Delegate);
+	///	Predicated handlers are tried in order, use this to take precedence over ones already added.
+	void InsertPredicatedHandler(int32 Index, FDcSerializePredicate&& Predicate, FDcSerializeDelegate&& Delegate, const FName Name = NAME_None,
+		EDcSerializePredicateFlag Flag = EDcSerializePredicateFlag::None);
 
 	struct FPredicatedHandlerEntry
 	{
 		FDcSerializePredicate Predicate;
 		FDcSerializeDelegate Handler;
 		FName Name;
+		EDcSerializePredicateFlag Flag = EDcSerializePredicateFlag::None;
 	};
 	TArray<FPredicatedHandlerEntry> PredicatedSerializers;
 
 	TMap<UClass*, FDcSerializeDelegate> UClassSerializerMap;
 	TMap<FFieldClass*, FDcSerializeDelegate> FieldClassSerializerMap;
 	TMap<UStruct*, FDcSerializeDelegate> StructSerializerMap;
-};
 
+	///	Memoize handler resolution per property. Only `Pure` predicates and direct handlers are cached,
+	///	other predicates are still evaluated for every value.
+	bool bUseResolutionCache = false;
+
+	struct FResolutionKey
+	{
+		void* Property;
+		bool bScalarArrayItem;
+
+		FORCEINLINE friend bool operator==(const FResolutionKey& Lhs, const FResolutionKey& Rhs)
+		{
+			return Lhs.Property == Rhs.Property
+				&& Lhs.bScalarArrayItem == Rhs.bScalarArrayItem;
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash(const FResolutionKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Property), (uint32)Key.bScalarArrayItem);
+		}
+	};
+
+	struct FResolutionEntry
+	{
+		int32 PredicateIx;						//	INDEX_NONE for direct handlers
+		const FDcSerializeDelegate* DirectHandler;
+	};
+
+	struct FResolutionStats
+	{
+		int32 Hits = 0;
+		int32 Misses = 0;
+	};
+
+	TMap<FResolutionKey, FResolutionEntry> ResolutionCache;
+	FResolutionStats ResolutionStats;
+	//	handler counts when cache is built, cache is dropped when these change
+	int32 ResolutionHandlerNums[4] = {};
+
+	///	Called on adding handlers. Call this manually after reinstancing or replacing direct handlers.
+	void ResetResolutionCache();
+
+	///	Move handlers into an immutable snapshot, after which the instance can be shared by concurrent
+	///	`Serialize` calls without locking. Same rules as `FDcDeserializer::Freeze` apply.
+	void Freeze();
+	FORCEINLINE bool IsFrozen() const { return bFrozen; }
+
+	struct FFrozenHandlers
+	{
+		TArray<FPredicatedHandlerEntry> PredicatedSerializers;
+
+		TMap<UClass*, FDcSerializeDelegate> UClassSerializerMap;
+		TMap<FFieldClass*, FDcSerializeDelegate> FieldClassSerializerMap;
+		TMap<UStruct*, FDcSerializeDelegate> StructSerializerMap;
+
+		bool bUseResolutionCache;
+	};
+	TUniquePtr<const FFrozenHandlers> Frozen;
+
+	bool bFrozen = false;
+	//	tags per thread resolution caches of frozen instances, unique across instances and resets
+	FThreadSafeCounter ResolutionGeneration;
+};
 
@@ -24,3 +24,10 @@ DATACONFIGCORE_API void DcSetupMsgPackSerializeHandlers(FDcSerializer& Serialize
 
 DATACONFIGCORE_API void DcSetupCoreTypesSerializeHandlers(FDcSerializer& Serializer);
 
+///	Process wide frozen instances built by setups above on first use, which can be shared between threads.
+DATACONFIGCORE_API FDcSerializer& DcGetDefaultJsonSerializer(EDcJsonSerializeType Type = EDcJsonSerializeType::Default);
+
+DATACONFIGCORE_API FDcSerializer& DcGetDefaultPropertyPipeSerializer();
+
+DATACONFIGCORE_API FDcSerializer& DcGetDefaultMsgPackSerializer(EDcMsgPackSerializeType Type = EDcMsgPackSerializeType::Default);
+
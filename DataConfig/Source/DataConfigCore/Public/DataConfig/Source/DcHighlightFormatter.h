@@ -20,6 +20,8 @@ struct THightlightFormatter
 	FString FormatHighlight(SourceRef SpanRef, int Line = INDEX_NONE, FString* ReportFirstLine = nullptr);
 
 	static SourceRef FindLine(const SourceRef& SpanRef);
+	///	lines shown around `SpanRef`, copy these to format it later
+	static SourceRef FindContextWindow(const SourceRef& SpanRef);
 	static int FindLineNumber(const SourceRef& SpanRef);
 	static FString FormatDiagnosticLine(const FString& InLine);
 };
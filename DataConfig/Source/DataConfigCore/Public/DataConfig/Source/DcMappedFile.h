@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataConfig/DcTypes.h"
+#include "Async/MappedFileHandle.h"
+
+///	Read only memory mapped file, unmapped on `Close()` or destruction
+struct DATACONFIGCORE_API FDcMappedFile : private FNoncopyable
+{
+	~FDcMappedFile();
+
+	FDcResult Open(const TCHAR* Path);
+	void Close();
+
+	FORCEINLINE bool IsOpen() const { return Handle.IsValid(); }
+	FORCEINLINE const uint8* GetData() const { return Region.IsValid() ? Region->GetMappedPtr() : nullptr; }
+	FORCEINLINE int32 Num() const { return Region.IsValid() ? (int32)Region->GetMappedSize() : 0; }
+
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+};
+
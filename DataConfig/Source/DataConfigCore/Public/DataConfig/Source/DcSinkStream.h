@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+///	Push based byte sink that writers flush into in chunks
+struct DATACONFIGCORE_API FDcSinkStream
+{
+	virtual ~FDcSinkStream() = default;
+
+	///	write all `Num` bytes from `Src`, returns false on failure
+	virtual bool Write(const uint8* Src, int64 Num) = 0;
+
+	///	overwrite `Num` bytes starting `Distance` bytes before the current end, used to backpatch
+	///	headers that are already written out. Only called when `CanPatch()` is true.
+	virtual bool Patch(int64 Distance, const uint8* Src, int64 Num) { return false; }
+	virtual bool CanPatch() const { return false; }
+};
+
+struct DATACONFIGCORE_API FDcArchiveSinkStream : public FDcSinkStream
+{
+	///	pass `bInCanPatch` only when `Ar` supports `Tell()` and `Seek()`
+	FDcArchiveSinkStream(FArchive* InAr, bool bInCanPatch = false) : Ar(InAr), bCanPatch(bInCanPatch) {}
+
+	FArchive* Ar;
+	bool bCanPatch;
+
+	bool Write(const uint8* Src, int64 Num) override;
+	///	seeks back into `Ar`, fails if the seek doesn't land
+	bool Patch(int64 Distance, const uint8* Src, int64 Num) override;
+	bool CanPatch() const override { return Ar != nullptr && bCanPatch; }
+};
+
+struct DATACONFIGCORE_API FDcFileSinkStream : public FDcArchiveSinkStream
+{
+	FDcFileSinkStream(const TCHAR* Path);
+
+	TUniquePtr<FArchive> FileAr;
+
+	FORCEINLINE bool IsValid() const { return FileAr.IsValid(); }
+	///	flush and close the file, returns false if any write failed
+	bool Close();
+};
+
+struct DATACONFIGCORE_API FDcCallbackSinkStream : public FDcSinkStream
+{
+	using FWriteFunc = TFunction<bool(const uint8*, int64)>;
+
+	FDcCallbackSinkStream(FWriteFunc InWriteFunc) : WriteFunc(MoveTemp(InWriteFunc)) {}
+
+	FWriteFunc WriteFunc;
+
+	bool Write(const uint8* Src, int64 Num) override { return WriteFunc(Src, Num); }
+};
+
+///	In memory sink, output is appended to `Bytes` which can be taken without copying
+struct DATACONFIGCORE_API FDcArraySinkStream : public FDcSinkStream
+{
+	TArray<uint8> Bytes;
+
+	bool Write(const uint8* Src, int64 Num) override;
+	bool Patch(int64 Distance, const uint8* Src, int64 Num) override;
+	bool CanPatch() const override { return true; }
+
+	FORCEINLINE TArray<uint8> TakeBytes() { return MoveTemp(Bytes); }
+};
+
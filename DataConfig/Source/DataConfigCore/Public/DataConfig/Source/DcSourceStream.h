@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+///	Pull based byte source that readers refill from in chunks
+struct DATACONFIGCORE_API FDcSourceStream
+{
+	virtual ~FDcSourceStream() = default;
+
+	///	read up to `Num` bytes into `Dst`, returns bytes read and 0 at end of stream
+	virtual int64 Read(uint8* Dst, int64 Num) = 0;
+};
+
+struct DATACONFIGCORE_API FDcArchiveSourceStream : public FDcSourceStream
+{
+	FDcArchiveSourceStream(FArchive* InAr) : Ar(InAr) {}
+
+	FArchive* Ar;
+
+	int64 Read(uint8* Dst, int64 Num) override;
+};
+
+struct DATACONFIGCORE_API FDcFileSourceStream : public FDcArchiveSourceStream
+{
+	FDcFileSourceStream(const TCHAR* Path);
+
+	TUniquePtr<FArchive> FileAr;
+
+	FORCEINLINE bool IsValid() const { return FileAr.IsValid(); }
+};
+
+struct DATACONFIGCORE_API FDcCallbackSourceStream : public FDcSourceStream
+{
+	using FReadFunc = TFunction<int64(uint8*, int64)>;
+
+	FDcCallbackSourceStream(FReadFunc InReadFunc) : ReadFunc(MoveTemp(InReadFunc)) {}
+
+	FReadFunc ReadFunc;
+
+	int64 Read(uint8* Dst, int64 Num) override { return ReadFunc(Dst, Num); }
+};
+
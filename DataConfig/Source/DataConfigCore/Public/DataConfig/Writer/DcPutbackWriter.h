@@ -58,6 +58,7 @@ struct DATACONFIGCORE_API FDcPutbackWriter : public FDcWriter
 	FDcResult WriteDouble(const double& Value) override;
 
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
+	void SetContainerSizeHint(int32 Num) override;
 
 	void FormatDiagnostic(FDcDiagnostic& Diag) override;
 	void Putback(EDcDataEntry Entry) { Cached.Insert(Entry, 0); }
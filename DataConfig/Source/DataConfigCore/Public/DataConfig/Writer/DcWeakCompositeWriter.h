@@ -54,6 +54,7 @@ struct DATACONFIGCORE_API FDcWeakCompositeWriter : public FDcWriter
 	FDcResult WriteDouble(const double& Value) override;
 
 	FDcResult WriteBlob(const FDcBlobViewData& Value) override;
+	void SetContainerSizeHint(int32 Num) override;
 
 	TArray<FDcWriter*, TInlineAllocator<4>> Writers;
 
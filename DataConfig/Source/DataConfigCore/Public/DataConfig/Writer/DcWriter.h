@@ -92,11 +92,16 @@ struct DATACONFIGCORE_API FDcWriter
 
 	virtual FDcResult WriteBlob(const FDcBlobViewData& Value);
 
+	///	Element count hint for the container just opened by `Write{Array,Set,Map}Root`,
+	///	map counts key value pairs. Writers can use it to reserve storage upfront.
+	virtual void SetContainerSizeHint(int32 Num);
+
 	virtual void FormatDiagnostic(FDcDiagnostic& Diag);
 
 	FORCEINLINE friend FDcDiagnostic& operator<<(FDcDiagnostic& Diag, FDcWriter& Self)
 	{
-		Self.FormatDiagnostic(Diag);
+		if (!Diag.bMuted)
+			Self.FormatDiagnostic(Diag);
 		return Diag;
 	}
 
@@ -53,6 +53,17 @@ static FDcResult _TryUnwrapClassObject(UObject* InObj, UClass*& OutClass)
 	}
 }
 
+static FDcResult _TryLocateClassCached(FDcDeserializeContext& Ctx, const FDcStringViewData& TypeStr, UClass*& OutClass)
+{
+	return DcDeserializeUtils::TryLocateTypeCached(Ctx, TypeStr, OutClass,
+		[](FDcDeserializeContext&, const FString& Str, UClass*& OutClass)
+		{
+			UObject* Obj;
+			DC_TRY(DcSerDeUtils::TryStaticLocateObject(UObject::StaticClass(), Str, Obj));
+			return _TryUnwrapClassObject(Obj, OutClass);
+		});
+}
+
 static FString _GetAssetPathName(UObject* Value)
 {
 #if UE_VERSION_OLDER_THAN(4, 26, 0)
@@ -134,8 +145,8 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$type")));
 
-		FString LoadClassName;
-		DC_TRY(Ctx.Reader->ReadString(&LoadClassName));
+		FDcStringViewData LoadClassName;
+		DC_TRY(Ctx.Reader->ReadStringView(&LoadClassName));
 
 		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$path")));
@@ -145,9 +156,7 @@ static FDcResult TryReadObjectReferenceWithBP(FDcDeserializeContext& Ctx, FPrope
 		DC_TRY(Ctx.Reader->ReadMapEnd());
 
 		UClass* LoadClass;
-		UObject* Obj;
-		DC_TRY(DcSerDeUtils::TryStaticLocateObject(UObject::StaticClass(), LoadClassName, Obj));
-		DC_TRY(_TryUnwrapClassObject(Obj, LoadClass));
+		DC_TRY(_TryLocateClassCached(Ctx, LoadClassName, LoadClass));
 
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(LoadClass, PropertyClass));
 
@@ -228,15 +237,8 @@ static FDcResult TryReadClassReferenceWithBlueprint(FDcDeserializeContext& Ctx,
 		}
 		else
 		{
-
-			UObject* Loaded;
-			DC_TRY(DcSerDeUtils::TryStaticLocateObject(
-				UObject::StaticClass(),
-				Value,
-				Loaded));
-
 			UClass* Class;
-			DC_TRY(_TryUnwrapClassObject(Loaded, Class));
+			DC_TRY(_TryLocateClassCached(Ctx, FDcStringViewData::FromTchar(*Value, Value.Len()), Class));
 			OutObject = Class;
 			return DcOk();
 		}
@@ -255,8 +257,8 @@ static FDcResult TryReadClassReferenceWithBlueprint(FDcDeserializeContext& Ctx,
 		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$type")));
 
-		FString LoadClassName;
-		DC_TRY(Ctx.Reader->ReadString(&LoadClassName));
+		FDcStringViewData LoadClassName;
+		DC_TRY(Ctx.Reader->ReadStringView(&LoadClassName));
 
 		DC_TRY(Ctx.Reader->ReadString(&MetaKey));
 		DC_TRY(DcSerDeUtils::ExpectMetaKey(MetaKey, TEXT("$path")));
@@ -266,9 +268,7 @@ static FDcResult TryReadClassReferenceWithBlueprint(FDcDeserializeContext& Ctx,
 		DC_TRY(Ctx.Reader->ReadMapEnd());
 
 		UClass* LoadClass;
-		UObject* Obj;
-		DC_TRY(DcSerDeUtils::TryStaticLocateObject(UObject::StaticClass(), LoadClassName, Obj));
-		DC_TRY(_TryUnwrapClassObject(Obj, LoadClass));
+		DC_TRY(_TryLocateClassCached(Ctx, LoadClassName, LoadClass));
 
 		DC_TRY(DcSerDeUtils::ExpectLhsChildOfRhs(LoadClass, ObjectProperty->PropertyClass));
 
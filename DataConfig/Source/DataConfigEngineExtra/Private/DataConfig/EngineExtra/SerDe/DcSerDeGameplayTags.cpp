@@ -11,11 +11,40 @@
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
+#include "DataConfig/Extra/Misc/DcBench.h"
 #include "DataConfig/Json/DcJsonWriter.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
 
 namespace DcEngineExtra {
 
+const FGameplayTag* FDcGameplayTagCache::Find(const FDcStringViewData& Str) const
+{
+	for (auto It = Entries.CreateConstKeyIterator(FDcTypeResolveCache::HashStr(Str)); It; ++It)
+	{
+		const FEntry& Entry = It.Value();
+		if (Str.Equals(FStringView(Entry.Str)))
+			return &Entry.Tag;
+	}
+
+	return nullptr;
+}
+
+void FDcGameplayTagCache::Add(const FDcStringViewData& Str, const FGameplayTag& Tag)
+{
+	uint32 Hash = FDcTypeResolveCache::HashStr(Str);
+	for (auto It = Entries.CreateKeyIterator(Hash); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+		if (Str.Equals(FStringView(Entry.Str)))
+		{
+			Entry.Tag = Tag;
+			return;
+		}
+	}
+
+	Entries.Add(Hash, {Str.ToString(), Tag});
+}
+
 static FDcResult _StringToGameplayTag(FDcDeserializeContext& Ctx, const FString& Str, FGameplayTag* OutTagPtr)
 {
 	FString FixedString;
@@ -37,7 +66,29 @@ static FDcResult _StringToGameplayTag(FDcDeserializeContext& Ctx, const FString&
 	return DcOk();
 }
 
-FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
+static FDcResult _ReadGameplayTag(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache, FGameplayTag* OutTagPtr)
+{
+	FDcStringViewData View;
+	DC_TRY(Ctx.Reader->ReadStringView(&View));
+
+	if (Cache)
+	{
+		if (const FGameplayTag* Cached = Cache->Find(View))
+		{
+			*OutTagPtr = *Cached;
+			return DcOk();
+		}
+	}
+
+	DC_TRY(_StringToGameplayTag(Ctx, View.ToString(), OutTagPtr));
+
+	if (Cache)
+		Cache->Add(View, *OutTagPtr);
+
+	return DcOk();
+}
+
+FDcResult DcHandlerDeserializeGameplayTag(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache)
 {
 	EDcDataEntry Next;
 	DC_TRY(Ctx.Reader->PeekRead(&Next));
@@ -65,9 +116,7 @@ FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
 	}
 	else if (Next == EDcDataEntry::String)
 	{
-		FString Str;
-		DC_TRY(Ctx.Reader->ReadString(&Str));
-		DC_TRY(_StringToGameplayTag(Ctx, Str, TagPtr));
+		DC_TRY(_ReadGameplayTag(Ctx, Cache, TagPtr));
 
 		return DcOk();
 	}
@@ -78,7 +127,7 @@ FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
 	}
 }
 
-FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
+FDcResult DcHandlerDeserializeGameplayTagContainer(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache)
 {
 	EDcDataEntry Next;
 	DC_TRY(Ctx.Reader->PeekRead(&Next));
@@ -99,6 +148,8 @@ FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
 
 	DC_TRY(Ctx.Reader->ReadArrayRoot());
 
+	//	collect then build the container once, `AddTag` refills parent tags on every call
+	TArray<FGameplayTag> Tags;
 	EDcDataEntry CurPeek;
 	while (true)
 	{
@@ -106,20 +157,31 @@ FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
 		if (CurPeek == EDcDataEntry::ArrayEnd)
 			break;
 
-		FString Str;
-		DC_TRY(Ctx.Reader->ReadString(&Str));
-
 		FGameplayTag Tag;
-		DC_TRY(_StringToGameplayTag(Ctx, Str, &Tag));
-
-		ContainerPtr->AddTag(Tag);
+		DC_TRY(_ReadGameplayTag(Ctx, Cache, &Tag));
+		Tags.AddUnique(Tag);
 	}
 
 	DC_TRY(Ctx.Reader->ReadArrayEnd());
 
+	if (ContainerPtr->Num() == 0)
+		*ContainerPtr = FGameplayTagContainer::CreateFromArray(Tags);
+	else
+		ContainerPtr->AppendTags(FGameplayTagContainer::CreateFromArray(Tags));
+
 	return DcOk();
 }
 
+FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx)
+{
+	return DcHandlerDeserializeGameplayTag(Ctx, nullptr);
+}
+
+FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx)
+{
+	return DcHandlerDeserializeGameplayTagContainer(Ctx, nullptr);
+}
+
 FDcResult HandlerGameplayTagSerialize(FDcSerializeContext& Ctx)
 {
 	FDcPropertyDatum Datum;
@@ -286,5 +348,157 @@ DC_TEST("DataConfig.EngineExtra.GameplayTagContainer")
 	return true;
 }
 
+DC_TEST("DataConfig.EngineExtra.GameplayTagCache")
+{
+	using namespace DcEngineExtra;
+	FDcEngineExtraTestStructWithGameplayTag2 Dest;
+	FDcPropertyDatum DestDatum(&Dest);
 
+	FString Str = TEXT(R"(
+		{
+			"TagContainerField1" : [
+				"DataConfig.Foo.Bar",
+				"DataConfig.Foo.Bar"
+			],
+			"TagContainerField2" : [
+				"DataConfig.Foo.Bar",
+				"DataConfig.Foo.Bar.Baz",
+				"DataConfig.Tar.Taz"
+			]
+		}
+	)");
+
+	FDcGameplayTagCache Cache;
+	auto _Deserialize = [&]
+	{
+		FDcJsonReader Reader(Str);
+		return DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[&Cache](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FGameplayTagContainer>::Get(),
+				FDcDeserializeDelegate::CreateLambda([&Cache](FDcDeserializeContext& Ctx) {
+					return DcHandlerDeserializeGameplayTagContainer(Ctx, &Cache);
+				})
+			);
+		});
+	};
+
+	UTEST_OK("Editor Extra GameplayTag Cache", _Deserialize());
+	UTEST_EQUAL("Editor Extra GameplayTag Cache", Cache.Entries.Num(), 3);
+	UTEST_EQUAL("Editor Extra GameplayTag Cache", Dest.TagContainerField1.Num(), 1);
+	UTEST_EQUAL("Editor Extra GameplayTag Cache", Dest.TagContainerField2.Num(), 3);
+	UTEST_TRUE("Editor Extra GameplayTag Cache", Dest.TagContainerField2.HasTag(
+		UGameplayTagsManager::Get().RequestGameplayTag(TEXT("DataConfig.Foo"))
+	));
+
+	FDcGameplayTagCache::FEntry* Entry = nullptr;
+	for (auto& Pair : Cache.Entries)
+		if (Pair.Value.Str == TEXT("DataConfig.Tar.Taz"))
+			Entry = &Pair.Value;
+	UTEST_TRUE("Editor Extra GameplayTag Cache", Entry != nullptr);
+	UTEST_TRUE("Editor Extra GameplayTag Cache", Entry->Tag == UGameplayTagsManager::Get().RequestGameplayTag(TEXT("DataConfig.Tar.Taz")));
+
+	//	hits come from the cache, poison an entry to check it's not looked up again
+	Entry->Tag = UGameplayTagsManager::Get().RequestGameplayTag(TEXT("DataConfig.Foo.Bar"));
+	Dest = FDcEngineExtraTestStructWithGameplayTag2();
+	UTEST_OK("Editor Extra GameplayTag Cache", _Deserialize());
+	UTEST_EQUAL("Editor Extra GameplayTag Cache", Cache.Entries.Num(), 3);
+	UTEST_EQUAL("Editor Extra GameplayTag Cache", Dest.TagContainerField2.Num(), 2);
+
+	return true;
+}
+
+DC_TEST("DataConfigBenchmark.GameplayTags")
+{
+	using namespace DcEngineExtra;
+
+	//	synthetic effect dataset, tags repeat heavily as they do in ability/effect tables
+	const TCHAR* TagStrs[] = {
+		TEXT("DataConfig.Foo.Bar"),
+		TEXT("DataConfig.Foo.Bar.Baz"),
+		TEXT("DataConfig.Tar.Taz"),
+	};
+	constexpr int32 TagCount = UE_ARRAY_COUNT(TagStrs);
+	constexpr int32 EffectCount = 4000;
+
+	FString JsonStr;
+	JsonStr.Reserve(EffectCount * 256);
+	auto _WriteContainer = [&](int32 Seed)
+	{
+		JsonStr += TCHAR('[');
+		int32 Num = Seed % (TagCount + 1);
+		for (int32 TagIx = 0; TagIx < Num; TagIx++)
+		{
+			if (TagIx != 0)
+				JsonStr += TCHAR(',');
+			JsonStr.Appendf(TEXT("\"%s\""), TagStrs[(Seed + TagIx) % TagCount]);
+		}
+		JsonStr += TCHAR(']');
+	};
+
+	JsonStr += TEXT("{\"Effects\":[");
+	for (int32 Ix = 0; Ix < EffectCount; Ix++)
+	{
+		if (Ix != 0)
+			JsonStr += TCHAR(',');
+		JsonStr.Appendf(TEXT("{\"Name\":\"Effect%d\",\"AssetTag\":\"%s\","), Ix, TagStrs[Ix % TagCount]);
+		JsonStr += TEXT("\"GrantedTags\":");
+		_WriteContainer(Ix);
+		JsonStr += TEXT(",\"RequiredTags\":");
+		_WriteContainer(Ix / 3);
+		JsonStr += TEXT(",\"BlockedTags\":");
+		_WriteContainer(Ix / 7);
+		JsonStr += TCHAR('}');
+	}
+	JsonStr += TEXT("]}");
+
+	auto _LoadJson = [&JsonStr](FDcGameplayTagCache* Cache)
+	{
+		FDcEngineExtraBenchGameplayEffectRoot Data;
+		FDcJsonReader Reader(JsonStr);
+		FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+		[Cache](FDcDeserializeContext& Ctx) {
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FGameplayTag>::Get(),
+				FDcDeserializeDelegate::CreateLambda([Cache](FDcDeserializeContext& Ctx) {
+					return DcHandlerDeserializeGameplayTag(Ctx, Cache);
+				})
+			);
+			Ctx.Deserializer->AddStructHandler(
+				TBaseStructure<FGameplayTagContainer>::Get(),
+				FDcDeserializeDelegate::CreateLambda([Cache](FDcDeserializeContext& Ctx) {
+					return DcHandlerDeserializeGameplayTagContainer(Ctx, Cache);
+				})
+			);
+		});
+		return Result.Ok() && Data.Effects.Num() == EffectCount;
+	};
+
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			return _LoadJson(nullptr);
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("GameplayTags Json Deserialize"), JsonStr.Len(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcGameplayTagCache Cache;
+			return _LoadJson(&Cache);
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("GameplayTags Json Deserialize (Cached)"), JsonStr.Len(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
+	return true;
+}
 
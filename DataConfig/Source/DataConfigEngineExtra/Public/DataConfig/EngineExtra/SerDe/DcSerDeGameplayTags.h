@@ -9,6 +9,27 @@
 
 namespace DcEngineExtra {
 
+///	Tags resolved from strings as read, so repeated tags skip validation, `FName` creation and
+///	the tag manager lookup. Keep one around for a load and bind it to the handlers below. Not thread safe.
+struct DATACONFIGENGINEEXTRA_API FDcGameplayTagCache
+{
+	struct FEntry
+	{
+		FString Str;
+		FGameplayTag Tag;
+	};
+
+	TMultiMap<uint32, FEntry> Entries;
+
+	const FGameplayTag* Find(const FDcStringViewData& Str) const;
+	void Add(const FDcStringViewData& Str, const FGameplayTag& Tag);
+	FORCEINLINE void Reset() { Entries.Reset(); }
+};
+
+///	`Cache` is optional, containers are built in one go after all tags are read
+DATACONFIGENGINEEXTRA_API FDcResult DcHandlerDeserializeGameplayTag(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache);
+DATACONFIGENGINEEXTRA_API FDcResult DcHandlerDeserializeGameplayTagContainer(FDcDeserializeContext& Ctx, FDcGameplayTagCache* Cache);
+
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagDeserialize(FDcDeserializeContext& Ctx);
 DATACONFIGENGINEEXTRA_API FDcResult HandlerGameplayTagContainerDeserialize(FDcDeserializeContext& Ctx);
 
@@ -36,3 +57,23 @@ struct FDcEngineExtraTestStructWithGameplayTag2
 	UPROPERTY() FGameplayTagContainer TagContainerField1;
 	UPROPERTY() FGameplayTagContainer TagContainerField2;
 };
+
+USTRUCT()
+struct FDcEngineExtraBenchGameplayEffect
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FString Name;
+	UPROPERTY() FGameplayTag AssetTag;
+	UPROPERTY() FGameplayTagContainer GrantedTags;
+	UPROPERTY() FGameplayTagContainer RequiredTags;
+	UPROPERTY() FGameplayTagContainer BlockedTags;
+};
+
+USTRUCT()
+struct FDcEngineExtraBenchGameplayEffectRoot
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FDcEngineExtraBenchGameplayEffect> Effects;
+};
@@ -41,14 +41,10 @@ FDcResult DcHandlerDeserializeInstancedStruct(
 	else if (Next == EDcDataEntry::MapRoot)
 	{
 		DC_TRY(Ctx.Reader->ReadMapRoot());
-		FString Str;
-		DC_TRY(Ctx.Reader->ReadString(&Str));
-		if (Str != TEXT("$type"))
-			return DC_FAIL(DcDSerDe, ExpectMetaType);
-
-		DC_TRY(Ctx.Reader->ReadString(&Str));
+		FDcStringViewData TypeStr;
+		DC_TRY(DcDeserializeUtils::ReadMetaType(Ctx.Reader, &TypeStr));
 		UScriptStruct* LoadStruct = nullptr;
-		DC_TRY(FuncLocateStruct(Ctx, Str, LoadStruct));
+		DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, TypeStr, LoadStruct, FuncLocateStruct));
 		check(LoadStruct);
 
 		FField* StructField = Datum.Property.ToField();
@@ -59,7 +55,11 @@ FDcResult DcHandlerDeserializeInstancedStruct(
 		{
 			const FString& BaseStructStr = StructField->GetMetaData(TEXT("BaseStruct"));
 			UScriptStruct* BaseStruct;
-			DC_TRY(DcSerDeUtils::TryLocateObject<UScriptStruct>(BaseStructStr, BaseStruct));
+			DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, FDcStringViewData::FromTchar(*BaseStructStr, BaseStructStr.Len()), BaseStruct,
+				[](FDcDeserializeContext&, const FString& Str, UScriptStruct*& OutStruct)
+				{
+					return DcSerDeUtils::TryLocateObject<UScriptStruct>(Str, OutStruct);
+				}));
 
 			if (!LoadStruct->IsChildOf(BaseStruct))
 				return DC_FAIL(DcDSerDe, StructLhsIsNotChildOfRhs) << LoadStruct->GetFName() << BaseStructStr;
@@ -2,17 +2,22 @@
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
+#include "DataConfig/Deserialize/DcDeserializeBatch.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
 #include "DataConfig/Extra/Misc/DcBench.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Json/DcJsonScan.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
 #include "DataConfig/MsgPack/DcMsgPackReader.h"
 #include "DataConfig/MsgPack/DcMsgPackWriter.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
 #include "DataConfig/SerDe/DcSerDeUtils.inl"
 #include "Misc/FileHelper.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
 
 namespace DcBenchmarkDetails
 {
@@ -153,6 +158,129 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return false;
 	}
 
+	//	Ansi Json Deserialize, scalar and block scanners
+	{
+		FTCHARToUTF8 UTF8Json(*JsonStr);
+		EDcJsonScanImpl PrevImpl = DcJsonScan::GetImpl();
+		EDcJsonScanImpl Impls[] = { EDcJsonScanImpl::Scalar, DcJsonScan::GetNativeImpl() };
+		for (EDcJsonScanImpl Impl : Impls)
+		{
+			DcJsonScan::SetImpl(Impl);
+			FDcBenchStat Stat = DcBenchStats([&]
+			{
+				FDcCanadaRoot Data;
+				FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+				FDcResult Result = DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+				[](FDcDeserializeContext& Ctx) {
+					Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerCanadaCoordsDeserialize));
+					Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerVector2DDeserialize));
+				});
+				return Result.Ok();
+			});
+
+			FString Output = DcFormatBenchStats(
+				FString::Printf(TEXT("Canada Ansi Json Deserialize (%s)"), DcJsonScan::ImplToString(Impl)),
+				UTF8Json.Length(), Stat);
+			UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+			if (!Stat.bAllOk)
+			{
+				DcJsonScan::SetImpl(PrevImpl);
+				return false;
+			}
+		}
+		DcJsonScan::SetImpl(PrevImpl);
+	}
+
+	//	Json Load, including file reads. mapped reader skips the copy and UTF-8 widening
+	{
+		FString FixturePath = DcGetFixturePath(TEXT("LargeFixtures/canada.json"));
+		auto _DeserializeCanada = [](FDcReader& Reader)
+		{
+			FDcCanadaRoot Data;
+			return DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerCanadaCoordsDeserialize));
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerVector2DDeserialize));
+			});
+		};
+
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FString LoadedStr;
+			if (!FFileHelper::LoadFileToString(LoadedStr, *FixturePath))
+				return false;
+
+			FDcJsonReader Reader(LoadedStr);
+			return _DeserializeCanada(Reader).Ok();
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("Canada Json Load"), JsonStr.Len(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+
+		FDcBenchStat MappedStat = DcBenchStats([&]
+		{
+			FDcMappedJsonReader Reader;
+			if (!Reader.OpenFile(*FixturePath).Ok())
+				return false;
+
+			return _DeserializeCanada(Reader).Ok();
+		});
+
+		FString MappedOutput = DcFormatBenchStats(TEXT("Canada Mapped Json Load"), JsonStr.Len(), MappedStat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *MappedOutput);
+		if (!MappedStat.bAllOk)
+			return false;
+	}
+
+	//	Json Read Numbers, isolates number parsing from the deserializer
+	{
+		auto _ReadNumbers = [](FDcReader& Reader)
+		{
+			EDcDataEntry Next;
+			while (true)
+			{
+				DC_TRY(Reader.PeekRead(&Next));
+				if (Next == EDcDataEntry::Ended)
+					return DcOk();
+
+				if (Next == EDcDataEntry::Double)
+				{
+					double Value;
+					DC_TRY(Reader.ReadDouble(&Value));
+				}
+				else
+				{
+					DC_TRY(DcSerDeUtils::DispatchNoopRead(Next, &Reader));
+				}
+			}
+		};
+
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcJsonReader Reader(JsonStr);
+			return _ReadNumbers(Reader).Ok();
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("Canada Json Read Numbers"), JsonStr.Len(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+
+		FTCHARToUTF8 UTF8Json(*JsonStr);
+		FDcBenchStat AnsiStat = DcBenchStats([&]
+		{
+			FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+			return _ReadNumbers(Reader).Ok();
+		});
+
+		FString AnsiOutput = DcFormatBenchStats(TEXT("Canada Ansi Json Read Numbers"), UTF8Json.Length(), AnsiStat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *AnsiOutput);
+		if (!AnsiStat.bAllOk)
+			return false;
+	}
+
 	//	Json Serialize
 	{
 		FDcBenchStat Stat = DcBenchStats([&]
@@ -172,6 +300,28 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return false;
 	}
 
+	//	Json Serialize with shortest float formatting
+	{
+		FDcJsonWriter::ConfigType Config = FDcJsonWriter::DefaultConfig;
+		Config.bFastNumeric = true;
+
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcJsonWriter Writer(Config);
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, FDcPropertyDatum(&Root),
+			[](FDcSerializeContext& Ctx) {
+				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcSerializeDelegate::CreateStatic(HandlerCanadaCoordsSerialize));
+				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcSerializeDelegate::CreateStatic(HandlerVector2DSerialize));
+			});
+			return Result.Ok();
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("Canada Json Serialize Fast Numeric"), JsonStr.Len(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
 	//	MsgPack Deserialize
 	{
 		FDcBenchStat Stat = DcBenchStats([&]
@@ -215,6 +365,28 @@ DC_TEST("DataConfigBenchmark.Canada")
 			return false;
 	}
 
+	//	MsgPack Serialize with output size hint
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			FDcMsgPackWriter Writer(Buffer.Num());
+			FDcResult Result = DcAutomationUtils::SerializeInto(&Writer, FDcPropertyDatum(&Root),
+			[](FDcSerializeContext& Ctx) {
+				DcSetupMsgPackSerializeHandlers(*Ctx.Serializer, EDcMsgPackSerializeType::Default);
+
+				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcSerializeDelegate::CreateStatic(HandlerCanadaCoordsSerialize));
+				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcSerializeDelegate::CreateStatic(HandlerVector2DSerialize));
+
+			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
+			return Result.Ok();
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("Canada MsgPack Serialize Size Hint"), Buffer.Num(), Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
 	return true;
 }
 
@@ -386,17 +558,15 @@ DC_TEST("DataConfigBenchmark.Corpus")
 		[](FDcDeserializeContext& Ctx) {
 			Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCorpusRoot>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerIsCorpusRootDeserialize));
 
-			Ctx.Deserializer->PredicatedDeserializers.Insert(
-				FDcDeserializer::FPredicatedHandlerEntry{
-					FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
-					{
-						return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
-							? EDcDeserializePredicateResult::Process
-							: EDcDeserializePredicateResult::Pass;
-					}),
-					FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
-				},
-				0	// insert at 0, before usual numeric handlers
+			Ctx.Deserializer->InsertPredicatedHandler(
+				0,	// insert at 0, before usual numeric handlers
+				FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
+				{
+					return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+						? EDcDeserializePredicateResult::Process
+						: EDcDeserializePredicateResult::Pass;
+				}),
+				FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
 			);
 		});
 	};
@@ -451,17 +621,15 @@ DC_TEST("DataConfigBenchmark.Corpus")
 			[](FDcSerializeContext& Ctx) {
 				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcCorpusRoot>::Get(), FDcSerializeDelegate::CreateStatic(HandlerIsCorpusRootSerialize));
 
-				Ctx.Serializer->PredicatedSerializers.Insert(
-					FDcSerializer::FPredicatedHandlerEntry{
-						FDcSerializePredicate::CreateLambda([](FDcSerializeContext& Ctx)
-						{
-							return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
-								? EDcSerializePredicateResult::Process
-								: EDcSerializePredicateResult::Pass;
-						}),
-						FDcSerializeDelegate::CreateStatic(HandlerNullableSerialize)
-					},
-					0	// insert at 0, before usual numeric handlers
+				Ctx.Serializer->InsertPredicatedHandler(
+					0,	// insert at 0, before usual numeric handlers
+					FDcSerializePredicate::CreateLambda([](FDcSerializeContext& Ctx)
+					{
+						return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+							? EDcSerializePredicateResult::Process
+							: EDcSerializePredicateResult::Pass;
+					}),
+					FDcSerializeDelegate::CreateStatic(HandlerNullableSerialize)
 				);
 			});
 
@@ -485,17 +653,15 @@ DC_TEST("DataConfigBenchmark.Corpus")
 				DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer, EDcMsgPackDeserializeType::Default);
 				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCorpusRoot>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerIsCorpusRootDeserialize));
 
-				Ctx.Deserializer->PredicatedDeserializers.Insert(
-					FDcDeserializer::FPredicatedHandlerEntry{
-						FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
-						{
-							return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
-								? EDcDeserializePredicateResult::Process
-								: EDcDeserializePredicateResult::Pass;
-						}),
-						FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
-					},
-					0	// insert at 0, before usual numeric handlers
+				Ctx.Deserializer->InsertPredicatedHandler(
+					0,	// insert at 0, before usual numeric handlers
+					FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
+					{
+						return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+							? EDcDeserializePredicateResult::Process
+							: EDcDeserializePredicateResult::Pass;
+					}),
+					FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
 				);
 			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
 
@@ -519,17 +685,15 @@ DC_TEST("DataConfigBenchmark.Corpus")
 
 				Ctx.Serializer->AddStructHandler(TBaseStructure<FDcCorpusRoot>::Get(), FDcSerializeDelegate::CreateStatic(HandlerIsCorpusRootSerialize));
 
-				Ctx.Serializer->PredicatedSerializers.Insert(
-					FDcSerializer::FPredicatedHandlerEntry{
-						FDcSerializePredicate::CreateLambda([](FDcSerializeContext& Ctx)
-						{
-							return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
-								? EDcSerializePredicateResult::Process
-								: EDcSerializePredicateResult::Pass;
-						}),
-						FDcSerializeDelegate::CreateStatic(HandlerNullableSerialize)
-					},
-					0	// insert at 0, before usual numeric handlers
+				Ctx.Serializer->InsertPredicatedHandler(
+					0,	// insert at 0, before usual numeric handlers
+					FDcSerializePredicate::CreateLambda([](FDcSerializeContext& Ctx)
+					{
+						return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+							? EDcSerializePredicateResult::Process
+							: EDcSerializePredicateResult::Pass;
+					}),
+					FDcSerializeDelegate::CreateStatic(HandlerNullableSerialize)
 				);
 			}, DcAutomationUtils::EDefaultSetupType::SetupNothing);
 
@@ -545,4 +709,216 @@ DC_TEST("DataConfigBenchmark.Corpus")
 	return true;
 }
 
+DC_TEST("DataConfigBenchmark.Concurrent")
+{
+	using namespace DcBenchmarkDetails;
+	FString CanadaStr;
+	verify(FFileHelper::LoadFileToString(CanadaStr, *DcGetFixturePath(TEXT("LargeFixtures/canada.json"))));
+	FString CorpusStr;
+	verify(FFileHelper::LoadFileToString(CorpusStr, *DcGetFixturePath(TEXT("LargeFixtures/corpus.ndjson"))));
+
+	struct FCountDiagnosticConsumer : public IDcDiagnosticConsumer
+	{
+		void HandleDiagnostic(FDcDiagnostic& Diag) override { Count++; }
+		int32 Count = 0;
+	};
+
+	TSharedPtr<FCountDiagnosticConsumer> CountConsumer = MakeShareable(new FCountDiagnosticConsumer());
+	TSharedPtr<IDcDiagnosticConsumer> PrevConsumer = DcGetSharedDiagConsumer();
+	DcSetSharedDiagConsumer(CountConsumer);
+
+	auto _LoadBoth = [&CanadaStr, &CorpusStr]() -> FDcResult
+	{
+		{
+			FDcCanadaRoot Data;
+			FDcJsonReader Reader(CanadaStr);
+			DC_TRY(DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCanadaCoords>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerCanadaCoordsDeserialize));
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcVector2D>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerVector2DDeserialize));
+			}));
+		}
+
+		{
+			FDcCorpusRoot Data;
+			FDcJsonReader Reader(CorpusStr);
+			DC_TRY(DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Deserializer->AddStructHandler(TBaseStructure<FDcCorpusRoot>::Get(), FDcDeserializeDelegate::CreateStatic(HandlerIsCorpusRootDeserialize));
+
+				Ctx.Deserializer->InsertPredicatedHandler(
+					0,	// insert at 0, before usual numeric handlers
+					FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
+					{
+						return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+							? EDcDeserializePredicateResult::Process
+							: EDcDeserializePredicateResult::Pass;
+					}),
+					FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
+				);
+			}));
+		}
+
+		return DcOk();
+	};
+
+	auto _FailOne = []() -> bool
+	{
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+
+		FDcCanadaRoot Data;
+		FDcJsonReader Reader(TEXT(R"({ "type" : 123 })"));
+		bool bFailed = !DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Data)).Ok();
+
+		//	worker root envs flush into the shared consumer
+		DcEnv().FlushDiags();
+		return bFailed;
+	};
+
+	constexpr int32 ThreadCount = 4;
+	TArray<TFuture<bool>> Futures;
+	for (int32 Ix = 0; Ix < ThreadCount; Ix++)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread, [&]
+		{
+			bool bOk = _LoadBoth().Ok();
+			DcEnv().FlushDiags();
+			bOk = bOk && _FailOne();
+
+			DcFlushThreadEnv();
+			return bOk;
+		}));
+	}
+
+	bool bAllOk = true;
+	for (TFuture<bool>& Future : Futures)
+		bAllOk &= Future.Get();
+
+	DcSetSharedDiagConsumer(PrevConsumer);
+
+	UTEST_TRUE("Concurrent Benchmark", bAllOk);
+	UTEST_EQUAL("Concurrent Benchmark", CountConsumer->Count, ThreadCount);
+
+	const int64 BytesCount = CanadaStr.Len() + CorpusStr.Len();
+
+	//	single thread baseline
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			return _LoadBoth().Ok();
+		});
+
+		FString Output = DcFormatBenchStats(TEXT("Concurrent Baseline Json Deserialize"), BytesCount, Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
+	//	workers load in parallel, bandwidth is the total across all workers
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			TArray<TFuture<bool>> LoadFutures;
+			for (int32 Ix = 0; Ix < ThreadCount; Ix++)
+			{
+				LoadFutures.Add(Async(EAsyncExecution::Thread, [&]
+				{
+					bool bOk = _LoadBoth().Ok();
+					DcFlushThreadEnv();
+					return bOk;
+				}));
+			}
+
+			bool bOk = true;
+			for (TFuture<bool>& Future : LoadFutures)
+				bOk &= Future.Get();
+			return bOk;
+		});
+
+		FString Output = DcFormatBenchStats(
+			FString::Printf(TEXT("Concurrent x%d Json Deserialize"), ThreadCount),
+			BytesCount * ThreadCount,
+			Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+	}
+
+	return true;
+}
+
+
+DC_TEST("DataConfigBenchmark.BatchLoad")
+{
+	using namespace DcBenchmarkDetails;
+	FString JsonStr;
+	verify(FFileHelper::LoadFileToString(JsonStr, *DcGetFixturePath(TEXT("LargeFixtures/corpus.ndjson"))));
+
+	//	each ndjson line is loaded as a separate document
+	TArray<FString> Lines;
+	JsonStr.ParseIntoArrayLines(Lines);
+
+	TArray<TArray<uint8>> Bufs;
+	int64 TotalBytes = 0;
+	for (const FString& Line : Lines)
+	{
+		FTCHARToUTF8 UTF8(*Line);
+		Bufs.Emplace((const uint8*)UTF8.Get(), UTF8.Length());
+		TotalBytes += UTF8.Length();
+	}
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+	Deserializer.InsertPredicatedHandler(
+		0,	// insert at 0, before usual numeric handlers
+		FDcDeserializePredicate::CreateLambda([](FDcDeserializeContext& Ctx)
+		{
+			return DcBenchmarkDetails::IsCorpusNullableField(Ctx)
+				? EDcDeserializePredicateResult::Process
+				: EDcDeserializePredicateResult::Pass;
+		}),
+		FDcDeserializeDelegate::CreateStatic(HandlerNullableDeserialize)
+	);
+	Deserializer.Freeze();
+
+	auto _BatchLoad = [&](int32 NumWorkers) -> bool
+	{
+		TArray<FDcCorpusEntry> Entries;
+		Entries.SetNum(Bufs.Num());
+
+		TArray<FDcBatchLoadJob> Jobs;
+		Jobs.SetNum(Bufs.Num());
+		for (int32 Ix = 0; Ix < Bufs.Num(); Ix++)
+		{
+			Jobs[Ix].Buffer = Bufs[Ix];
+			Jobs[Ix].Target = FDcPropertyDatum(&Entries[Ix]);
+		}
+
+		FDcBatchLoadConfig Config;
+		Config.JsonDeserializer = &Deserializer;
+		Config.NumWorkers = NumWorkers;
+		return DcBatchLoad(Jobs, Config).AllOk();
+	};
+
+	UTEST_TRUE("BatchLoad Benchmark", _BatchLoad(1));
+
+	int32 MaxWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	for (int32 NumWorkers = 1; ; NumWorkers = FMath::Min(NumWorkers * 2, MaxWorkers))
+	{
+		FDcBenchStat Stat = DcBenchStats([&]
+		{
+			return _BatchLoad(NumWorkers);
+		});
+
+		FString Output = DcFormatBenchStats(FString::Printf(TEXT("BatchLoad Corpus Json x%d"), NumWorkers), TotalBytes, Stat);
+		UE_LOG(LogDataConfigCore, Display, TEXT("%s"), *Output);
+		if (!Stat.bAllOk)
+			return false;
+
+		if (NumWorkers == MaxWorkers)
+			break;
+	}
+
+	return true;
+}
 
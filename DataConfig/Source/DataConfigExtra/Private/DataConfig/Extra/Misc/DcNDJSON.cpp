@@ -22,80 +22,112 @@ namespace DcExtra
 namespace NDJSONDetails
 {
 
-static TOptional<FDcDeserializer> Deserializer;
-static void LazyInitializeDeserializer()
+static FDcDeserializer& GetDeserializer()
 {
-	if (Deserializer.IsSet())
-		return;
-
-	Deserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(Deserializer.GetValue());
-
-	Deserializer->AddPredicatedHandler(
-		FDcDeserializePredicate::CreateStatic(DcDeserializeUtils::PredicateIsRootProperty),
-		FDcDeserializeDelegate::CreateLambda([](FDcDeserializeContext& Ctx) -> FDcResult
-		{
-			if (!Ctx.TopProperty().IsA<FArrayProperty>())
-				return DC_FAIL(DcDReadWrite, PropertyMismatch)
-					<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
-
-			DC_TRY(Ctx.Writer->WriteArrayRoot());
-			EDcDataEntry CurPeek;
-			while (true)
+	static TUniquePtr<FDcDeserializer> _DESERIALIZER = []
+	{
+		TUniquePtr<FDcDeserializer> Deserializer = MakeUnique<FDcDeserializer>();
+		DcSetupJsonDeserializeHandlers(*Deserializer);
+
+		Deserializer->AddPredicatedHandler(
+			FDcDeserializePredicate::CreateStatic(DcDeserializeUtils::PredicateIsRootProperty),
+			FDcDeserializeDelegate::CreateLambda([](FDcDeserializeContext& Ctx) -> FDcResult
 			{
-				DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
-				//  read until EOF as we're processing ndjson
-				if (CurPeek == EDcDataEntry::Ended)
-					break;
-
-				DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
-			}
-
-			DC_TRY(Ctx.Writer->WriteArrayEnd());
-			return DcOk();
-		})
-	);
+				if (!Ctx.TopProperty().IsA<FArrayProperty>())
+					return DC_FAIL(DcDReadWrite, PropertyMismatch)
+						<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
+
+				DC_TRY(Ctx.Writer->WriteArrayRoot());
+				EDcDataEntry CurPeek;
+				while (true)
+				{
+					DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
+					//  read until EOF as we're processing ndjson
+					if (CurPeek == EDcDataEntry::Ended)
+						break;
+
+					DC_TRY(DcDeserializeUtils::RecursiveDeserialize(Ctx));
+				}
+
+				DC_TRY(Ctx.Writer->WriteArrayEnd());
+				return DcOk();
+			})
+		);
+
+		Deserializer->Freeze();
+		return Deserializer;
+	}();
+
+	return *_DESERIALIZER;
 }
 
 
-static TOptional<FDcSerializer> Serializer;
-static void LazyInitializeSerializer()
+static FDcSerializer& GetSerializer()
 {
-	if (Serializer.IsSet())
-		return;
+	static TUniquePtr<FDcSerializer> _SERIALIZER = []
+	{
+		TUniquePtr<FDcSerializer> Serializer = MakeUnique<FDcSerializer>();
+		DcSetupJsonSerializeHandlers(*Serializer);
 
-	Serializer.Emplace();
-	DcSetupJsonSerializeHandlers(Serializer.GetValue());
+		Serializer->AddPredicatedHandler(
+			FDcSerializePredicate::CreateStatic(DcSerializeUtils::PredicateIsRootProperty),
+			FDcSerializeDelegate::CreateLambda([](FDcSerializeContext& Ctx) -> FDcResult{
+				if (!Ctx.TopProperty().IsA<FArrayProperty>())
+					return DC_FAIL(DcDReadWrite, PropertyMismatch)
+						<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
 
-	Serializer->AddPredicatedHandler(
-		FDcSerializePredicate::CreateStatic(DcSerializeUtils::PredicateIsRootProperty),
-		FDcSerializeDelegate::CreateLambda([](FDcSerializeContext& Ctx) -> FDcResult{
-			if (!Ctx.TopProperty().IsA<FArrayProperty>())
-				return DC_FAIL(DcDReadWrite, PropertyMismatch)
-					<< TEXT("Array") << Ctx.TopProperty().GetFName() << Ctx.TopProperty().GetClassName();
+				FDcJsonWriter* JsonWriter = Ctx.Writer->CastByIdChecked<FDcJsonWriter>();
 
-			FDcJsonWriter* JsonWriter = Ctx.Writer->CastByIdChecked<FDcJsonWriter>();
+				DC_TRY(Ctx.Reader->ReadArrayRoot());
 
-			DC_TRY(Ctx.Reader->ReadArrayRoot());
+				EDcDataEntry CurPeek;
+				while (true)
+				{
+					DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
+					if (CurPeek == EDcDataEntry::ArrayEnd)
+						break;
 
-			EDcDataEntry CurPeek;
-			while (true)
-			{
-				DC_TRY(Ctx.Reader->PeekRead(&CurPeek));
-				if (CurPeek == EDcDataEntry::ArrayEnd)
-					break;
+					DC_TRY(DcSerializeUtils::RecursiveSerialize(Ctx));
+
+					JsonWriter->CancelWriteComma();
+					JsonWriter->Sb << TCHAR('\n');
+				}
+
+				DC_TRY(Ctx.Reader->ReadArrayEnd());
 
-				DC_TRY(DcSerializeUtils::RecursiveSerialize(Ctx));
+				return DcOk();
+			})
+		);
 
-				JsonWriter->CancelWriteComma();
-				JsonWriter->Sb << TCHAR('\n');
-			}
+		Serializer->Freeze();
+		return Serializer;
+	}();
+
+	return *_SERIALIZER;
+}
 
-			DC_TRY(Ctx.Reader->ReadArrayEnd());
+static FDcJsonWriter::ConfigType GetWriterConfig()
+{
+	FDcJsonWriter::ConfigType Config = FDcJsonWriter::DefaultConfig;
+	Config.IndentLiteral = TEXT("");
+	Config.LineEndLiteral = TEXT(" ");
+	return Config;
+}
+
+static FDcResult Save(FDcPropertyDatum Datum, FDcJsonWriter& Writer)
+{
+	FDcPropertyReader Reader(Datum);
+
+	FDcSerializer& Serializer = GetSerializer();
+
+	FDcSerializeContext Ctx;
+	Ctx.Reader = &Reader;
+	Ctx.Writer = &Writer;
+	Ctx.Serializer = &Serializer;
+	DC_TRY(Ctx.Prepare());
+	DC_TRY(Serializer.Serialize(Ctx));
 
-			return DcOk();
-		})
-	);
+	return DcOk();
 }
 
 } // namespace NDJSONDetails
@@ -107,15 +139,15 @@ FDcResult LoadNDJSON(const TCHAR* Str, FDcPropertyDatum Datum)
 	FDcJsonReader Reader(Str);
 	FDcPropertyWriter Writer(Datum);
 
-	LazyInitializeDeserializer();
+	FDcDeserializer& Deserializer = GetDeserializer();
 
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &Deserializer.GetValue();
+	Ctx.Deserializer = &Deserializer;
 	Ctx.Properties.Add(Datum.Property);
 	DC_TRY(Ctx.Prepare());
-	DC_TRY(Deserializer->Deserialize(Ctx));
+	DC_TRY(Deserializer.Deserialize(Ctx));
 
 	return DcOk();
 }
@@ -123,28 +155,22 @@ FDcResult LoadNDJSON(const TCHAR* Str, FDcPropertyDatum Datum)
 
 FDcResult SaveNDJSON(FDcPropertyDatum Datum, FString& OutStr)
 {
-	using namespace NDJSONDetails;
-
-	FDcJsonWriter::ConfigType Config = FDcJsonWriter::DefaultConfig;
-	Config.IndentLiteral = TEXT("");
-	Config.LineEndLiteral = TEXT(" ");
-
-	FDcJsonWriter Writer(Config);
-	FDcPropertyReader Reader(Datum);
-
-	LazyInitializeSerializer();
-
-	FDcSerializeContext Ctx;
-	Ctx.Reader = &Reader;
-	Ctx.Writer = &Writer;
-	Ctx.Serializer = &Serializer.GetValue();
-	DC_TRY(Ctx.Prepare());
-	DC_TRY(Serializer->Serialize(Ctx));
+	FDcJsonWriter Writer(NDJSONDetails::GetWriterConfig());
+	DC_TRY(NDJSONDetails::Save(Datum, Writer));
 
 	OutStr = Writer.Sb.ToString();
 	return DcOk();
 }
 
+FDcResult SaveNDJSON(FDcPropertyDatum Datum, FDcSinkStream* Sink)
+{
+	FDcJsonWriter Writer(NDJSONDetails::GetWriterConfig());
+	DC_TRY(Writer.SetSink(Sink));
+	DC_TRY(NDJSONDetails::Save(Datum, Writer));
+
+	return Writer.FlushSink();
+}
+
 } // namespace DcExtra
 
 DC_TEST("DataConfig.Extra.SerDe.NDJSON")
@@ -168,5 +194,11 @@ DC_TEST("DataConfig.Extra.SerDe.NDJSON")
 	UTEST_OK("Extra NDJSON", SaveNDJSON(Dest, SavedStr));
 
 	UTEST_EQUAL("Extra NDJSON", SavedStr, DcAutomationUtils::DcReindentStringLiteral(Str));
+
+	FDcArraySinkStream Sink;
+	UTEST_OK("Extra NDJSON", SaveNDJSON(Dest, &Sink));
+	FTCHARToUTF8 SavedUTF8(*SavedStr, SavedStr.Len());
+	UTEST_EQUAL("Extra NDJSON", Sink.Bytes.Num(), SavedUTF8.Length());
+	UTEST_TRUE("Extra NDJSON", FPlatformMemory::Memcmp(Sink.Bytes.GetData(), SavedUTF8.Get(), SavedUTF8.Length()) == 0);
 	return true;
 };
@@ -16,23 +16,27 @@ namespace DcExtra
 namespace SqliteDetails
 {
 
-static TOptional<FDcDeserializer> Deserializer;
-static void LazyInitializeDeserializer()
+static FDcDeserializer& GetDeserializer()
 {
-	if (Deserializer.IsSet())
-		return;
+	static TUniquePtr<FDcDeserializer> _DESERIALIZER = []
+	{
+		TUniquePtr<FDcDeserializer> Deserializer = MakeUnique<FDcDeserializer>();
+
+		using namespace DcCommonHandlers;
+		AddNumericPipeDirectHandlers(*Deserializer);
 
-	Deserializer.Emplace();
+		Deserializer->AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeNameDeserialize));
+		Deserializer->AddDirectHandler(FStrProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeStringDeserialize));
+		Deserializer->AddDirectHandler(FTextProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeTextDeserialize));
 
-	using namespace DcCommonHandlers;
-	AddNumericPipeDirectHandlers(*Deserializer);
+		Deserializer->AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
+		Deserializer->AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
 
-	Deserializer->AddDirectHandler(FNameProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeNameDeserialize));
-	Deserializer->AddDirectHandler(FStrProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeStringDeserialize));
-	Deserializer->AddDirectHandler(FTextProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerPipeTextDeserialize));
+		Deserializer->Freeze();
+		return Deserializer;
+	}();
 
-	Deserializer->AddDirectHandler(FArrayProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerArrayDeserialize));
-	Deserializer->AddDirectHandler(FStructProperty::StaticClass(), FDcDeserializeDelegate::CreateStatic(HandlerMapToStructDeserialize));
+	return *_DESERIALIZER;
 }
 
 static EDcDataEntry SqliteColumnTypeToDataEntry(ESQLiteColumnType ColType)
@@ -291,7 +295,7 @@ FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, FDc
 		return DC_FAIL(DcDExtra, SqliteLastError)
 			<< Db->GetLastError();
 
-	LazyInitializeDeserializer();
+	FDcDeserializer& Deserializer = GetDeserializer();
 
 	FSqliteReader Reader(Db, &Stmt);
 	FDcPropertyWriter Writer(Datum);
@@ -299,10 +303,10 @@ FDcResult LoadStructArrayFromSQLite(FSQLiteDatabase* Db, const TCHAR* Query, FDc
 	FDcDeserializeContext Ctx;
 	Ctx.Reader = &Reader;
 	Ctx.Writer = &Writer;
-	Ctx.Deserializer = &Deserializer.GetValue();
+	Ctx.Deserializer = &Deserializer;
 	Ctx.Properties.Add(Datum.Property);
 	DC_TRY(Ctx.Prepare());
-	DC_TRY(Deserializer->Deserialize(Ctx));
+	DC_TRY(Deserializer.Deserialize(Ctx));
 
 	return DcOk();
 }
@@ -10,6 +10,7 @@
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Extra/Types/DcAnyStruct.h"
 #include "DataConfig/Reader/DcPutbackReader.h"
+#include "DataConfig/Reader/DcTapeReader.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Deserialize/DcDeserializeUtils.h"
@@ -46,14 +47,10 @@ FDcResult DcHandlerDeserializeAnyStruct(
 	else if (Next == EDcDataEntry::MapRoot)
 	{
 		DC_TRY(Ctx.Reader->ReadMapRoot());
-		FString Str;
-		DC_TRY(Ctx.Reader->ReadString(&Str));
-		if (Str != TEXT("$type"))
-			return DC_FAIL(DcDSerDe, ExpectMetaType);
-
-		DC_TRY(Ctx.Reader->ReadString(&Str));
+		FDcStringViewData TypeStr;
+		DC_TRY(DcDeserializeUtils::ReadMetaType(Ctx.Reader, &TypeStr));
 		UScriptStruct* LoadStruct = nullptr;
-		DC_TRY(FuncLocateStruct(Ctx, Str, LoadStruct));
+		DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, TypeStr, LoadStruct, FuncLocateStruct));
 		check(LoadStruct);
 
 		void* DataPtr = (uint8*)FMemory::Malloc(LoadStruct->GetStructureSize());
@@ -255,6 +252,44 @@ DC_TEST("DataConfig.Extra.SerDe.AnyStruct")
 		UTEST_EQUAL("Extra FAnyStruct SerDe", Writer.Sb.ToString(), DcAutomationUtils::DcReindentStringLiteral(Str));
 	}
 
+	{
+		//	tape reader finds `$type` anywhere in the object
+		FDcJsonReader JsonReader(TEXT(R"(
+			{
+				"AnyStructField1" : {
+					"NameField" : "Bar",
+					"$type" : "DcExtraTestSimpleStruct1"
+				}
+			}
+		)"));
+
+		FDcTape Tape;
+		UTEST_OK("Extra FAnyStruct SerDe", Tape.Build(&JsonReader));
+
+		FDcTapeReader Reader(&Tape);
+		auto _DeserializeTape = [&Reader](FDcExtraTestWithAnyStruct1& TapeDest)
+		{
+			return DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&TapeDest),
+			[](FDcDeserializeContext& Ctx) {
+				Ctx.Deserializer->AddStructHandler(
+					TBaseStructure<FDcAnyStruct>::Get(),
+					FDcDeserializeDelegate::CreateStatic(HandlerDcAnyStructDeserialize)
+				);
+			});
+		};
+
+		FDcExtraTestWithAnyStruct1 TapeDest;
+		UTEST_OK("Extra FAnyStruct SerDe", _DeserializeTape(TapeDest));
+		UTEST_TRUE("Extra FAnyStruct SerDe", TapeDest.AnyStructField1.GetChecked<FDcExtraTestSimpleStruct1>()->NameField == TEXT("Bar"));
+		UTEST_EQUAL("Extra FAnyStruct SerDe", Reader.IgnoredKeys.Num(), 0);
+
+		//	parse once, deserialize again from the start
+		Reader.Rewind(0);
+		FDcExtraTestWithAnyStruct1 TapeDest2;
+		UTEST_OK("Extra FAnyStruct SerDe", _DeserializeTape(TapeDest2));
+		UTEST_TRUE("Extra FAnyStruct SerDe", TapeDest2.AnyStructField1.GetChecked<FDcExtraTestSimpleStruct1>()->NameField == TEXT("Bar"));
+	}
+
 	return true;
 }
 #endif // WITH_EDITORONLY_DATA
@@ -41,14 +41,10 @@ FDcResult TDcInlineStructDeserialize<TInlineStruct>::DcHandlerDeserializeInlineS
 	if (Next == EDcDataEntry::MapRoot)
 	{
 		DC_TRY(Ctx.Reader->ReadMapRoot());
-		FString Str;
-		DC_TRY(Ctx.Reader->ReadString(&Str));
-		if (Str != TEXT("$type"))
-			return DC_FAIL(DcDSerDe, ExpectMetaType);
-
-		DC_TRY(Ctx.Reader->ReadString(&Str));
+		FDcStringViewData TypeStr;
+		DC_TRY(DcDeserializeUtils::ReadMetaType(Ctx.Reader, &TypeStr));
 		UScriptStruct* LoadStruct = nullptr;
-		DC_TRY(FuncLocateStruct(Ctx, Str, LoadStruct));
+		DC_TRY(DcDeserializeUtils::TryLocateTypeCached(Ctx, TypeStr, LoadStruct, FuncLocateStruct));
 		check(LoadStruct);
 
 		if (LoadStruct->GetStructureSize() > TInlineStruct::_CLASS_OFFSET)
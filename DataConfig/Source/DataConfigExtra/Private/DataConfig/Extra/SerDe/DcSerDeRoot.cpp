@@ -56,6 +56,8 @@ FDcResult HandlerRootObjectSerialize(FDcSerializeContext& Ctx)
 {
 	FDcJsonWriter* JsonWriter = Ctx.Writer->CastByIdChecked<FDcJsonWriter>();
 	JsonWriter->States.Push(FDcJsonWriter::EWriteState::Object);
+	JsonWriter->Keys.AddDefaulted();
+	JsonWriter->KeyCharsMarks.Add(JsonWriter->KeyChars.Num());
 	JsonWriter->State.bTopContainerNotEmpty = false;
 	JsonWriter->State.bNeedNewlineAndIndent = false;
 	JsonWriter->State.bTopObjectAtValue = false;
@@ -90,6 +92,8 @@ FDcResult HandlerRootObjectSerialize(FDcSerializeContext& Ctx)
 	if (Popped != FDcJsonWriter::EWriteState::Object
 		|| JsonWriter->State.bTopObjectAtValue)
 		return DC_FAIL(DcDJSON, UnexpectedObjectEnd);
+	JsonWriter->Keys.Pop();
+	JsonWriter->KeyChars.SetNum(JsonWriter->KeyCharsMarks.Pop());
 
 	return DcOk();
 }
@@ -92,31 +92,23 @@ static FDcResult HandlerClassRootSerializeCamelCase(FDcSerializeContext& Ctx)
 	return DcOk();
 }
 
-static TOptional<FDcDeserializer> Deserializer;
-static TOptional<FDcSerializer> Serializer;
-
-static void LazyInitializeSerializer()
+static FDcSerializer& GetSerializer()
 {
-	if (Serializer.IsSet())
-		return;
-
-	Serializer.Emplace();
-	DcSetupJsonSerializeHandlers(Serializer.GetValue());
-
-	//	handle camelCase member names
-	Serializer->UClassSerializerMap[UScriptStruct::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
-	Serializer->UClassSerializerMap[UClass::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerClassRootSerializeCamelCase);
-	Serializer->FieldClassSerializerMap[FStructProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
-}
+	static TUniquePtr<FDcSerializer> _SERIALIZER = []
+	{
+		TUniquePtr<FDcSerializer> Ret = MakeUnique<FDcSerializer>();
+		DcSetupJsonSerializeHandlers(*Ret);
 
+		//	handle camelCase member names
+		Ret->UClassSerializerMap[UScriptStruct::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
+		Ret->UClassSerializerMap[UClass::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerClassRootSerializeCamelCase);
+		Ret->FieldClassSerializerMap[FStructProperty::StaticClass()] = FDcSerializeDelegate::CreateStatic(HandlerStructRootSerializeCamelCase);
 
-static void LazyInitializeDeserializer()
-{
-	if (Deserializer.IsSet())
-		return;
+		Ret->Freeze();
+		return Ret;
+	}();
 
-	Deserializer.Emplace();
-	DcSetupJsonDeserializeHandlers(Deserializer.GetValue());
+	return *_SERIALIZER;
 }
 
 } // namespace JsonConverterDetails
@@ -125,18 +117,16 @@ static void LazyInitializeDeserializer()
 bool JsonObjectReaderToUStruct(FDcReader* Reader, FDcPropertyDatum Datum)
 {
 	FDcResult Ret = [&]() -> FDcResult {
-		using namespace JsonConverterDetails;
-		LazyInitializeDeserializer();
-
+		FDcDeserializer& Deserializer = DcGetDefaultJsonDeserializer();
 		FDcPropertyWriter Writer(Datum);
 
 		FDcDeserializeContext Ctx;
 		Ctx.Reader = Reader;
 		Ctx.Writer = &Writer;
-		Ctx.Deserializer = &Deserializer.GetValue();
+		Ctx.Deserializer = &Deserializer;
 		DC_TRY(Ctx.Prepare());
 
-		DC_TRY(Deserializer->Deserialize(Ctx));
+		DC_TRY(Deserializer.Deserialize(Ctx));
 		return DcOk();
 	}();
 
@@ -155,18 +145,16 @@ bool UStructToJsonObjectString(FDcPropertyDatum Datum, FDcWriter* Writer)
 {
 	FDcResult Ret = [&]() -> FDcResult
 	{
-		using namespace JsonConverterDetails;
-		LazyInitializeSerializer();
-
+		FDcSerializer& Serializer = JsonConverterDetails::GetSerializer();
 		FDcPropertyReader Reader(Datum);
 
 		FDcSerializeContext Ctx;
 		Ctx.Reader = &Reader;
 		Ctx.Writer = Writer;
-		Ctx.Serializer = &Serializer.GetValue();
+		Ctx.Serializer = &Serializer;
 		DC_TRY(Ctx.Prepare());
 
-		DC_TRY(Serializer->Serialize(Ctx));
+		DC_TRY(Serializer.Serialize(Ctx));
 		return DcOk();
 	}();
 
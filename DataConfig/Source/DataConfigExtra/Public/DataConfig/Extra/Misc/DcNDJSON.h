@@ -4,6 +4,7 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Property/DcPropertyDatum.h"
 #include "DataConfig/Property/DcPropertyUtils.h"
+#include "DataConfig/Source/DcSinkStream.h"
 
 namespace DcExtra
 {
@@ -22,6 +23,8 @@ DATACONFIGEXTRA_API FDcResult LoadNDJSON(const TCHAR* Str, TArray<TStruct>& Arr)
 }
 
 DATACONFIGEXTRA_API FDcResult SaveNDJSON(FDcPropertyDatum Datum, FString& OutStr);
+///	write lines to `Sink` as they're serialized instead of building the whole string
+DATACONFIGEXTRA_API FDcResult SaveNDJSON(FDcPropertyDatum Datum, FDcSinkStream* Sink);
 
 template<typename TStruct>
 DATACONFIGEXTRA_API FDcResult SaveNDJSON(const TArray<TStruct>& Arr, FString& OutStr)
@@ -34,5 +37,16 @@ DATACONFIGEXTRA_API FDcResult SaveNDJSON(const TArray<TStruct>& Arr, FString& Ou
 	return SaveNDJSON(FDcPropertyDatum(ArrProp.Get(), (void*)&Arr), OutStr);
 }
 
+template<typename TStruct>
+DATACONFIGEXTRA_API FDcResult SaveNDJSON(const TArray<TStruct>& Arr, FDcSinkStream* Sink)
+{
+	using namespace DcPropertyUtils;
+	auto ArrProp = FDcPropertyBuilder::Array(
+		FDcPropertyBuilder::Struct(TBaseStructure<TStruct>::Get())
+	).LinkOnScope();
+
+	return SaveNDJSON(FDcPropertyDatum(ArrProp.Get(), (void*)&Arr), Sink);
+}
+
 } // namespace DcExtra
 
@@ -3,7 +3,17 @@
 #include "DcTestProperty5.h"
 #include "DcTestSerDe.h"
 #include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/MsgPack/DcMsgPackWriter.h"
+#include "DataConfig/Property/DcPropertyReader.h"
+#include "DataConfig/Serialize/DcSerializer.h"
+#include "DataConfig/Serialize/DcSerializerSetup.h"
+#include "DataConfig/Deserialize/DcDeserializerSetup.h"
 #include "DataConfig/Diagnostic/DcDiagnosticSerDe.h"
+#include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/Deserialize/DcDeserializeBatch.h"
 #include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
@@ -11,6 +21,7 @@
 #include "DataConfig/SerDe/DcDeserializeCommon.inl"
 #include "DataConfig/Extra/SerDe/DcSerDeColor.h"
 #include "DataConfig/Extra/Types/DcExtraTestFixtures.h"
+#include "Async/Async.h"
 
 DC_TEST("DataConfig.Core.Deserialize.Primitive1")
 {
@@ -54,6 +65,210 @@ DC_TEST("DataConfig.Core.Deserialize.Primitive1")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Deserialize.FrozenDefault")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"BoolField" : true,
+			"NameField" : "AName",
+			"StringField" : "AStr",
+			"TextField" : "AText",
+			"EnumField" : "Tard",
+
+			"FloatField" : 17.5,
+			"DoubleField" : 19.375,
+
+			"Int8Field" : -43,
+			"Int16Field" : -2243,
+			"Int32Field" : -23415,
+			"Int64Field" : -1524523,
+
+			"UInt8Field" : 213,
+			"UInt16Field" : 2243,
+			"UInt32Field" : 23415,
+			"UInt64Field" : 1524523,
+		}
+
+	)");
+
+	FDcDeserializer& Deserializer = DcGetDefaultJsonDeserializer();
+	UTEST_TRUE("Deserialize Frozen Default", Deserializer.IsFrozen());
+	UTEST_TRUE("Deserialize Frozen Default", &Deserializer == &DcGetDefaultJsonDeserializer(EDcJsonDeserializeType::Default));
+	UTEST_TRUE("Deserialize Frozen Default", &Deserializer != &DcGetDefaultJsonDeserializer(EDcJsonDeserializeType::StringSoftLazy));
+
+	FDcTestStruct1 Expect;
+	Expect.MakeFixture();
+	FDcPropertyDatum ExpectDatum(&Expect);
+
+	for (int Ix = 0; Ix < 2; Ix++)
+	{
+		FDcTestStruct1 Dest;
+		FDcPropertyDatum DestDatum(&Dest);
+
+		FDcJsonReader Reader(Str);
+		FDcPropertyWriter Writer(DestDatum);
+		FDcDeserializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Deserializer = &Deserializer;
+		UTEST_OK("Deserialize Frozen Default", Ctx.Prepare());
+		UTEST_OK("Deserialize Frozen Default", Deserializer.Deserialize(Ctx));
+		UTEST_OK("Deserialize Frozen Default", DcAutomationUtils::TestReadDatumEqual(DestDatum, ExpectDatum));
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.FrozenConcurrent")
+{
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer);
+	Deserializer.bUseResolutionCache = true;
+	Deserializer.Freeze();
+
+	FDcSerializer Serializer;
+	DcSetupJsonSerializeHandlers(Serializer);
+	Serializer.bUseResolutionCache = true;
+	Serializer.Freeze();
+
+	//	handlers moved into the immutable snapshot
+	UTEST_TRUE("Deserialize Frozen Concurrent", Deserializer.PredicatedDeserializers.Num() == 0);
+	UTEST_TRUE("Deserialize Frozen Concurrent", Deserializer.Frozen->PredicatedDeserializers.Num() > 0);
+	UTEST_TRUE("Deserialize Frozen Concurrent", Serializer.FieldClassSerializerMap.Num() == 0);
+	UTEST_TRUE("Deserialize Frozen Concurrent", Serializer.Frozen->FieldClassSerializerMap.Num() > 0);
+
+	FDcTestStruct1 Expect;
+	Expect.MakeFixture();
+
+	FString Json;
+	{
+		FDcPropertyReader Reader(FDcPropertyDatum(&Expect));
+		FDcJsonWriter Writer;
+		FDcSerializeContext Ctx;
+		Ctx.Reader = &Reader;
+		Ctx.Writer = &Writer;
+		Ctx.Serializer = &Serializer;
+		UTEST_OK("Deserialize Frozen Concurrent", Ctx.Prepare());
+		UTEST_OK("Deserialize Frozen Concurrent", Serializer.Serialize(Ctx));
+		Json = Writer.Sb.ToString();
+	}
+
+	//	every thread round trips through the same pair of frozen instances
+	auto _Roundtrip = [&]() -> FDcResult
+	{
+		for (int Ix = 0; Ix < 64; Ix++)
+		{
+			FDcTestStruct1 Dest;
+			FDcPropertyDatum DestDatum(&Dest);
+			{
+				FDcJsonReader Reader(Json);
+				FDcPropertyWriter Writer(DestDatum);
+				FDcDeserializeContext Ctx;
+				Ctx.Reader = &Reader;
+				Ctx.Writer = &Writer;
+				Ctx.Deserializer = &Deserializer;
+				DC_TRY(Ctx.Prepare());
+				DC_TRY(Deserializer.Deserialize(Ctx));
+			}
+			DC_TRY(DcAutomationUtils::TestReadDatumEqual(DestDatum, FDcPropertyDatum(&Expect)));
+
+			FDcPropertyReader Reader(DestDatum);
+			FDcJsonWriter Writer;
+			FDcSerializeContext Ctx;
+			Ctx.Reader = &Reader;
+			Ctx.Writer = &Writer;
+			Ctx.Serializer = &Serializer;
+			DC_TRY(Ctx.Prepare());
+			DC_TRY(Serializer.Serialize(Ctx));
+
+			if (Json != Writer.Sb.ToString())
+				return DC_FAIL(DcDCommon, CustomMessage) << TEXT("Roundtrip mismatch");
+		}
+
+		return DcOk();
+	};
+
+	constexpr int32 ThreadCount = 4;
+	TArray<TFuture<bool>> Futures;
+	for (int32 Ix = 0; Ix < ThreadCount; Ix++)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread, [&_Roundtrip]
+		{
+			bool bOk = _Roundtrip().Ok();
+			DcFlushThreadEnv();
+			return bOk;
+		}));
+	}
+
+	for (TFuture<bool>& Future : Futures)
+		UTEST_TRUE("Deserialize Frozen Concurrent", Future.Get());
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.BatchLoad")
+{
+	const int32 JobNum = 16;
+	TArray<FDcTestStruct1> Dests;
+	Dests.SetNum(JobNum);
+
+	TArray<FString> Strs;
+	for (int Ix = 0; Ix < JobNum; Ix++)
+		Strs.Add(FString::Printf(TEXT(R"({ "Int32Field" : %d, "StringField" : "Str%d" })"), Ix, Ix));
+
+	//	trailing token
+	Strs[3] = TEXT(R"({ "Int32Field" : 3 } {})");
+
+	TArray<TArray<uint8>> Bufs;
+	TArray<FDcBatchLoadJob> Jobs;
+	for (int Ix = 0; Ix < JobNum; Ix++)
+	{
+		FTCHARToUTF8 UTF8(*Strs[Ix]);
+		Bufs.Emplace((const uint8*)UTF8.Get(), UTF8.Length());
+	}
+
+	for (int Ix = 0; Ix < JobNum; Ix++)
+	{
+		FDcBatchLoadJob& Job = Jobs.AddDefaulted_GetRef();
+		Job.Buffer = Bufs[Ix];
+		Job.Target = FDcPropertyDatum(&Dests[Ix]);
+	}
+	//	missing file
+	Jobs[7].FilePath = TEXT("__DcBatchLoadNotExist__.json");
+
+	FDcBatchLoadConfig Config;
+	Config.NumWorkers = 4;
+	FDcBatchLoadResults Results = DcBatchLoad(Jobs, Config);
+
+	UTEST_EQUAL("Deserialize BatchLoad", Results.Results.Num(), JobNum);
+	UTEST_EQUAL("Deserialize BatchLoad", Results.NumFailed, 2);
+	UTEST_FALSE("Deserialize BatchLoad", Results.AllOk());
+
+	for (int Ix = 0; Ix < JobNum; Ix++)
+	{
+		const FDcBatchLoadResult& Result = Results.Results[Ix];
+		if (Ix == 3 || Ix == 7)
+		{
+			UTEST_FALSE("Deserialize BatchLoad", Result.bOk);
+			UTEST_TRUE("Deserialize BatchLoad", Result.Diagnostics.Num() == 1);
+			continue;
+		}
+
+		UTEST_TRUE("Deserialize BatchLoad", Result.bOk);
+		UTEST_TRUE("Deserialize BatchLoad", Result.Diagnostics.Num() == 0);
+		UTEST_EQUAL("Deserialize BatchLoad", Dests[Ix].Int32Field, Ix);
+		UTEST_EQUAL("Deserialize BatchLoad", Dests[Ix].StringField, FString::Printf(TEXT("Str%d"), Ix));
+	}
+
+	const FDcErrorCode& TrailingCode = Results.Results[3].Diagnostics[0].Code;
+	UTEST_TRUE("Deserialize BatchLoad", TrailingCode.CategoryID == DcDJSON::Category && TrailingCode.ErrorID == DcDJSON::UnexpectedTrailingToken);
+	const FDcErrorCode& FileCode = Results.Results[7].Diagnostics[0].Code;
+	UTEST_TRUE("Deserialize BatchLoad", FileCode.CategoryID == DcDCommon::Category && FileCode.ErrorID == DcDCommon::FileMapFailed);
+
+	return true;
+}
+
 
 #if WITH_EDITORONLY_DATA
 DC_TEST("DataConfig.Core.Deserialize.EnumFlags")
@@ -121,6 +336,56 @@ DC_TEST("DataConfig.Core.Deserialize.InlineSubObject")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Deserialize.TypeResolveCache")
+{
+	FString Str = TEXT(R"(
+
+		{
+			"ShapeField1" :  {
+				"$type" : "DcShapeBox",
+				"ShapeName" : "Box1",
+				"Height" : 17.5,
+				"Width" : 1.9375
+			},
+			"ShapeField2" : {
+				"$type" : "DcShapeSquare",
+				"ShapeName" : "Square1",
+				"Radius" : 1.75,
+			},
+			"ShapeField3" : null
+		}
+
+	)");
+
+	FDcTestStructShapeContainer1 Expect;
+	Expect.MakeFixture();
+	FDcPropertyDatum ExpectDatum(&Expect);
+
+	FDcTypeResolveCache Cache;
+	for (int Ix = 0; Ix < 2; Ix++)
+	{
+		FDcJsonReader Reader(Str);
+		FDcTestStructShapeContainer1 Dest;
+		FDcPropertyDatum DestDatum(&Dest);
+
+		UTEST_OK("Deserialize TypeResolveCache", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum,
+		[&](FDcDeserializeContext& Ctx){
+			Ctx.Objects.Push(GetTransientPackage());
+			Ctx.TypeResolveCache = &Cache;
+		}));
+		UTEST_OK("Deserialize TypeResolveCache", DcAutomationUtils::TestReadDatumEqual(DestDatum, ExpectDatum));
+		UTEST_EQUAL("Deserialize TypeResolveCache", Cache.Entries.Num(), 2);
+	}
+
+	const ANSICHAR* BoxStr = "DcShapeBox";
+	UTEST_TRUE("Deserialize TypeResolveCache", Cache.Find<UClass>(FDcStringViewData::FromAscii(BoxStr, 10)) == UDcShapeBox::StaticClass());
+	UTEST_TRUE("Deserialize TypeResolveCache", Cache.Find<UClass>(FDcStringViewData::FromUtf8(BoxStr, 10, 10)) == UDcShapeBox::StaticClass());
+	UTEST_TRUE("Deserialize TypeResolveCache", Cache.Find<UClass>(FDcStringViewData::FromOwned(TEXT("DcShapeSquare"))) == UDcShapeSquare::StaticClass());
+	UTEST_TRUE("Deserialize TypeResolveCache", Cache.Find<UScriptStruct>(FDcStringViewData::FromOwned(TEXT("DcShapeBox"))) == nullptr);
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.Deserialize.ObjectRef")
 {
 	FString Str = TEXT(R"(
@@ -211,6 +476,102 @@ DC_TEST("DataConfig.Core.Deserialize.Containers")
 	UTEST_OK("Deserialize into FDcTestStruct3", DcAutomationUtils::DeserializeFrom(&Reader, DestDatum));
 	UTEST_OK("Deserialize into FDcTestStruct3", DcAutomationUtils::TestReadDatumEqual(DestDatum, ExpectDatum));
 
+	{
+		//	containers are reserved upfront with counted sizes
+		FDcJsonReader CountReader(Str);
+		CountReader.bCountContainerSize = true;
+
+		FDcTestStruct3 CountDest;
+		FDcPropertyDatum CountDestDatum(&CountDest);
+
+		UTEST_OK("Deserialize into FDcTestStruct3", DcAutomationUtils::DeserializeFrom(&CountReader, CountDestDatum));
+		UTEST_OK("Deserialize into FDcTestStruct3", DcAutomationUtils::TestReadDatumEqual(CountDestDatum, ExpectDatum));
+		UTEST_TRUE("Deserialize into FDcTestStruct3", CountDest.StringArray.Max() >= 3);
+		UTEST_TRUE("Deserialize into FDcTestStruct3", CountDest.StructArray.Max() >= 3);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Deserialize.Projection")
+{
+	FDcTestStruct3 Source;
+	Source.MakeFixtureNoStructMap();
+	FDcPropertyDatum SourceDatum(&Source);
+
+	FDcDeserializeProjection Projection;
+	Projection.AddPath(TEXT("StringArray"));
+	Projection.AddPath(TEXT("StructArray.Name"));
+
+	auto _ExpectProjected = [&](const FDcTestStruct3& Dest)
+	{
+		return Dest.StringArray == Source.StringArray
+			&& Dest.StringSet.Num() == 0
+			&& Dest.StringMap.Num() == 0
+			&& Dest.StructSet.Num() == 0
+			&& Dest.StructArray.Num() == 3
+			&& Dest.StructArray[2].Name == TEXT("Three")
+			&& Dest.StructArray[2].Index == 0;
+	};
+
+	{
+		FDcJsonReader Reader(TEXT(R"(
+			{
+				"StringArray" : [ "Foo", "Bar", "Baz" ],
+				"StringSet" : [ "Doo", "Dar", "Daz" ],
+				"StringMap" : { "One": "1" },
+				"StructArray" : [
+					{ "Name" : "One", "Index" : 1 },
+					{ "Name" : "Two", "Index" : 2 },
+					{ "Name" : "Three", "Index" : 3 }
+				],
+				"StructSet" : [ { "Name" : "One", "Index" : 1 } ]
+			}
+		)"));
+
+		FDcTestStruct3 Dest;
+		UTEST_OK("Deserialize Projection", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			Ctx.Projection = &Projection;
+		}));
+		UTEST_TRUE("Deserialize Projection", _ExpectProjected(Dest));
+	}
+
+	{
+		FDcMsgPackWriter Writer;
+		UTEST_OK("Deserialize Projection", DcAutomationUtils::SerializeInto(&Writer, SourceDatum,
+		[](FDcSerializeContext& Ctx)
+		{
+			DcSetupMsgPackSerializeHandlers(*Ctx.Serializer);
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+
+		FDcMsgPackWriter::BufferType Buffer = Writer.GetMainBuffer();
+		FDcMsgPackReader Reader(FDcBlobViewData::From(Buffer));
+
+		FDcTestStruct3 Dest;
+		UTEST_OK("Deserialize Projection", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			DcSetupMsgPackDeserializeHandlers(*Ctx.Deserializer);
+			Ctx.Projection = &Projection;
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+		UTEST_TRUE("Deserialize Projection", _ExpectProjected(Dest));
+	}
+
+	{
+		FDcPropertyReader Reader(SourceDatum);
+
+		FDcTestStruct3 Dest;
+		UTEST_OK("Deserialize Projection", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			DcSetupPropertyPipeDeserializeHandlers(*Ctx.Deserializer);
+			Ctx.Projection = &Projection;
+		}, DcAutomationUtils::EDefaultSetupType::SetupNothing));
+		UTEST_TRUE("Deserialize Projection", _ExpectProjected(Dest));
+	}
+
 	return true;
 }
 
@@ -289,6 +650,112 @@ DC_TEST("DataConfig.Core.Deserialize.ObjRefs")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Deserialize.ObjRefsCacheDeferred")
+{
+	FDcTestStructRefs1 Expect;
+	Expect.MakeFixture();
+
+	{
+		FDcJsonReader Reader(TEXT(R"(
+			{
+				"ObjectField1" : "'/Script/DataConfigTests'",
+				"SoftField1" : "'/Script/DataConfigTests'",
+				"WeakField1" : "'/Script/DataConfigTests'",
+			}
+		)"));
+
+		FDcObjectReferenceCache Cache;
+		FDcTestStructRefs1 Dest;
+		UTEST_OK("Deserialize Refs Cached", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			Ctx.ObjectReferenceCache = &Cache;
+		}));
+
+		UTEST_EQUAL("Deserialize Refs Cached", Cache.Entries.Num(), 1);
+		UTEST_TRUE("Deserialize Refs Cached", Cache.Find(UObject::StaticClass(), TEXT("'/Script/DataConfigTests'")) == Expect.ObjectField1);
+		UTEST_TRUE("Deserialize Refs Cached", Dest.ObjectField1 == Expect.ObjectField1);
+		UTEST_TRUE("Deserialize Refs Cached", Dest.SoftField1 == Expect.SoftField1);
+		UTEST_TRUE("Deserialize Refs Cached", Dest.WeakField1 == Expect.WeakField1);
+	}
+
+	{
+		FDcJsonReader Reader(TEXT(R"(
+			{
+				"ObjectField1" : "'/Script/DataConfigTests'",
+				"SoftField1" : "/Script/DataConfigTests",
+				"SoftField2" : null,
+			}
+		)"));
+
+		FDcDeferredReferences Deferred;
+		FDcTestStructRefs1 Dest;
+		UTEST_OK("Deserialize Refs Deferred", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			Ctx.DeferredReferences = &Deferred;
+		}));
+
+		UTEST_EQUAL("Deserialize Refs Deferred", Deferred.Entries.Num(), 1);
+		UTEST_TRUE("Deserialize Refs Deferred", Dest.ObjectField1 == Expect.ObjectField1);
+		UTEST_TRUE("Deserialize Refs Deferred", Dest.SoftField1.ToSoftObjectPath() == Expect.SoftField1.ToSoftObjectPath());
+		UTEST_TRUE("Deserialize Refs Deferred", Dest.SoftField2.IsNull());
+
+		FDcObjectReferenceCache Cache;
+		UTEST_OK("Deserialize Refs Deferred", DcDeserializeUtils::ResolveDeferredReferences(Deferred, &Cache));
+		UTEST_TRUE("Deserialize Refs Deferred", Dest.SoftField1.Get() == Expect.ObjectField1);
+		UTEST_EQUAL("Deserialize Refs Deferred", Cache.Entries.Num(), 1);
+	}
+
+	{
+		FDcJsonReader Reader(TEXT(R"(
+			{
+				"SoftField1" : "/Script/DataConfigTests.DcNotExist",
+			}
+		)"));
+
+		FDcDeferredReferences Deferred;
+		FDcTestStructRefs1 Dest;
+		UTEST_OK("Deserialize Refs Deferred Missing", DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest),
+		[&](FDcDeserializeContext& Ctx)
+		{
+			Ctx.DeferredReferences = &Deferred;
+		}));
+
+		UTEST_DIAG("Deserialize Refs Deferred Missing", DcDeserializeUtils::ResolveDeferredReferences(Deferred), DcDSerDe, UObjectByStrNotFound);
+
+		//	native packages are loaded already, resolved right away
+		bool bFailed = false;
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+		DcDeserializeUtils::LoadDeferredReferencesAsync(Deferred, [&bFailed](FDcResult Result)
+		{
+			bFailed = !Result.Ok();
+		});
+		UTEST_TRUE("Deserialize Refs Deferred Missing", bFailed);
+		UTEST_EQUAL("Deserialize Refs Deferred Missing", DcEnv().GetLastDiag().Code.ErrorID, (uint16)DcDSerDe::UObjectByStrNotFound);
+		DcEnv().Diagnostics.Empty();
+	}
+
+	{
+		FDcDeferredReferences Deferred;
+		Deferred.Add(FSoftObjectPath(TEXT("/Game/DcNotExist/DcNotExist.DcNotExist")), UObject::StaticClass(), false);
+
+		bool bFailed = false;
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+		DcDeserializeUtils::LoadDeferredReferencesAsync(Deferred, [&bFailed](FDcResult Result)
+		{
+			bFailed = !Result.Ok();
+		});
+		FlushAsyncLoading();
+
+		UTEST_TRUE("Deserialize Refs Deferred Async Missing", bFailed);
+		UTEST_EQUAL("Deserialize Refs Deferred Async Missing", DcEnv().GetLastDiag().Code.ErrorID, (uint16)DcDSerDe::PackageAsyncLoadFailed);
+		DcEnv().Diagnostics.Empty();
+	}
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.Deserialize.ClassRefs")
 {
 	FString Str = TEXT(R"(
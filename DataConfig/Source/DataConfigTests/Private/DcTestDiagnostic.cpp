@@ -4,6 +4,8 @@
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
 #include "DataConfig/Source/DcHighlightFormatter.h"
+#include "DataConfig/Json/DcJsonReader.h"
+#include "DcTestProperty.h"
 
 
 namespace DcTestDiagnosticDetails
@@ -176,3 +178,131 @@ DC_TEST("DataConfig.Core.Diagnostic.Highlight")
 	return true;
 };
 
+DC_TEST("DataConfig.Core.Diagnostic.DeferredAndSilent")
+{
+	FString Str = TEXT(R"(
+		{
+			"StringArray" : [
+				"Foo",
+				123
+			]
+		}
+	)");
+
+	auto _Deserialize = [&Str]
+	{
+		FDcTestStruct3 Dest;
+		FDcJsonReader Reader(Str);
+		return DcAutomationUtils::DeserializeFrom(&Reader, FDcPropertyDatum(&Dest));
+	};
+
+	bool bPrevExpectFail = DcEnv().bExpectFail;
+	FDcErrorCode FullCode;
+	FString FullStr;
+	{
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+		UTEST_FALSE("Diagnostic Deferred", _Deserialize().Ok());
+		UTEST_EQUAL("Diagnostic Deferred", DcEnv().Diagnostics.Num(), 1);
+
+		FullCode = DcEnv().GetLastDiag().Code;
+		FullStr = DcDiagnosticToString(DcEnv().GetLastDiag());
+		DcEnv().Diagnostics.Empty();
+	}
+
+	{
+		FDcScopedDiagMode ScopedMode(EDcDiagMode::Deferred);
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+		UTEST_FALSE("Diagnostic Deferred", _Deserialize().Ok());
+		UTEST_EQUAL("Diagnostic Deferred", DcEnv().Diagnostics.Num(), 1);
+
+		//	reader and context are gone, format from snapshots
+		FDcDiagnostic& Diag = DcEnv().GetLastDiag();
+		UTEST_TRUE("Diagnostic Deferred", Diag.DeferredArgs.Num() > 0);
+		UTEST_TRUE("Diagnostic Deferred", Diag.Highlights.ContainsByPredicate([](const FDcDiagnosticHighlight& Highlight) {
+			return Highlight.DeferredFormat && Highlight.Formatted.IsEmpty();
+		}));
+		UTEST_EQUAL("Diagnostic Deferred", DcDiagnosticToString(Diag), FullStr);
+		UTEST_EQUAL("Diagnostic Deferred", Diag.DeferredArgs.Num(), 0);
+		UTEST_FALSE("Diagnostic Deferred", Diag.Highlights.ContainsByPredicate([](const FDcDiagnosticHighlight& Highlight) {
+			return (bool)Highlight.DeferredFormat;
+		}));
+		DcEnv().Diagnostics.Empty();
+	}
+
+	{
+		//	no stack walk when not formatting right away
+		FDcScopedDiagMode ScopedMode(EDcDiagMode::Deferred);
+		TDcStoreThenReset<bool> ScopedExpectFail(DcEnv().bExpectFail, true);
+		UTEST_FALSE("Diagnostic Deferred", DcFail().Ok());
+		UTEST_EQUAL("Diagnostic Deferred", DcEnv().GetLastDiag().Args.Num(), 0);
+		DcEnv().Diagnostics.Empty();
+	}
+
+	{
+		FDcScopedSilentProbe Probe;
+		UTEST_TRUE("Diagnostic Silent Probe", DcEnv().bExpectFail);
+		UTEST_FALSE("Diagnostic Silent Probe", _Deserialize().Ok());
+		UTEST_EQUAL("Diagnostic Silent Probe", DcEnv().Diagnostics.Num(), 0);
+
+		FDcDiagnostic& Diag = DcEnv().GetLastDiag();
+		UTEST_EQUAL("Diagnostic Silent Probe", Diag.Code.CategoryID, FullCode.CategoryID);
+		UTEST_EQUAL("Diagnostic Silent Probe", Diag.Code.ErrorID, FullCode.ErrorID);
+		UTEST_EQUAL("Diagnostic Silent Probe", Diag.Args.Num(), 0);
+		UTEST_EQUAL("Diagnostic Silent Probe", Diag.Highlights.Num(), 0);
+
+		//	args after `DC_FAIL` aren't evaluated
+		int32 EvaluatedNum = 0;
+		auto _Arg = [&EvaluatedNum]
+		{
+			EvaluatedNum++;
+			return FString(TEXT("Arg"));
+		};
+
+		FDcResult Result = DC_FAIL(DcDCommon, CustomMessage) << _Arg();
+		UTEST_FALSE("Diagnostic Silent Probe", Result.Ok());
+		UTEST_EQUAL("Diagnostic Silent Probe", EvaluatedNum, 0);
+		UTEST_EQUAL("Diagnostic Silent Probe", DcEnv().GetLastDiag().Code.ErrorID, (uint16)DcDCommon::CustomMessage);
+	}
+
+	UTEST_TRUE("Diagnostic Silent Probe", DcEnv().DiagMode == EDcDiagMode::Full);
+	UTEST_EQUAL("Diagnostic Silent Probe", DcEnv().bExpectFail, bPrevExpectFail);
+
+	return true;
+}
+
+
+DC_TEST("DataConfig.Core.Diagnostic.SharedConsumer")
+{
+	struct FCountDiagnosticConsumer : public IDcDiagnosticConsumer
+	{
+		void HandleDiagnostic(FDcDiagnostic& Diag) override { Count++; }
+		int32 Count = 0;
+	};
+
+	TSharedPtr<FCountDiagnosticConsumer> CountConsumer = MakeShareable(new FCountDiagnosticConsumer());
+	TSharedPtr<IDcDiagnosticConsumer> PrevConsumer = DcGetSharedDiagConsumer();
+	DcSetSharedDiagConsumer(CountConsumer);
+
+	{
+		//	scoped envs without a consumer drop diagnostics by default
+		FDcScopedEnv ScopedEnv;
+		ScopedEnv.Get().bExpectFail = true;
+		FDcResult Result = DC_FAIL(DcDCommon, CustomMessage) << TEXT("Dropped");
+		UTEST_FALSE("Diagnostic Shared Consumer", Result.Ok());
+	}
+	UTEST_EQUAL("Diagnostic Shared Consumer", CountConsumer->Count, 0);
+
+	{
+		FDcScopedEnv ScopedEnv;
+		ScopedEnv.Get().bExpectFail = true;
+		ScopedEnv.Get().bForwardToSharedConsumer = true;
+		FDcResult Result = DC_FAIL(DcDCommon, CustomMessage) << TEXT("Forwarded");
+		UTEST_FALSE("Diagnostic Shared Consumer", Result.Ok());
+	}
+	UTEST_EQUAL("Diagnostic Shared Consumer", CountConsumer->Count, 1);
+
+	DcSetSharedDiagConsumer(PrevConsumer);
+	UTEST_TRUE("Diagnostic Shared Consumer", DcGetSharedDiagConsumer() == PrevConsumer);
+
+	return true;
+}
@@ -1,11 +1,15 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Json/DcJsonReader.h"
+#include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Json/DcJsonScan.h"
 #include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
 #include "DataConfig/Diagnostic/DcDiagnosticCommon.h"
+#include "DataConfig/SerDe/DcSerDeUtils.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
 
 DC_TEST("DataConfig.Core.JSON.Reader1")
 {
@@ -76,6 +80,55 @@ DC_TEST("DataConfig.Core.JSON.Diags")
 		UTEST_DIAG("Expect 'DuplicateKey' err", DcNoopPipeVisit(&Reader), DcDJSON, DuplicatedKey);
 	}
 
+	{
+		//	escaped key equals to plain key
+		FString Str = TEXT(R"(
+
+			{
+				"Key" : 1,
+				"\u004bey" : 2,
+			}
+
+		)");
+		FDcJsonReader Reader(Str);
+
+		UTEST_DIAG("Expect 'DuplicateKey' err", DcNoopPipeVisit(&Reader), DcDJSON, DuplicatedKey);
+	}
+
+	{
+		//	wide objects goes through hashed index
+		FString Str = TEXT("{");
+		for (int Ix = 0; Ix < 40; Ix++)
+			Str.Appendf(TEXT("\"Key%d\" : %d, "), Ix, Ix);
+		Str.Append(TEXT("\"Key23\" : 23}"));
+
+		FDcJsonReader Reader(Str);
+		UTEST_DIAG("Expect 'DuplicateKey' err", DcNoopPipeVisit(&Reader), DcDJSON, DuplicatedKey);
+
+		FTCHARToUTF8 UTF8Str(*Str);
+		FDcAnsiJsonReader AnsiReader(UTF8Str.Get(), UTF8Str.Length());
+		UTEST_DIAG("Expect 'DuplicateKey' err", DcNoopPipeVisit(&AnsiReader), DcDJSON, DuplicatedKey);
+
+		FDcJsonReader NoCheckReader(Str);
+		NoCheckReader.bCheckDuplicatedKey = false;
+		UTEST_OK("Skip duplicated key check", DcNoopPipeVisit(&NoCheckReader));
+	}
+
+	{
+		//	same keys in sibling and nested objects are fine
+		FString Str = TEXT(R"(
+
+			{
+				"Key" : { "Key" : 1 },
+				"Other" : { "Key" : 2, "Nested" : { "Key" : 3 } },
+			}
+
+		)");
+		FDcJsonReader Reader(Str);
+
+		UTEST_OK("Nested same keys", DcNoopPipeVisit(&Reader));
+	}
+
 	{
 		FString Str = TEXT(R"(
 
@@ -152,6 +205,68 @@ DC_TEST("DataConfig.Core.JSON.EndRead")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.JSON.ContainerSize")
+{
+	auto _PeekSize = [](FDcJsonReader& Reader)
+	{
+		int32 Size = -2;
+		Reader.PeekContainerSize(&Size).Ok();
+		return Size;
+	};
+
+	{
+		FString Str = TEXT(R"(
+			[
+				1, [2, 3], "a,]\"[", {"b" : [4,]},
+				// ],
+				/* [, */ 5,
+			]
+		)");
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Read json", Reader.ReadArrayRoot());
+		UTEST_EQUAL("Count disabled", _PeekSize(Reader), INDEX_NONE);
+
+		Reader.bCountContainerSize = true;
+		UTEST_EQUAL("Count array", _PeekSize(Reader), 5);
+
+		UTEST_OK("Read json", Reader.ReadInt32(nullptr));
+		UTEST_EQUAL("Not at container start", _PeekSize(Reader), INDEX_NONE);
+
+		UTEST_OK("Read json", Reader.ReadArrayRoot());
+		UTEST_EQUAL("Count nested array", _PeekSize(Reader), 2);
+	}
+
+	{
+		FString Str = TEXT(R"(
+			{
+				"a" : 1,
+				"b" : { "c" : [], "d" : {} },
+				"e,}" : "f",
+			}
+		)");
+		FDcJsonReader Reader(Str);
+		Reader.bCountContainerSize = true;
+		UTEST_OK("Read json", Reader.ReadMapRoot());
+		UTEST_EQUAL("Count object", _PeekSize(Reader), 3);
+	}
+
+	{
+		FDcJsonReader Reader(TEXT("[ ]"));
+		Reader.bCountContainerSize = true;
+		UTEST_OK("Read json", Reader.ReadArrayRoot());
+		UTEST_EQUAL("Count empty", _PeekSize(Reader), 0);
+	}
+
+	{
+		FDcJsonReader Reader(TEXT("[1, 2"));
+		Reader.bCountContainerSize = true;
+		UTEST_OK("Read json", Reader.ReadArrayRoot());
+		UTEST_EQUAL("Count unclosed", _PeekSize(Reader), INDEX_NONE);
+	}
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.JSON.UTF8")
 {
 	{
@@ -174,6 +289,148 @@ DC_TEST("DataConfig.Core.JSON.UTF8")
 		UTEST_EQUAL("Read UTF8 String", LoadedStr, TEXT("\t\u4f60\u597d"));
 	}
 
+	{
+		//	non ascii strings are handed out as borrowed UTF8 and decoded on demand
+		const char* UTF8Literal = "{\"\xe4\xbd\xa0\" : \"\xf0\x9d\x84\x9e\xe5\xa5\xbd\", \"\\u4f60\" : 1}";
+
+		FDcAnsiJsonReader Reader(UTF8Literal);
+		UTEST_OK("Read UTF8 View", Reader.ReadMapRoot());
+
+		FDcStringViewData Key;
+		UTEST_OK("Read UTF8 View", Reader.ReadStringView(&Key));
+		UTEST_EQUAL("Read UTF8 View", (int)Key.Type, (int)FDcStringViewData::EType::Utf8);
+		UTEST_EQUAL("Read UTF8 View", Key.ToName(), FName(TEXT("\u4f60")));
+
+		FDcStringViewData Value;
+		FString Expect = TEXT("\xD834\xDD1E\u597d");
+		UTEST_OK("Read UTF8 View", Reader.ReadStringView(&Value));
+		UTEST_EQUAL("Read UTF8 View", (int)Value.Type, (int)FDcStringViewData::EType::Utf8);
+		UTEST_EQUAL("Read UTF8 View", Value.Len(), Expect.Len());
+		UTEST_EQUAL("Read UTF8 View", Value.GetChar(Expect.Len() - 1), TCHAR(0x597d));
+		UTEST_TRUE("Read UTF8 View", Value.Equals(Expect));
+		UTEST_EQUAL("Read UTF8 View", Value.ToString(), Expect);
+
+		//	escaped key decodes to the same string as the raw UTF8 one
+		UTEST_DIAG("Read UTF8 View", Reader.ReadStringView(nullptr), DcDJSON, DuplicatedKey);
+	}
+
+	{
+		const char* InvalidLiterals[] = {
+			"\"\xc0\xaf\"",			//	overlong
+			"\"\xed\xa0\x80\"",		//	surrogate
+			"\"\xf4\x90\x80\x80\"",	//	above U+10FFFF
+			"\"\xe4\xbd\"",			//	truncated
+			"\"\\t\xff\"",			//	escaped
+		};
+
+		for (const char* Literal : InvalidLiterals)
+		{
+			FDcAnsiJsonReader Reader(Literal);
+			UTEST_DIAG("Read Invalid UTF8", Reader.ReadString(nullptr), DcDJSON, InvalidUtf8);
+
+			FDcAnsiJsonReader ViewReader(Literal);
+			UTEST_DIAG("Read Invalid UTF8", ViewReader.ReadStringView(nullptr), DcDJSON, InvalidUtf8);
+		}
+	}
+
+	{
+		//	writer encodes and escapes straight into UTF8 bytes
+		FDcAnsiCondensedJsonWriter Writer;
+		UTEST_OK("Write UTF8 String", Writer.WriteString(TEXT("\u4f60\t\xD834\xDD1E\"\x01")));
+		UTEST_EQUAL("Write UTF8 String", FString(UTF8_TO_TCHAR(*Writer.Sb)), FString(TEXT("\"\u4f60\\t\xD834\xDD1E\\\"\\u0001\"")));
+		UTEST_EQUAL("Write UTF8 String", Writer.Sb.Len(), 1 + 3 + 2 + 4 + 2 + 6 + 1);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.JSON.AnsiScanner")
+{
+	EDcJsonScanImpl PrevImpl = DcJsonScan::GetImpl();
+	ON_SCOPE_EXIT { DcJsonScan::SetImpl(PrevImpl); };
+
+	EDcJsonScanImpl Impls[] = { EDcJsonScanImpl::Scalar, DcJsonScan::GetNativeImpl() };
+	for (EDcJsonScanImpl Impl : Impls)
+	{
+		DcJsonScan::SetImpl(Impl);
+		UTEST_EQUAL("Json Scanner Impl", DcJsonScan::GetImpl(), Impl);
+
+		//	move escapes, non ascii and line breaks across block boundaries
+		for (int Pad = 0; Pad < 40; Pad++)
+		{
+			FString Padding = FString::ChrN(Pad, TCHAR('a'));
+			FString Json = FString(TEXT("\n  \n")) + FString::ChrN(Pad, TCHAR(' '))
+				+ TEXT("\"") + Padding + TEXT("\u4f60") + Padding + TEXT("\\n") + Padding + TEXT("\"");
+			FString Expect = Padding + TEXT("\u4f60") + Padding + TEXT("\n") + Padding;
+
+			FTCHARToUTF8 UTF8Json(*Json);
+			FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+
+			FString Str;
+			UTEST_OK("Json Scanner String", Reader.ReadString(&Str));
+			UTEST_EQUAL("Json Scanner String", Str, Expect);
+			UTEST_EQUAL("Json Scanner Line", (int)Reader.Loc.Line, 3);
+			UTEST_EQUAL("Json Scanner Column", (int)Reader.Loc.Column, UTF8Json.Length() - 3);
+			UTEST_OK("Json Scanner String", Reader.FinishRead());
+		}
+
+		for (int Pad = 0; Pad < 40; Pad++)
+		{
+			FString Padding = FString::ChrN(Pad, TCHAR('a'));
+			{
+				FTCHARToUTF8 UTF8Json(*(TEXT("\"") + Padding + TEXT("\t\"")));
+				FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+				UTEST_DIAG("Json Scanner Tab", Reader.ReadString(nullptr), DcDJSON, InvalidControlCharInString);
+			}
+
+			{
+				FTCHARToUTF8 UTF8Json(*(TEXT("\"") + Padding + TEXT("\n\"")));
+				FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+				UTEST_DIAG("Json Scanner Line Break", Reader.ReadString(nullptr), DcDJSON, UnclosedStringLiteral);
+			}
+
+			{
+				FTCHARToUTF8 UTF8Json(*(TEXT("\"") + Padding));
+				FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+				UTEST_DIAG("Json Scanner EOF", Reader.ReadString(nullptr), DcDJSON, UnclosedStringLiteral);
+			}
+		}
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.JSON.WriterEscapeScanner")
+{
+	EDcJsonScanImpl PrevImpl = DcJsonScan::GetImpl();
+	ON_SCOPE_EXIT { DcJsonScan::SetImpl(PrevImpl); };
+
+	EDcJsonScanImpl Impls[] = { EDcJsonScanImpl::Scalar, DcJsonScan::GetNativeImpl() };
+	for (EDcJsonScanImpl Impl : Impls)
+	{
+		DcJsonScan::SetImpl(Impl);
+
+		//	move escapes and non ascii across block boundaries
+		for (int Pad = 0; Pad < 20; Pad++)
+		{
+			FString Padding = FString::ChrN(Pad, TCHAR('a'));
+			FString Str = Padding + TEXT("\"") + Padding + TEXT("\u4f60\x7f") + Padding + TEXT("\x01\\") + Padding;
+			FString Expect = TEXT("\"") + Padding + TEXT("\\\"") + Padding + TEXT("\u4f60\\u007f") + Padding + TEXT("\\u0001\\\\") + Padding + TEXT("\"");
+
+			{
+				FDcCondensedJsonWriter Writer;
+				UTEST_OK("Json Writer Escape", Writer.WriteString(Str));
+				UTEST_EQUAL("Json Writer Escape", FString(Writer.Sb.ToString()), Expect);
+			}
+
+			{
+				FDcAnsiCondensedJsonWriter Writer;
+				UTEST_OK("Json Writer Escape", Writer.WriteString(Str));
+				UTEST_EQUAL("Json Writer Escape", FString(UTF8_TO_TCHAR(*Writer.Sb)), Expect);
+			}
+		}
+	}
+
 	return true;
 }
 
@@ -345,3 +602,98 @@ DC_TEST("DataConfig.Core.JSON.JSONTestSuiteParsing")
 	return bAllPass;
 }
 
+namespace DcTestJsonDetails
+{
+
+template<typename TReader>
+static FDcResult CheckJsonNumbersMatchAtod(FAutomationTestBase* Self, TReader& Reader, TReader& LiteralReader)
+{
+	//	walk both readers in lockstep, one reads numbers as double and the other as literal string
+	while (true)
+	{
+		EDcDataEntry Next;
+		DC_TRY(Reader.PeekRead(&Next));
+		if (Next == EDcDataEntry::Ended)
+			return DcOk();
+
+		if (Next == EDcDataEntry::Double)
+		{
+			double Value;
+			DC_TRY(Reader.ReadDouble(&Value));
+			FString Literal;
+			DC_TRY(LiteralReader.ReadString(&Literal));
+
+			double Expect = FCString::Atod(*Literal);
+			if (!Self->TestTrue(*Literal, FMemory::Memcmp(&Value, &Expect, sizeof(double)) == 0))
+				return DC_FAIL(DcDCommon, CustomMessage)
+					<< FString::Printf(TEXT("Number mismatch: %s, Expect: %.17g, Actual: %.17g"), *Literal, Expect, Value);
+		}
+		else
+		{
+			DC_TRY(DcSerDeUtils::DispatchNoopRead(Next, &Reader));
+			DC_TRY(DcSerDeUtils::DispatchNoopRead(Next, &LiteralReader));
+		}
+	}
+}
+
+} // namespace DcTestJsonDetails
+
+DC_TEST("DataConfig.Core.JSON.JSONTestSuiteNumbers")
+{
+	using namespace DcTestJsonDetails;
+
+	TArray<FString> Filenames;
+	IFileManager::Get().IterateDirectory(*DcGetFixturePath(TEXT("JSONTestSuiteParsing")), [&](const TCHAR* VisitFilename, bool VisitIsDir)
+	{
+		FString Basename = FPaths::GetCleanFilename(VisitFilename);
+		if ((Basename.StartsWith(TEXT("y_")) || Basename.StartsWith(TEXT("i_")))
+			&& Basename.Contains(TEXT("number"))
+			&& Basename.EndsWith(TEXT(".json"), ESearchCase::IgnoreCase))
+		{
+			Filenames.Add(VisitFilename);
+		}
+
+		return true;
+	});
+
+	UTEST_TRUE("JSONTestSuite number fixtures", Filenames.Num() > 0);
+	for (const FString& Filename : Filenames)
+	{
+		FString JsonStr;
+		UTEST_TRUE("Load fixture", FFileHelper::LoadFileToString(JsonStr, *Filename));
+
+		{
+			FDcJsonReader Reader(JsonStr);
+			FDcJsonReader LiteralReader(JsonStr);
+			UTEST_OK("JSONTestSuite numbers", CheckJsonNumbersMatchAtod(this, Reader, LiteralReader));
+		}
+
+		{
+			FTCHARToUTF8 Utf8(*JsonStr);
+			FDcAnsiJsonReader Reader(Utf8.Get(), Utf8.Length());
+			FDcAnsiJsonReader LiteralReader(Utf8.Get(), Utf8.Length());
+			UTEST_OK("JSONTestSuite numbers ansi", CheckJsonNumbersMatchAtod(this, Reader, LiteralReader));
+		}
+	}
+
+	//	literals that goes through both fast and fallback path
+	{
+		FString JsonStr = TEXT(R"(
+			[
+				0, -0, 1, 0.1, 0.3, 3.1416, 1e23, 8.98846567431158e307,
+				2.2250738585072011e-308, 2.2250738585072012e-308, 4.9406564584124654e-324,
+				9007199254740993, 9007199254740992.5, 123456789012345678901234567890,
+				1.00000000000000011102230246251565404236316680908203125,
+				1.00000000000000011102230246251565404236316680908203124,
+				0.000000000000000000000000000000000000000000001e-300
+			]
+		)");
+
+		FDcJsonReader Reader(JsonStr);
+		FDcJsonReader LiteralReader(JsonStr);
+		UTEST_OK("JSON number literals", CheckJsonNumbersMatchAtod(this, Reader, LiteralReader));
+	}
+
+	return true;
+}
+
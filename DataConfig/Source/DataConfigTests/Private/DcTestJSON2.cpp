@@ -1,6 +1,7 @@
 #include "DataConfig/DcTypes.h"
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/Source/DcSourceStream.h"
 #include "DataConfig/Misc/DcTypeUtils.h"
 #include "DataConfig/SerDe/DcSerDeUtils.h"
 #include "DataConfig/Serialize/DcSerializeUtils.h"
@@ -12,6 +13,9 @@
 #include "DataConfig/Diagnostic/DcDiagnosticUtils.h"
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeExit.h"
 
 namespace DcTestJsonDetails
 {
@@ -108,6 +112,34 @@ DC_TEST("DataConfig.Core.JSON.WriterErrors")
 		UTEST_DIAG("WriterJson Errors", Writer.WriteArrayEnd(), DcDJSON, UnexpectedArrayEnd);
 	}
 
+	{
+		FDcJsonWriter Writer;
+		Writer.bCheckDuplicatedKey = true;
+
+		UTEST_OK("WriterJson Errors", Writer.WriteMapRoot());
+		for (int Ix = 0; Ix < 40; Ix++)
+		{
+			UTEST_OK("WriterJson Errors", Writer.WriteString(FString::Printf(TEXT("Key%d"), Ix)));
+			UTEST_OK("WriterJson Errors", Writer.WriteMapRoot());
+			UTEST_OK("WriterJson Errors", Writer.WriteString(TEXT("Key")));
+			UTEST_OK("WriterJson Errors", Writer.WriteInt32(Ix));
+			UTEST_OK("WriterJson Errors", Writer.WriteMapEnd());
+		}
+		UTEST_DIAG("WriterJson Errors", Writer.WriteName(TEXT("Key23")), DcDJSON, DuplicatedKey);
+	}
+
+	{
+		FDcAnsiJsonWriter Writer;
+		Writer.bCheckDuplicatedKey = true;
+
+		UTEST_OK("WriterJson Errors", Writer.WriteMapRoot());
+		UTEST_OK("WriterJson Errors", Writer.WriteString(TEXT("Key\n")));
+		UTEST_OK("WriterJson Errors", Writer.WriteNone());
+		UTEST_OK("WriterJson Errors", Writer.WriteString(TEXT("Key")));
+		UTEST_OK("WriterJson Errors", Writer.WriteNone());
+		UTEST_DIAG("WriterJson Errors", Writer.WriteString(TEXT("Key\n")), DcDJSON, DuplicatedKey);
+	}
+
 	return true;
 }
 
@@ -364,6 +396,38 @@ DC_TEST("DataConfig.Core.JSON.ReaderInts")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.JSON.ReaderIntOverflow")
+{
+	auto _ExpectFail = [](FString Str, auto Method, auto Dummy)
+	{
+		FDcJsonReader Reader(Str);
+		return (Reader.*Method)(&Dummy);
+	};
+
+	UTEST_DIAG("JsonReader int8 overflow", _ExpectFail("128", &FDcJsonReader::ReadInt8, int8{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader int8 overflow", _ExpectFail("-129", &FDcJsonReader::ReadInt8, int8{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader int32 overflow", _ExpectFail("2147483648", &FDcJsonReader::ReadInt32, int32{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader int64 overflow", _ExpectFail("9223372036854775808", &FDcJsonReader::ReadInt64, int64{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader int64 overflow", _ExpectFail("-9223372036854775809", &FDcJsonReader::ReadInt64, int64{}), DcDJSON, ParseIntegerFailed);
+
+	UTEST_DIAG("JsonReader uint8 overflow", _ExpectFail("256", &FDcJsonReader::ReadUInt8, uint8{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader uint32 negative", _ExpectFail("-1", &FDcJsonReader::ReadUInt32, uint32{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader uint64 overflow", _ExpectFail("18446744073709551616", &FDcJsonReader::ReadUInt64, uint64{}), DcDJSON, ParseIntegerFailed);
+	UTEST_DIAG("JsonReader uint64 overflow", _ExpectFail("99999999999999999999", &FDcJsonReader::ReadUInt64, uint64{}), DcDJSON, ParseIntegerFailed);
+
+	UTEST_DIAG("JsonReader int with exponent", _ExpectFail("1e5", &FDcJsonReader::ReadInt32, int32{}), DcDJSON, ParseIntegerFailed);
+
+	{
+		//	fractional part is still truncated
+		FDcJsonReader Reader(TEXT("-12.75"));
+		int32 Value;
+		UTEST_OK("JsonReader int truncate", Reader.ReadInt32(&Value));
+		UTEST_EQUAL("JsonReader int truncate", Value, -12);
+	}
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.JSON.ReaderFloats")
 {
 	using namespace DcTestJsonDetails;
@@ -534,6 +598,54 @@ DC_TEST("DataConfig.Core.JSON.FloatsRoundtrips")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.JSON.FastNumeric")
+{
+	FDcJsonWriter::ConfigType Config = FDcJsonWriter::CondenseConfig;
+	Config.bFastNumeric = true;
+
+	FDcJsonWriter Writer(Config);
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteArrayRoot());
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(0.1));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(0.1 + 0.2));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(-0.0));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(100.0));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(1e21));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(1.5e-7));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(5e-324));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteDouble(1.7976931348623157e308));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteFloat(0.1f));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteFloat(3.4028235e38f));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteInt64(MIN_int64));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteUInt64(MAX_uint64));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteInt8(0));
+	UTEST_OK("JsonWriter FastNumeric", Writer.WriteArrayEnd());
+
+	FString Str = Writer.Sb.ToString();
+	UTEST_EQUAL("JsonWriter FastNumeric", Str, TEXT("[0.1,0.30000000000000004,-0,100,1e+21,1.5e-7,5e-324,1.7976931348623157e+308,0.1,3.4028235e+38,-9223372036854775808,18446744073709551615,0]"));
+
+	FDcJsonReader Reader(Str);
+	double Double;
+	float Float;
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadArrayRoot());
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_EQUAL("JsonWriter FastNumeric", Double, 0.1);
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_EQUAL("JsonWriter FastNumeric", Double, 0.1 + 0.2);
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_EQUAL("JsonWriter FastNumeric", Double, 1.5e-7);
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_EQUAL("JsonWriter FastNumeric", Double, 5e-324);
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadDouble(&Double));
+	UTEST_EQUAL("JsonWriter FastNumeric", Double, 1.7976931348623157e308);
+	UTEST_OK("JsonWriter FastNumeric", Reader.ReadFloat(&Float));
+	UTEST_EQUAL("JsonWriter FastNumeric", Float, 0.1f);
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.JSON.WriteRawString")
 {
 	using namespace DcTestJsonDetails;
@@ -813,3 +925,176 @@ DC_TEST("DataConfig.Core.JSON.OverrideConfig")
 	return true;
 }
 
+
+DC_TEST("DataConfig.Core.JSON.Stream")
+{
+	FString Str = TEXT("[\n");
+	for (int Ix = 0; Ix < 2000; Ix++)
+	{
+		Str += FString::Printf(TEXT("\t{ \"Id\" : %d, \"Name\" : \"Item\\t%d \u4f60\u597d\", /* comment */ \"Values\" : [1.5, -2, 3e2] },\n"), Ix, Ix);
+	}
+	Str += TEXT("]");
+
+	auto _PipeToString = [](FDcReader* Reader, FString& OutStr) -> FDcResult
+	{
+		FDcJsonWriter Writer;
+		FDcPipeVisitor PipeVisitor(Reader, &Writer);
+		DC_TRY(PipeVisitor.PipeVisit());
+
+		OutStr = Writer.Sb.ToString();
+		return DcOk();
+	};
+
+	//	serve at most `MaxRead` bytes per call, which might split multi byte chars
+	auto _MakeStream = [](const uint8* Data, int64 Num, int64 MaxRead)
+	{
+		TSharedRef<int64> Offset = MakeShared<int64>(0);
+		return FDcCallbackSourceStream([=](uint8* Dst, int64 DstNum) -> int64
+		{
+			int64 ReadNum = FMath::Min3(DstNum, MaxRead, Num - *Offset);
+			FMemory::Memcpy(Dst, Data + *Offset, ReadNum);
+			*Offset += ReadNum;
+			return ReadNum;
+		});
+	};
+
+	FString Expect;
+	{
+		FDcJsonReader Reader(Str);
+		UTEST_OK("Json Stream", _PipeToString(&Reader, Expect));
+	}
+
+	FTCHARToUTF8 UTF8Str(*Str);
+	const int32 ChunkSizes[] = { 1, 7, 256, 64 * 1024 };
+	for (int32 ChunkSize : ChunkSizes)
+	{
+		{
+			FDcCallbackSourceStream Stream = _MakeStream((const uint8*)UTF8Str.Get(), UTF8Str.Length(), 5);
+			FDcAnsiJsonReader Reader;
+			Reader.StreamRetainNum = 64;
+			UTEST_OK("Json Stream", Reader.SetNewStream(&Stream, ChunkSize));
+
+			FString Actual;
+			UTEST_OK("Json Stream", _PipeToString(&Reader, Actual));
+			UTEST_EQUAL("Json Stream", Actual, Expect);
+			UTEST_EQUAL("Json Stream", Reader.State, FDcAnsiJsonReader::EState::FinishedStr);
+
+			//	window stays bounded instead of growing with the document
+			UTEST_TRUE("Json Stream", Reader.StreamBuf.Num() < FMath::Max(ChunkSize * 4, 4096));
+		}
+
+		{
+			FDcCallbackSourceStream Stream = _MakeStream((const uint8*)*Str, Str.Len() * sizeof(TCHAR), 3);
+			FDcWideJsonReader Reader;
+			UTEST_OK("Json Stream", Reader.SetNewStream(&Stream, ChunkSize));
+
+			FString Actual;
+			UTEST_OK("Json Stream", _PipeToString(&Reader, Actual));
+			UTEST_EQUAL("Json Stream", Actual, Expect);
+		}
+	}
+
+	{
+		//	unmatched close at the very end, after the window moved many times
+		FString BadStr = Str.LeftChop(1) + TEXT("}");
+		FTCHARToUTF8 UTF8BadStr(*BadStr);
+		FDcCallbackSourceStream Stream = _MakeStream((const uint8*)UTF8BadStr.Get(), UTF8BadStr.Length(), 1024);
+
+		FDcAnsiJsonReader Reader;
+		UTEST_OK("Json Stream", Reader.SetNewStream(&Stream, 256));
+		UTEST_DIAG("Json Stream", DcNoopPipeVisit(&Reader), DcDJSON, UnexpectedToken);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.JSON.MappedFile")
+{
+	FString Path = DcGetFixturePath(TEXT("Fixture_UTF8Roundtrip.json"));
+
+	TArray<uint8> Buf;
+	UTEST_TRUE("JSON MappedFile", FFileHelper::LoadFileToArray(Buf, *Path));
+
+	FDcAnsiJsonReader Reader;
+	UTEST_OK("JSON MappedFile", Reader.SetNewString((const char*)Buf.GetData(), Buf.Num()));
+	FDcAnsiPrettyJsonWriter Writer;
+	UTEST_OK("JSON MappedFile", FDcPipeVisitor(&Reader, &Writer).PipeVisit());
+
+	FDcMappedJsonReader MappedReader;
+	UTEST_OK("JSON MappedFile", MappedReader.OpenFile(*Path));
+	UTEST_TRUE("JSON MappedFile", MappedReader.Buf.Buffer == (const ANSICHAR*)MappedReader.File.GetData());
+	FDcAnsiPrettyJsonWriter MappedWriter;
+	UTEST_OK("JSON MappedFile", FDcPipeVisitor(&MappedReader, &MappedWriter).PipeVisit());
+
+	UTEST_EQUAL("JSON MappedFile", FString(Writer.Sb.ToString()), FString(MappedWriter.Sb.ToString()));
+
+	FDcMappedJsonReader MissingReader;
+	UTEST_DIAG("JSON MappedFile", MissingReader.OpenFile(*(Path + TEXT(".missing"))), DcDCommon, FileMapFailed);
+
+	{
+		//	failed reopen after a finished read leaves an empty reader instead of a view into the released mapping
+		FDcMappedJsonReader Reader;
+		UTEST_OK("JSON MappedFile", Reader.OpenFile(*Path));
+		UTEST_OK("JSON MappedFile", DcNoopPipeVisit(&Reader));
+		UTEST_DIAG("JSON MappedFile", Reader.OpenFile(*(Path + TEXT(".missing"))), DcDCommon, FileMapFailed);
+
+		EDcDataEntry Next;
+		UTEST_TRUE("JSON MappedFile", Reader.Buf.Num == 0);
+		UTEST_OK("JSON MappedFile", Reader.PeekRead(&Next));
+		UTEST_EQUAL("JSON MappedFile", Next, EDcDataEntry::Ended);
+	}
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.JSON.LongNumberAtEOF")
+{
+	//	more than 19 significant digits goes through the `Atod` fallback,
+	//	which must stop at the token even when it's the last byte of the source
+	const ANSICHAR* Prefix = "[99999999999999999999999999999999, ";
+	const ANSICHAR* Number = "12345678901234567890123.5";
+	const double Expect = FCString::Atod(TEXT("12345678901234567890123.5"));
+
+	FString Str = FString(Prefix) + FString(Number);
+	FTCHARToUTF8 UTF8Str(*Str);
+
+	{
+		//	stream with a small window, the long prefix leaves stale digits after the last token
+		const uint8* Data = (const uint8*)UTF8Str.Get();
+		const int64 Num = UTF8Str.Length();
+		int64 Offset = 0;
+		FDcCallbackSourceStream Stream([&](uint8* Dst, int64 DstNum) -> int64
+		{
+			int64 ReadNum = FMath::Min(DstNum, Num - Offset);
+			FMemory::Memcpy(Dst, Data + Offset, ReadNum);
+			Offset += ReadNum;
+			return ReadNum;
+		});
+
+		FDcAnsiJsonReader Reader;
+		Reader.StreamRetainNum = 0;
+		UTEST_OK("Json LongNumberAtEOF", Reader.SetNewStream(&Stream, 16));
+
+		double Value;
+		UTEST_OK("Json LongNumberAtEOF", Reader.ReadArrayRoot());
+		UTEST_OK("Json LongNumberAtEOF", Reader.ReadDouble(&Value));
+		UTEST_OK("Json LongNumberAtEOF", Reader.ReadDouble(&Value));
+		UTEST_EQUAL("Json LongNumberAtEOF", Value, Expect);
+	}
+
+	{
+		//	root number without trailing newline, mapping ends right after the last digit
+		FString Path = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("DcLongNumber"), TEXT(".json"));
+		UTEST_TRUE("Json LongNumberAtEOF", FFileHelper::SaveArrayToFile(TArrayView<const uint8>((const uint8*)Number, FCStringAnsi::Strlen(Number)), *Path));
+		ON_SCOPE_EXIT { IFileManager::Get().Delete(*Path); };
+
+		FDcMappedJsonReader Reader;
+		UTEST_OK("Json LongNumberAtEOF", Reader.OpenFile(*Path));
+
+		double Value;
+		UTEST_OK("Json LongNumberAtEOF", Reader.ReadDouble(&Value));
+		UTEST_EQUAL("Json LongNumberAtEOF", Value, Expect);
+	}
+
+	return true;
+}
@@ -15,6 +15,8 @@
 #include "DataConfig/MsgPack/DcMsgPackUtils.h"
 #include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
 #include "Misc/ScopeExit.h"
 
 namespace DcTestMsgPackDetails
@@ -327,6 +329,62 @@ DC_TEST("DataConfig.Core.MsgPack.Roundtrip_2")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.MsgPack.NestedHeaders")
+{
+	using namespace DcTestMsgPackDetails;
+
+	{
+		FDcMsgPackWriter Writer(64);
+
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayRoot());
+		for (int Ix = 0; Ix < 16; Ix++)
+			UTEST_OK("MsgPack NestedHeaders", Writer.WriteInt8(Ix));
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayEnd());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteMapRoot());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteInt8(1));
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayRoot());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayEnd());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteMapEnd());
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteInt8(2));
+		UTEST_EQUAL("MsgPack NestedHeaders", Writer.PendingHeaders.Num(), 4);
+		UTEST_OK("MsgPack NestedHeaders", Writer.WriteArrayEnd());
+		UTEST_EQUAL("MsgPack NestedHeaders", Writer.PendingHeaders.Num(), 0);
+
+		TArray<uint8> Expect = {0x93, 0xDC, 0x00, 0x10};
+		for (int Ix = 0; Ix < 16; Ix++)
+			Expect.Add((uint8)Ix);
+		Expect.Append({0x81, 0x01, 0x90, 0x02});
+
+		FDcMsgPackWriter::BufferType& Buffer = Writer.GetMainBuffer();
+		UTEST_EQUAL("MsgPack NestedHeaders", Buffer.Num(), Expect.Num());
+		UTEST_TRUE("MsgPack NestedHeaders", FPlatformMemory::Memcmp(Buffer.GetData(), Expect.GetData(), Expect.Num()) == 0);
+	}
+
+	UTEST_OK("MsgPack NestedHeaders", _TestWriter(this, [](FDcMsgPackWriter& Writer)
+	{
+		DC_TRY(Writer.WriteArrayRoot());
+		for (int Ix = 0; Ix < 4; Ix++)
+		{
+			DC_TRY(Writer.WriteMapRoot());
+			for (int Jx = 0; Jx < TNumericLimits<uint16>::Max() + 1; Jx++)
+			{
+				DC_TRY(Writer.WriteInt32(Jx));
+				DC_TRY(Writer.WriteArrayRoot());
+				for (int Kx = 0; Kx < Ix * 8; Kx++)
+					DC_TRY(Writer.WriteInt8(Kx));
+				DC_TRY(Writer.WriteArrayEnd());
+			}
+			DC_TRY(Writer.WriteMapEnd());
+		}
+		DC_TRY(Writer.WriteArrayEnd());
+
+		return DcOk();
+	}));
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.MsgPack.String_8_16_32")
 {
 	using namespace DcTestMsgPackDetails;
@@ -727,6 +785,19 @@ DC_TEST("DataConfig.Core.MsgPack.Diags")
 		UTEST_DIAG("MsgPack Diags", Reader.ReadInt32(&Value), DcDMsgPack, ReadPassMapEnd);
 	}
 
+	{
+		//	fixstr with an overlong UTF8 sequence
+		uint8 Bytes[] = { 0xA2, 0xC0, 0xAF };
+
+		FDcMsgPackReader Reader(FDcBlobViewData{Bytes, (int32)DcDimOf(Bytes)});
+		FString Str;
+		UTEST_DIAG("MsgPack Diags", Reader.ReadString(&Str), DcDMsgPack, InvalidUtf8);
+
+		FDcMsgPackReader ViewReader(FDcBlobViewData{Bytes, (int32)DcDimOf(Bytes)});
+		FDcStringViewData View;
+		UTEST_DIAG("MsgPack Diags", ViewReader.ReadStringView(&View), DcDMsgPack, InvalidUtf8);
+	}
+
 	return true;
 }
 
@@ -1181,3 +1252,58 @@ DC_TEST("DataConfig.Core.MsgPack.TestSuite")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.MsgPack.MappedFile")
+{
+	FDcMsgPackWriter Writer;
+	UTEST_OK("MsgPack MappedFile", Writer.WriteMapRoot());
+	UTEST_OK("MsgPack MappedFile", Writer.WriteString(TEXT("Str")));
+	UTEST_OK("MsgPack MappedFile", Writer.WriteString(TEXT("Foo")));
+	UTEST_OK("MsgPack MappedFile", Writer.WriteString(TEXT("Num")));
+	UTEST_OK("MsgPack MappedFile", Writer.WriteInt32(42));
+	UTEST_OK("MsgPack MappedFile", Writer.WriteMapEnd());
+
+	FDcMsgPackWriter::BufferType& Buffer = Writer.GetMainBuffer();
+	FString Path = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("DcMapped"), TEXT(".msgpack"));
+	UTEST_TRUE("MsgPack MappedFile", FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Buffer.GetData(), Buffer.Num()), *Path));
+	ON_SCOPE_EXIT { IFileManager::Get().Delete(*Path); };
+
+	{
+		FDcMappedMsgPackReader Reader;
+		UTEST_OK("MsgPack MappedFile", Reader.OpenFile(*Path));
+		UTEST_EQUAL("MsgPack MappedFile", Reader.File.Num(), Buffer.Num());
+
+		FString Str;
+		int32 Num;
+		UTEST_OK("MsgPack MappedFile", Reader.ReadMapRoot());
+		UTEST_OK("MsgPack MappedFile", Reader.ReadString(nullptr));
+		UTEST_OK("MsgPack MappedFile", Reader.ReadString(&Str));
+		UTEST_OK("MsgPack MappedFile", Reader.ReadString(nullptr));
+		UTEST_OK("MsgPack MappedFile", Reader.ReadInt32(&Num));
+		UTEST_OK("MsgPack MappedFile", Reader.ReadMapEnd());
+
+		UTEST_EQUAL("MsgPack MappedFile", Str, TEXT("Foo"));
+		UTEST_EQUAL("MsgPack MappedFile", Num, 42);
+	}
+
+	{
+		FDcMappedMsgPackReader Reader;
+		UTEST_DIAG("MsgPack MappedFile", Reader.OpenFile(*(Path + TEXT(".missing"))), DcDCommon, FileMapFailed);
+	}
+
+	{
+		//	failed reopen mid read leaves an empty reader instead of a view into the released mapping
+		FDcMappedMsgPackReader Reader;
+		UTEST_OK("MsgPack MappedFile", Reader.OpenFile(*Path));
+		UTEST_OK("MsgPack MappedFile", Reader.ReadMapRoot());
+		UTEST_DIAG("MsgPack MappedFile", Reader.OpenFile(*(Path + TEXT(".missing"))), DcDCommon, FileMapFailed);
+
+		EDcDataEntry Next;
+		UTEST_TRUE("MsgPack MappedFile", Reader.View.Num == 0);
+		UTEST_TRUE("MsgPack MappedFile", Reader.States.Num() == 1);
+		UTEST_OK("MsgPack MappedFile", Reader.PeekRead(&Next));
+		UTEST_EQUAL("MsgPack MappedFile", Next, EDcDataEntry::Ended);
+	}
+
+	return true;
+}
+
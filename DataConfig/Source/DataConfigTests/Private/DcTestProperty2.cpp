@@ -2,6 +2,7 @@
 #include "DataConfig/Extra/Misc/DcTestCommon.h"
 #include "DataConfig/Automation/DcAutomation.h"
 #include "DataConfig/Automation/DcAutomationUtils.h"
+#include "DataConfig/SerDe/DcEnumTable.h"
 
 DC_TEST("DataConfig.Core.Property.NestedStruct")
 {
@@ -80,6 +81,56 @@ DC_TEST("DataConfig.Core.Property.Config")
 	return true;
 }
 
+DC_TEST("DataConfig.Core.Property.ConfigTableCache")
+{
+	UScriptStruct* Struct = FDcTestStructSimple::StaticStruct();
+
+	FDcPropertyConfig DefaultConfig = FDcPropertyConfig::MakeDefault();
+	FDcPropertyConfig NoExpandConfig = FDcPropertyConfig::MakeNoExpandObject();
+	const FDcPropertyTable* Table = DefaultConfig.FindTable(Struct);
+	UTEST_TRUE("Property Config Table Cache", Table != nullptr);
+	UTEST_TRUE("Property Config Table Cache", Table == NoExpandConfig.FindTable(Struct));
+	UTEST_EQUAL("Property Config Table Cache", Table->Num(), 2);
+	UTEST_EQUAL("Property Config Table Cache", Table->FindIndex(TEXT("NameField")), 0);
+	UTEST_EQUAL("Property Config Table Cache", Table->FindIndex(TEXT("StrField")), 1);
+	UTEST_EQUAL("Property Config Table Cache", Table->FindIndex(TEXT("NotExist")), INDEX_NONE);
+
+	//	later lookups hit the config's own tables
+	UTEST_TRUE("Property Config Table Cache", DefaultConfig.LocalTables.FindRef(Struct).Get() == Table);
+	UTEST_TRUE("Property Config Table Cache", Table == DefaultConfig.FindTable(Struct));
+
+	//	rebinding predicate disables stale cache
+	FDcPropertyConfig IgnoreStrConfig = FDcPropertyConfig::MakeDefault();
+	IgnoreStrConfig.ProcessPropertyPredicate.BindLambda([](FProperty* Property){
+		return !Property->IsA<FStrProperty>();
+	});
+	UTEST_TRUE("Property Config Table Cache", IgnoreStrConfig.FindTable(Struct) == nullptr);
+
+	IgnoreStrConfig.EnableTableCache();
+	const FDcPropertyTable* IgnoreStrTable = IgnoreStrConfig.FindTable(Struct);
+	UTEST_TRUE("Property Config Table Cache", IgnoreStrTable != nullptr && IgnoreStrTable != Table);
+	UTEST_EQUAL("Property Config Table Cache", IgnoreStrTable->Num(), 1);
+	UTEST_EQUAL("Property Config Table Cache", IgnoreStrTable->FindIndex(TEXT("StrField")), INDEX_NONE);
+
+	FDcTestStructSimple Source;
+	Source.NameField = TEXT("Named");
+	Source.StrField = TEXT("Stred");
+
+	FDcTestStructSimple Dest;
+
+	FDcPropertyReader Reader{FDcPropertyDatum(&Source)};
+	FDcPropertyWriter Writer{FDcPropertyDatum(&Dest)};
+
+	UTEST_OK("Property Config Table Cache", Reader.SetConfig(IgnoreStrConfig));
+	UTEST_OK("Property Config Table Cache", Writer.SetConfig(IgnoreStrConfig));
+	UTEST_OK("Property Config Table Cache", DcPropertyPipeVisit(Reader, Writer));
+
+	UTEST_TRUE("Property Config Table Cache", Dest.NameField == TEXT("Named"));
+	UTEST_TRUE("Property Config Table Cache", Dest.StrField.IsEmpty());
+
+	return true;
+}
+
 DC_TEST("DataConfig.Core.Property.DefaultValue")
 {
 	FDcTestStructDefaultValue2 Source;
@@ -120,3 +171,51 @@ DC_TEST("DataConfig.Core.Property.EnumNamespace")
 
 	return true;
 }
+
+DC_TEST("DataConfig.Core.Property.EnumTable")
+{
+	{
+		TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Table = FDcEnumTable::Get(StaticEnum<EDcTestEnum_UInt8>());
+		UTEST_TRUE("Enum Table", &Table.Get() == &FDcEnumTable::Get(StaticEnum<EDcTestEnum_UInt8>()).Get());
+		UTEST_TRUE("Enum Table", Table->DenseIndices.Num() == 0);
+
+		int64 Value;
+		UTEST_TRUE("Enum Table", Table->FindValueByName(FDcStringViewData::FromOwned(TEXT("Max")), Value));
+		UTEST_EQUAL("Enum Table", Value, (int64)EDcTestEnum_UInt8::Max);
+		UTEST_TRUE("Enum Table", Table->FindValueByName(FDcStringViewData::FromOwned(TEXT("EDcTestEnum_UInt8::Max")), Value));
+		UTEST_EQUAL("Enum Table", Value, (int64)EDcTestEnum_UInt8::Max);
+		UTEST_TRUE("Enum Table", Table->FindValueByName(FDcStringViewData::FromAscii("zero", 4), Value));
+		UTEST_EQUAL("Enum Table", Value, (int64)EDcTestEnum_UInt8::Zero);
+		UTEST_FALSE("Enum Table", Table->FindValueByName(FDcStringViewData::FromOwned(TEXT("Min")), Value));
+
+		int32 Ix = Table->FindIndexByValue((int64)EDcTestEnum_UInt8::Max);
+		UTEST_TRUE("Enum Table", Ix != INDEX_NONE && Table->Names[Ix] == TEXT("Max"));
+		UTEST_EQUAL("Enum Table", Table->FindIndexByValue(17), INDEX_NONE);
+	}
+
+	{
+		//	value range too wide for dense indices
+		TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Table = FDcEnumTable::Get(StaticEnum<EDcTestEnum_Int64>());
+		UTEST_TRUE("Enum Table", Table->DenseIndices.Num() == 0);
+
+		for (EDcTestEnum_Int64 Value : {EDcTestEnum_Int64::Zero, EDcTestEnum_Int64::Min, EDcTestEnum_Int64::Max})
+		{
+			int32 Ix = Table->FindIndexByValue((int64)Value);
+			UTEST_TRUE("Enum Table", Ix != INDEX_NONE);
+			UTEST_EQUAL("Enum Table", Table->Values[Ix], (int64)Value);
+		}
+	}
+
+	{
+		TSharedRef<const FDcEnumTable, ESPMode::ThreadSafe> Table = FDcEnumTable::Get(StaticEnum<EDcTestEnum_Flag>());
+		UTEST_TRUE("Enum Table", Table->DenseIndices.Num() != 0);
+		UTEST_TRUE("Enum Table", Table->FlagIndices.Contains(Table->FindIndexByValue((int64)EDcTestEnum_Flag::Alpha)));
+		UTEST_FALSE("Enum Table", Table->FlagIndices.Contains(Table->FindIndexByValue((int64)EDcTestEnum_Flag::Zero)));
+		UTEST_EQUAL("Enum Table", Table->Names[Table->FindIndexByValue((int64)EDcTestEnum_Flag::Gamma)], FString(TEXT("Gamma")));
+#if WITH_EDITORONLY_DATA
+		UTEST_TRUE("Enum Table", Table->bIsBitFlags);
+#endif // WITH_EDITORONLY_DATA
+	}
+
+	return true;
+}
@@ -3,9 +3,13 @@
 #include "DataConfig/Automation/DcAutomationUtils.h"
 #include "DataConfig/Reader/DcReader.h"
 #include "DataConfig/Reader/DcPutbackReader.h"
+#include "DataConfig/Reader/DcTapeReader.h"
 #include "DataConfig/Property/DcPropertyReader.h"
 #include "DataConfig/Json/DcJsonReader.h"
 #include "DataConfig/MsgPack/DcMsgPackReader.h"
+#include "DataConfig/MsgPack/DcMsgPackWriter.h"
+#include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DcTestProperty.h"
 
 DC_TEST("DataConfig.Core.Reader.Cast")
 {
@@ -80,3 +84,274 @@ DC_TEST("DataConfig.Core.Reader.Cast")
 }
 
 
+DC_TEST("DataConfig.Core.Reader.StringView")
+{
+	using EType = FDcStringViewData::EType;
+
+	auto _ExpectView = [this](FDcReader& Reader, const TCHAR* Expect, EType ExpectType)
+	{
+		FDcStringViewData View;
+		if (!Reader.ReadStringView(&View).Ok())
+			return false;
+
+		return TestEqual("StringView type", (int)View.Type, (int)ExpectType)
+			&& TestTrue("StringView equals", View.Equals(Expect))
+			&& TestEqual("StringView to string", View.ToString(), FString(Expect));
+	};
+
+	const TCHAR* Json = TEXT(R"( ["plain", "escaped\n", "中文", 123.5] )");
+
+	{
+		FTCHARToUTF8 UTF8Json(Json);
+		FDcAnsiJsonReader Reader(UTF8Json.Get(), UTF8Json.Length());
+		UTEST_OK("StringView", Reader.ReadArrayRoot());
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("plain"), EType::Ascii));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("escaped\n"), EType::Owned));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("中文"), EType::Utf8));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("123.5"), EType::Ascii));
+		UTEST_OK("StringView", Reader.ReadArrayEnd());
+	}
+
+	{
+		FDcJsonReader Reader(Json);
+		UTEST_OK("StringView", Reader.ReadArrayRoot());
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("plain"), EType::Tchar));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("escaped\n"), EType::Owned));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("中文"), EType::Tchar));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("123.5"), EType::Tchar));
+		UTEST_OK("StringView", Reader.ReadArrayEnd());
+	}
+
+	{
+		FDcMsgPackWriter Writer;
+		UTEST_OK("StringView", Writer.WriteArrayRoot());
+		UTEST_OK("StringView", Writer.WriteString(TEXT("plain")));
+		UTEST_OK("StringView", Writer.WriteString(TEXT("中文")));
+		UTEST_OK("StringView", Writer.WriteName(TEXT("Name")));
+		UTEST_OK("StringView", Writer.WriteArrayEnd());
+		FDcMsgPackWriter::BufferType Buffer = Writer.GetMainBuffer();
+
+		FDcMsgPackReader Reader(FDcBlobViewData::From(Buffer));
+		UTEST_OK("StringView", Reader.ReadArrayRoot());
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("plain"), EType::Ascii));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("中文"), EType::Utf8));
+
+		FName Name;
+		UTEST_OK("StringView", Reader.ReadName(&Name));
+		UTEST_EQUAL("StringView", Name, FName(TEXT("Name")));
+		UTEST_OK("StringView", Reader.ReadArrayEnd());
+	}
+
+	{
+		FDcJsonReader JsonReader(TEXT(R"( {"Key" : "Value"} )"));
+		FDcPutbackReader Reader(&JsonReader);
+		UTEST_OK("StringView", Reader.ReadMapRoot());
+
+		FName Key;
+		UTEST_OK("StringView", Reader.ReadName(&Key));
+		UTEST_EQUAL("StringView", Key, FName(TEXT("Key")));
+
+		Reader.Putback(FString(TEXT("Putback")));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("Putback"), EType::Owned));
+		UTEST_TRUE("StringView", _ExpectView(Reader, TEXT("Value"), EType::Tchar));
+		UTEST_OK("StringView", Reader.ReadMapEnd());
+	}
+
+	return true;
+}
+
+
+DC_TEST("DataConfig.Core.Reader.Tape")
+{
+	FDcJsonReader JsonReader(TEXT(R"(
+		{
+			"Nested" : { "A" : [1, 2, [3]], "B" : null },
+			"Num" : 123,
+			"Str" : "Foo",
+			"$type" : "Bar"
+		}
+	)"));
+
+	FDcTape Tape;
+	UTEST_OK("Tape", Tape.Build(&JsonReader));
+
+	FDcTapeReader Reader(&Tape);
+	UTEST_OK("Tape", Reader.ReadMapRoot());
+
+	int32 Size;
+	UTEST_OK("Tape", Reader.PeekContainerSize(&Size));
+	UTEST_EQUAL("Tape", Size, 4);
+
+	//	lookup doesn't move the reader and hides the pair
+	FString Type;
+	bool bFound;
+	UTEST_OK("Tape", Reader.ReadMapStringByKey(TEXT("$type"), &Type, &bFound));
+	UTEST_TRUE("Tape", bFound);
+	UTEST_EQUAL("Tape", Type, TEXT("Bar"));
+	UTEST_EQUAL("Tape", Reader.FindMapKey(TEXT("Missing")), INDEX_NONE);
+	UTEST_OK("Tape", Reader.PeekContainerSize(&Size));
+	UTEST_EQUAL("Tape", Size, 3);
+
+	FString Key;
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_EQUAL("Tape", Key, TEXT("Nested"));
+	UTEST_OK("Tape", Reader.SkipValue());
+
+	int32 NumPosition = Reader.GetPosition();
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_EQUAL("Tape", Key, TEXT("Num"));
+
+	//	number literals read as whatever is asked for
+	uint8 U8;
+	UTEST_OK("Tape", Reader.ReadUInt8(&U8));
+	UTEST_EQUAL("Tape", U8, 123);
+	Reader.Rewind(NumPosition + 1);
+	float F;
+	UTEST_OK("Tape", Reader.ReadFloat(&F));
+	UTEST_EQUAL("Tape", F, 123.0f);
+	Reader.Rewind(NumPosition + 1);
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_EQUAL("Tape", Key, TEXT("123"));
+
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_EQUAL("Tape", Key, TEXT("Str"));
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_EQUAL("Tape", Key, TEXT("Foo"));
+
+	//	$type pair is skipped over
+	UTEST_OK("Tape", Reader.ReadMapEnd());
+
+	EDcDataEntry Next;
+	UTEST_OK("Tape", Reader.PeekRead(&Next));
+	UTEST_EQUAL("Tape", (int)Next, (int)EDcDataEntry::Ended);
+
+	//	ignored keys end with their map
+	UTEST_EQUAL("Tape", Reader.IgnoredKeys.Num(), 0);
+
+	//	second pass from the start sees `$type` again
+	Reader.Rewind(0);
+	UTEST_OK("Tape", Reader.ReadMapRoot());
+	UTEST_OK("Tape", Reader.PeekContainerSize(&Size));
+	UTEST_EQUAL("Tape", Size, 4);
+	UTEST_TRUE("Tape", Reader.FindMapKey(TEXT("$type")) != INDEX_NONE);
+
+	//	rewinding out of a map drops its ignored keys
+	UTEST_OK("Tape", Reader.ReadMapStringByKey(TEXT("$type"), &Type, &bFound));
+	UTEST_TRUE("Tape", bFound);
+	UTEST_EQUAL("Tape", Reader.IgnoredKeys.Num(), 1);
+	Reader.Rewind(0);
+	UTEST_EQUAL("Tape", Reader.IgnoredKeys.Num(), 0);
+
+	UTEST_OK("Tape", Reader.ReadMapRoot());
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_OK("Tape", Reader.ReadMapRoot());
+	UTEST_OK("Tape", Reader.ReadString(&Key));
+	UTEST_OK("Tape", Reader.ReadArrayRoot());
+	UTEST_OK("Tape", Reader.PeekContainerSize(&Size));
+	UTEST_EQUAL("Tape", Size, 3);
+
+	int32 I32;
+	UTEST_OK("Tape", Reader.ReadInt32(&I32));
+	UTEST_EQUAL("Tape", I32, 1);
+	UTEST_OK("Tape", Reader.PeekContainerSize(&Size));
+	UTEST_EQUAL("Tape", Size, 2);
+
+	return true;
+}
+
+DC_TEST("DataConfig.Core.Reader.SkipValue")
+{
+	{
+		FDcJsonReader Reader(TEXT(R"(
+			{
+				"Skip1" : { "A" : [1, "]}", {"B" : null}], /* ] */ "C" : true },
+				"Keep" : 123,
+				"Skip2" : [ "\"[" ],
+				"Skip3" : "Str"
+			}
+		)"));
+
+		FString Key;
+		UTEST_OK("SkipValue", Reader.ReadMapRoot());
+		UTEST_OK("SkipValue", Reader.ReadString(&Key));
+		UTEST_EQUAL("SkipValue", Key, TEXT("Skip1"));
+		UTEST_OK("SkipValue", Reader.SkipValue());
+
+		int32 I32;
+		UTEST_OK("SkipValue", Reader.ReadString(&Key));
+		UTEST_EQUAL("SkipValue", Key, TEXT("Keep"));
+		UTEST_OK("SkipValue", Reader.ReadInt32(&I32));
+		UTEST_EQUAL("SkipValue", I32, 123);
+
+		//	skip both key and value
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.SkipValue());
+
+		UTEST_OK("SkipValue", Reader.ReadString(&Key));
+		UTEST_EQUAL("SkipValue", Key, TEXT("Skip3"));
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.ReadMapEnd());
+		UTEST_OK("SkipValue", Reader.FinishRead());
+	}
+
+	{
+		//	skipped keys are still checked for duplicates
+		FDcJsonReader Reader(TEXT(R"({ "Dup" : 1, "Dup" : 2 })"));
+
+		UTEST_OK("SkipValue", Reader.ReadMapRoot());
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_DIAG("SkipValue", Reader.SkipValue(), DcDJSON, DuplicatedKey);
+	}
+
+	{
+		uint8 Bytes[] = {1, 2, 3};
+
+		FDcMsgPackWriter Writer;
+		UTEST_OK("SkipValue", Writer.WriteMapRoot());
+		UTEST_OK("SkipValue", Writer.WriteString(TEXT("Skip")));
+		UTEST_OK("SkipValue", Writer.WriteArrayRoot());
+		UTEST_OK("SkipValue", Writer.WriteInt64(-123456789));
+		UTEST_OK("SkipValue", Writer.WriteString(TEXT("Str")));
+		UTEST_OK("SkipValue", Writer.WriteBlob(FDcBlobViewData{Bytes, (int32)DcDimOf(Bytes)}));
+		UTEST_OK("SkipValue", Writer.WriteMapRoot());
+		UTEST_OK("SkipValue", Writer.WriteString(TEXT("Nested")));
+		UTEST_OK("SkipValue", Writer.WriteDouble(1.5));
+		UTEST_OK("SkipValue", Writer.WriteMapEnd());
+		UTEST_OK("SkipValue", Writer.WriteArrayEnd());
+		UTEST_OK("SkipValue", Writer.WriteString(TEXT("Keep")));
+		UTEST_OK("SkipValue", Writer.WriteString(TEXT("Value")));
+		UTEST_OK("SkipValue", Writer.WriteMapEnd());
+		FDcMsgPackWriter::BufferType Buffer = Writer.GetMainBuffer();
+
+		FDcMsgPackReader Reader(FDcBlobViewData::From(Buffer));
+		FString Str;
+		UTEST_OK("SkipValue", Reader.ReadMapRoot());
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.ReadString(&Str));
+		UTEST_EQUAL("SkipValue", Str, TEXT("Keep"));
+		UTEST_OK("SkipValue", Reader.ReadString(&Str));
+		UTEST_EQUAL("SkipValue", Str, TEXT("Value"));
+		UTEST_OK("SkipValue", Reader.ReadMapEnd());
+	}
+
+	{
+		FDcTestStruct3 Source;
+		Source.MakeFixtureNoStructMap();
+
+		FDcPropertyReader Reader{FDcPropertyDatum(&Source)};
+		FName Name;
+		UTEST_OK("SkipValue", Reader.ReadStructRoot());
+		UTEST_OK("SkipValue", Reader.ReadName(&Name));
+		UTEST_EQUAL("SkipValue", Name, FName(TEXT("StringArray")));
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.ReadName(&Name));
+		UTEST_EQUAL("SkipValue", Name, FName(TEXT("StringSet")));
+		UTEST_OK("SkipValue", Reader.SkipValue());
+		UTEST_OK("SkipValue", Reader.ReadName(&Name));
+		UTEST_EQUAL("SkipValue", Name, FName(TEXT("StringMap")));
+	}
+
+	return true;
+}
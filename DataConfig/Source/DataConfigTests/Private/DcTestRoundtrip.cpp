@@ -310,3 +310,75 @@ DC_TEST("DataConfig.Core.RoundTrip.MsgPack_Persistent_StringSoftLazy")
 }
 
 
+
+DC_TEST("DataConfig.Core.RoundTrip.JsonRoundtrip_ResolutionCache")
+{
+	UDcTestRoundtrip1* Source = NewObject<UDcTestRoundtrip1>();
+	Source->StructPrimitives.MakeFixture();
+	Source->StructEnumFlag.MakeFixture();
+	Source->StructArrayDims.MakeFixture();
+	Source->StructContainers.MakeFixtureFull();
+	Source->StructOthers.MakeFixture();
+	Source->StructInlineSub.MakeFixture();
+	Source->StructObjectRefs.MakeFixture();
+	Source->StructClassRefs.MakeFixture();
+	FDcPropertyDatum SourceDatum(Source);
+
+	FDcSerializer Serializer;
+	DcSetupJsonSerializeHandlers(Serializer, EDcJsonSerializeType::Default);
+	Serializer.bUseResolutionCache = true;
+
+	FDcDeserializer Deserializer;
+	DcSetupJsonDeserializeHandlers(Deserializer, EDcJsonDeserializeType::Default);
+	Deserializer.bUseResolutionCache = true;
+
+	auto _Roundtrip = [&]() -> FDcResult
+	{
+		FDcJsonWriter JsonWriter;
+		{
+			FDcPropertyReader Reader(SourceDatum);
+			FDcSerializeContext Ctx;
+			Ctx.Reader = &Reader;
+			Ctx.Writer = &JsonWriter;
+			Ctx.Serializer = &Serializer;
+			DC_TRY(Ctx.Prepare());
+			DC_TRY(Serializer.Serialize(Ctx));
+		}
+
+		FString Json = JsonWriter.Sb.ToString();
+		UDcTestRoundtrip1* Dest = NewObject<UDcTestRoundtrip1>();
+		FDcPropertyDatum DestDatum(Dest);
+		{
+			FDcJsonReader Reader(Json);
+			FDcPropertyWriter Writer(DestDatum);
+			FDcDeserializeContext Ctx;
+			Ctx.Reader = &Reader;
+			Ctx.Writer = &Writer;
+			Ctx.Deserializer = &Deserializer;
+			Ctx.Objects.Add(GetTransientPackage());
+			DC_TRY(Ctx.Prepare());
+			DC_TRY(Deserializer.Deserialize(Ctx));
+		}
+
+		return DcAutomationUtils::TestReadDatumEqual(SourceDatum, DestDatum);
+	};
+
+	UTEST_OK("Json SerDe Roundtrip Resolution Cache", _Roundtrip());
+	UTEST_TRUE("Json SerDe Roundtrip Resolution Cache", Serializer.ResolutionStats.Hits > 0);
+	UTEST_TRUE("Json SerDe Roundtrip Resolution Cache", Deserializer.ResolutionStats.Hits > 0);
+
+	//	second pass only misses on values decided by impure predicates, which is the same count
+	int32 SerializeMisses = Serializer.ResolutionStats.Misses;
+	int32 DeserializeMisses = Deserializer.ResolutionStats.Misses;
+	int32 SerializeCached = Serializer.ResolutionCache.Num();
+	int32 DeserializeCached = Deserializer.ResolutionCache.Num();
+
+	UTEST_OK("Json SerDe Roundtrip Resolution Cache", _Roundtrip());
+	UTEST_EQUAL("Json SerDe Roundtrip Resolution Cache", Serializer.ResolutionCache.Num(), SerializeCached);
+	UTEST_EQUAL("Json SerDe Roundtrip Resolution Cache", Deserializer.ResolutionCache.Num(), DeserializeCached);
+	UTEST_TRUE("Json SerDe Roundtrip Resolution Cache", Serializer.ResolutionStats.Misses - SerializeMisses < SerializeMisses);
+	UTEST_TRUE("Json SerDe Roundtrip Resolution Cache", Deserializer.ResolutionStats.Misses - DeserializeMisses < DeserializeMisses);
+
+	return true;
+}
+
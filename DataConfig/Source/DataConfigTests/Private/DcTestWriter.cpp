@@ -6,8 +6,14 @@
 #include "DataConfig/Writer/DcPrettyPrintWriter.h"
 #include "DataConfig/Writer/DcWeakCompositeWriter.h"
 #include "DataConfig/Json/DcJsonWriter.h"
+#include "DataConfig/MsgPack/DcMsgPackReader.h"
 #include "DataConfig/MsgPack/DcMsgPackWriter.h"
+#include "DataConfig/Misc/DcPipeVisitor.h"
 #include "DataConfig/Property/DcPropertyWriter.h"
+#include "DataConfig/Source/DcSinkStream.h"
+#include "DataConfig/Diagnostic/DcDiagnosticJSON.h"
+#include "DataConfig/Diagnostic/DcDiagnosticReadWrite.h"
+#include "Serialization/MemoryWriter.h"
 
 DC_TEST("DataConfig.Core.Writer.Cast")
 {
@@ -120,6 +126,181 @@ DC_TEST("DataConfig.Core.Writer.Cast")
 	return true;
 }
 
+namespace DcTestWriterDetails
+{
+
+static FDcResult WriteSinkFixture(FDcWriter& Writer)
+{
+	DC_TRY(Writer.WriteArrayRoot());
+	for (int Ix = 0; Ix < 100; Ix++)
+	{
+		DC_TRY(Writer.WriteMapRoot());
+		DC_TRY(Writer.WriteString(TEXT("Name")));
+		DC_TRY(Writer.WriteString(FString::Printf(TEXT("Item\u4f60%d"), Ix)));
+		DC_TRY(Writer.WriteString(TEXT("Id")));
+		DC_TRY(Writer.WriteInt32(Ix));
+		DC_TRY(Writer.WriteMapEnd());
+	}
+	DC_TRY(Writer.WriteArrayEnd());
+	return DcOk();
+}
+
+//	sink output can have 32bit container headers, pipe it into a plain writer to compare
+static FDcResult PipeMsgPackInto(TArray<uint8>& Bytes, FDcMsgPackWriter& Writer)
+{
+	FDcMsgPackReader Reader(FDcBlobViewData{Bytes.GetData(), Bytes.Num()});
+	FDcPipeVisitor PipeVisitor(&Reader, &Writer);
+	return PipeVisitor.PipeVisit();
+}
+
+} // namespace DcTestWriterDetails
+
+DC_TEST("DataConfig.Core.Writer.Sink")
+{
+	using namespace DcTestWriterDetails;
+
+	{
+		FDcJsonWriter Expect;
+		UTEST_OK("Writer Sink", WriteSinkFixture(Expect));
+		FTCHARToUTF8 ExpectUTF8(Expect.Sb.ToString(), Expect.Sb.Len());
+
+		int32 MaxChunk = 0;
+		TArray<uint8> Bytes;
+		FDcCallbackSinkStream Sink([&](const uint8* Src, int64 Num)
+		{
+			MaxChunk = FMath::Max(MaxChunk, (int32)Num);
+			Bytes.Append(Src, (int32)Num);
+			return true;
+		});
+
+		FDcJsonWriter Writer;
+		Writer.bCheckDuplicatedKey = true;
+		UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 64));
+		UTEST_OK("Writer Sink", WriteSinkFixture(Writer));
+		UTEST_OK("Writer Sink", Writer.FlushSink());
+
+		UTEST_TRUE("Writer Sink", MaxChunk < 256);
+		UTEST_EQUAL("Writer Sink", Writer.Sb.Len(), 0);
+		UTEST_EQUAL("Writer Sink", Bytes.Num(), ExpectUTF8.Length());
+		UTEST_TRUE("Writer Sink", FPlatformMemory::Memcmp(Bytes.GetData(), ExpectUTF8.Get(), Bytes.Num()) == 0);
+	}
+
+	{
+		FDcAnsiJsonWriter Expect;
+		UTEST_OK("Writer Sink", WriteSinkFixture(Expect));
+
+		FDcArraySinkStream Sink;
+		FDcAnsiJsonWriter Writer;
+		UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 64));
+		UTEST_OK("Writer Sink", WriteSinkFixture(Writer));
+		UTEST_OK("Writer Sink", Writer.FlushSink());
+
+		TArray<uint8> Bytes = Sink.TakeBytes();
+		UTEST_EQUAL("Writer Sink", Sink.Bytes.Num(), 0);
+		UTEST_EQUAL("Writer Sink", Bytes.Num(), Expect.Sb.Len());
+		UTEST_TRUE("Writer Sink", FPlatformMemory::Memcmp(Bytes.GetData(), Expect.Sb.GetData(), Bytes.Num()) == 0);
+	}
 
+	{
+		//	keys are still checked after the object start is flushed
+		FDcArraySinkStream Sink;
+		FDcCondensedJsonWriter Writer;
+		Writer.bCheckDuplicatedKey = true;
+		UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 1));
+
+		UTEST_OK("Writer Sink", Writer.WriteMapRoot());
+		UTEST_OK("Writer Sink", Writer.WriteString(TEXT("Foo")));
+		UTEST_OK("Writer Sink", Writer.WriteInt32(1));
+		UTEST_OK("Writer Sink", Writer.WriteString(TEXT("Bar")));
+		UTEST_OK("Writer Sink", Writer.WriteMapRoot());
+		UTEST_OK("Writer Sink", Writer.WriteString(TEXT("Foo")));
+		UTEST_OK("Writer Sink", Writer.WriteInt32(2));
+		UTEST_OK("Writer Sink", Writer.WriteMapEnd());
+		UTEST_EQUAL("Writer Sink", Writer.Sb.Len(), 0);
+		UTEST_DIAG("Writer Sink", Writer.WriteString(TEXT("Foo")), DcDJSON, DuplicatedKey);
+	}
+
+	{
+		FDcMsgPackWriter Expect;
+		UTEST_OK("Writer Sink", WriteSinkFixture(Expect));
+		for (int Ix = 0; Ix < 100; Ix++)
+			UTEST_OK("Writer Sink", Expect.WriteInt32(Ix));
+
+		{
+			//	callback sink can't patch, containers are held until they end
+			TArray<uint8> Bytes;
+			FDcCallbackSinkStream Sink([&Bytes](const uint8* Src, int64 Num)
+			{
+				Bytes.Append(Src, (int32)Num);
+				return true;
+			});
+
+			FDcMsgPackWriter Writer;
+			UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 64));
+			UTEST_FALSE("Writer Sink", Writer.bSinkPatchHeaders);
+			UTEST_OK("Writer Sink", WriteSinkFixture(Writer));
+			UTEST_EQUAL("Writer Sink", Writer.Buffer.Num(), 0);
+
+			//	root level values are flushed as they go
+			for (int Ix = 0; Ix < 100; Ix++)
+				UTEST_OK("Writer Sink", Writer.WriteInt32(Ix));
+			UTEST_TRUE("Writer Sink", Writer.Buffer.Num() < 64);
+			UTEST_OK("Writer Sink", Writer.FlushSink());
+
+			UTEST_EQUAL("Writer Sink", Bytes.Num(), Expect.Buffer.Num());
+			UTEST_TRUE("Writer Sink", FPlatformMemory::Memcmp(Bytes.GetData(), Expect.Buffer.GetData(), Bytes.Num()) == 0);
+		}
+
+		{
+			//	array sink widens containers open on flush to 32bit headers and patches them on end
+			FDcArraySinkStream Sink;
+			FDcMsgPackWriter Writer;
+			UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 64));
+			UTEST_TRUE("Writer Sink", Writer.bSinkPatchHeaders);
+
+			UTEST_OK("Writer Sink", Writer.WriteArrayRoot());
+			for (int Ix = 0; Ix < 100; Ix++)
+			{
+				UTEST_OK("Writer Sink", Writer.WriteMapRoot());
+				UTEST_OK("Writer Sink", Writer.WriteString(TEXT("Name")));
+				UTEST_OK("Writer Sink", Writer.WriteString(FString::Printf(TEXT("Item\u4f60%d"), Ix)));
+				UTEST_OK("Writer Sink", Writer.WriteString(TEXT("Id")));
+				UTEST_OK("Writer Sink", Writer.WriteInt32(Ix));
+				UTEST_OK("Writer Sink", Writer.WriteMapEnd());
+				UTEST_TRUE("Writer Sink", Writer.Buffer.Num() < 64);
+			}
+			UTEST_OK("Writer Sink", Writer.WriteArrayEnd());
+
+			for (int Ix = 0; Ix < 100; Ix++)
+				UTEST_OK("Writer Sink", Writer.WriteInt32(Ix));
+			UTEST_OK("Writer Sink", Writer.FlushSink());
 
+			TArray<uint8> Bytes = Sink.TakeBytes();
+			UTEST_EQUAL("Writer Sink", Bytes[0], (uint8)0xdd);	//	array32
+			UTEST_EQUAL("Writer Sink", Bytes[5], (uint8)0x82);	//	fixmap, ended before any flush
+
+			FDcMsgPackWriter Roundtrip;
+			UTEST_OK("Writer Sink", PipeMsgPackInto(Bytes, Roundtrip));
+			UTEST_EQUAL("Writer Sink", Roundtrip.Buffer.Num(), Expect.Buffer.Num());
+			UTEST_TRUE("Writer Sink", FPlatformMemory::Memcmp(Roundtrip.Buffer.GetData(), Expect.Buffer.GetData(), Expect.Buffer.Num()) == 0);
+		}
+	}
+
+	{
+		//	archive sinks only patch when opted in
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes);
+		UTEST_FALSE("Writer Sink", FDcArchiveSinkStream(&Ar).CanPatch());
+		UTEST_TRUE("Writer Sink", FDcArchiveSinkStream(&Ar, true).CanPatch());
+	}
+
+	{
+		FDcCallbackSinkStream Sink([](const uint8*, int64) { return false; });
+		FDcMsgPackWriter Writer;
+		UTEST_OK("Writer Sink", Writer.SetSink(&Sink, 1));
+		UTEST_DIAG("Writer Sink", Writer.WriteInt32(1), DcDReadWrite, SinkWriteFailed);
+	}
+
+	return true;
+}
 